@@ -62,8 +62,6 @@ CONFIG		+= pluto
 CONFIG		+= hackrf
 CONFIG		+= lime
 CONFIG		+= soapy
-CONFIG		+= sse2
-#CONFIG		+= avx2
 CONFIG		+= fdk-aac
 CONFIG		+= volk
 CONFIG		+= liquid
@@ -123,36 +121,40 @@ INCLUDEPATH += \
     src/devices/filereaders/wav_files \
     src/devices/filereaders/xml_filereader
 
-# --- src/common ---
+# The file lists are grouped like the CMake libraries: the headless core (dabstar_core and
+# dabstar_common_core in CMake, no widgets) and the GUI part. qmake still builds everything into one target.
+# --- src/common (widget free, used by the headless core) ---
 HEADERS += \
+    src/common/asymmetric_fence.h \
+    src/common/cpu_features.h \
     src/common/dab_constants.h \
     src/common/device_handler_if.h \
-    src/common/device_selector_if.h \
-    src/common/device_notifier_if.h \
     src/common/fir_filters.h \
     src/common/glob_data_types.h \
     src/common/glob_defs.h \
-    src/common/openfiledialog.h \
+    src/common/iq_converter.h \
+    src/common/polyphase_resampler.h \
     src/common/qt_compat.h \
-    src/common/ringbuffer.h \
+    src/common/ringbuffer.h
+
+# --- src/common (GUI and devices) ---
+HEADERS += \
+    src/common/device_selector_if.h \
+    src/common/device_notifier_if.h \
+    src/common/openfiledialog.h \
     src/common/setting_helper.cnf.h \
     src/common/setting_helper.h \
     src/common/xml_filewriter.h
 
-# --- src/base ---
+# --- src/base (headless DAB decoder core) ---
 HEADERS += \
-    src/base/audio/audio_pipeline.h \
     src/base/audio/audiofifo.h \
-    src/base/audio/audioiodevice.h \
-    src/base/audio/audiooutput_if.h \
-    src/base/audio/audiooutputqt.h \
-    src/base/audio/delay_line.h \
-    src/base/audio/resampler.h \
-    src/base/audio/test_tone.h \
     src/base/backend/backend.h \
     src/base/backend/backend_deconvolver.h \
     src/base/backend/backend_driver.h \
     src/base/backend/charsets.h \
+    src/base/backend/cif_decode_pool.h \
+    src/base/backend/cif_buffer_ring.h \
     src/base/backend/crc.h \
     src/base/backend/firecode_checker.h \
     src/base/backend/frame_processor.h \
@@ -160,13 +162,16 @@ HEADERS += \
     src/base/backend/mm_malloc.h \
     src/base/backend/msc_handler.h \
     src/base/backend/reed_solomon.h \
+    src/base/backend/reed_solomon_fast.h \
+    src/base/backend/time_deinterleaver.h \
     src/base/backend/audio/bit_writer.h \
     src/base/backend/audio/mp2processor.h \
+    src/base/backend/audio/mp2_synthesis.h \
     src/base/backend/audio/mp4processor.h \
     src/base/backend/data/data_processor.h \
     src/base/backend/data/ip_datahandler.h \
+    src/base/backend/data/journaline_data.h \
     src/base/backend/data/journaline_datahandler.h \
-    src/base/backend/data/journaline_viewer.h \
     src/base/backend/data/pad_handler.h \
     src/base/backend/data/tdc_datahandler.h \
     src/base/backend/data/virtual_datahandler.h \
@@ -185,7 +190,6 @@ HEADERS += \
     src/base/backend/data/mot/mot_dir.h \
     src/base/backend/data/mot/mot_handler.h \
     src/base/backend/data/mot/mot_object.h \
-    src/base/configuration/configuration.h \
     src/base/decoder/fib_config_fig0.h \
     src/base/decoder/fib_config_fig1.h \
     src/base/decoder/fib_decoder.h \
@@ -193,21 +197,12 @@ HEADERS += \
     src/base/decoder/fib_helper.h \
     src/base/decoder/fib_table.h \
     src/base/decoder/fic_decoder.h \
-    src/base/ensemble_list/ensemble_list.h \
-    src/base/ensemble_list/ensemble_list_db.h \
-    src/base/ensemble_list/ensemble_list_db_handler.h \
     src/base/eti_handler/eti_generator.h \
-    src/base/main/audio_manager.h \
     src/base/main/bit_extractors.h \
-    src/base/main/dab_channel_desc.h \
+    src/base/main/dab_observer_if.h \
     src/base/main/dab_processor.h \
-    src/base/main/dabradio.h \
-    src/base/main/epg_mot_handler.h \
-    src/base/main/gap_progress_bar.h \
     src/base/main/glob_enums.h \
     src/base/main/mot_content_types.h \
-    src/base/main/mot_slide_progress.h \
-    src/base/main/tii_manager.h \
     src/base/ofdm/freq_interleaver.h \
     src/base/ofdm/phasereference.h \
     src/base/ofdm/phasetable.h \
@@ -218,6 +213,38 @@ HEADERS += \
     src/base/protection/protection.h \
     src/base/protection/protTables.h \
     src/base/protection/uep_protection.h \
+    src/base/support/dab_tables.h \
+    src/base/support/process_params.h \
+    src/base/support/time_meas.h \
+    src/base/support/viterbi_spiral/sse2neon.h \
+    src/base/support/viterbi_spiral/viterbi_16way.h \
+    src/base/support/viterbi_spiral/viterbi_32way.h \
+    src/base/support/viterbi_spiral/viterbi_8way.h \
+    src/base/support/viterbi_spiral/viterbi_kernels.h \
+    src/base/support/viterbi_spiral/viterbi_scalar.h \
+    src/base/support/viterbi_spiral/viterbi_spiral.h
+
+# --- src/base (GUI) ---
+HEADERS += \
+    src/base/audio/audio_pipeline.h \
+    src/base/audio/audioiodevice.h \
+    src/base/audio/audiooutput_if.h \
+    src/base/audio/audiooutputqt.h \
+    src/base/audio/delay_line.h \
+    src/base/audio/resampler.h \
+    src/base/audio/test_tone.h \
+    src/base/backend/data/journaline_viewer.h \
+    src/base/configuration/configuration.h \
+    src/base/ensemble_list/ensemble_list.h \
+    src/base/ensemble_list/ensemble_list_db.h \
+    src/base/ensemble_list/ensemble_list_db_handler.h \
+    src/base/main/audio_manager.h \
+    src/base/main/dab_channel_desc.h \
+    src/base/main/dabradio.h \
+    src/base/main/epg_mot_handler.h \
+    src/base/main/gap_progress_bar.h \
+    src/base/main/mot_slide_progress.h \
+    src/base/main/tii_manager.h \
     src/base/scopes/audio_display.h \
     src/base/scopes/carrier_display.h \
     src/base/scopes/iqdisplay.h \
@@ -236,23 +263,19 @@ HEADERS += \
     src/base/support/content_table.h \
     src/base/support/converted_map.h \
     src/base/support/copyright_info.h \
-    src/base/support/dab_tables.h \
     src/base/support/dl_cache.h \
     src/base/support/gui_helpers.h \
     src/base/support/indicator_button.h \
     src/base/support/itu_regions.h \
     src/base/support/map_http_server.h \
     src/base/support/plotter.h \
-    src/base/support/process_params.h \
     src/base/support/techdata.h \
     src/base/support/tii_list_display.h \
-    src/base/support/time_meas.h \
     src/base/support/time_table.h \
     src/base/support/traffic_light.h \
     src/base/support/wav_writer.h \
     src/base/support/window_visibility_watcher.h \
     src/base/support/tii_library/tii_codes.h \
-    src/base/support/viterbi_spiral/viterbi_spiral.h \
     src/base/update/appversion.h \
     src/base/update/updatechecker.h \
     src/base/update/updatedialog.h
@@ -270,35 +293,39 @@ HEADERS += \
     src/devices/filereaders/xml_filereader/xml_filereader.h \
     src/devices/filereaders/xml_filereader/xml_reader.h
 
-# --- src/common ---
+# --- src/common (widget free, used by the headless core) ---
 SOURCES += \
     src/common/fir_filters.cpp \
+    src/common/iq_converter.cpp \
+    src/common/polyphase_resampler.cpp
+
+# --- src/common (GUI and devices) ---
+SOURCES += \
     src/common/openfiledialog.cpp \
     src/common/setting_helper.cpp \
     src/common/xml_filewriter.cpp
 
-# --- src/base ---
+# --- src/base (headless DAB decoder core) ---
 SOURCES += \
-    src/base/audio/audio_pipeline.cpp \
-    src/base/audio/audioiodevice.cpp \
-    src/base/audio/audiooutputqt.cpp \
-    src/base/audio/test_tone.cpp \
     src/base/backend/backend.cpp \
     src/base/backend/backend_deconvolver.cpp \
     src/base/backend/backend_driver.cpp \
     src/base/backend/charsets.cpp \
+    src/base/backend/cif_decode_pool.cpp \
     src/base/backend/crc.cpp \
     src/base/backend/firecode_checker.cpp \
     src/base/backend/galois.cpp \
     src/base/backend/msc_handler.cpp \
     src/base/backend/reed_solomon.cpp \
+    src/base/backend/reed_solomon_fast.cpp \
+    src/base/backend/time_deinterleaver.cpp \
     src/base/backend/audio/bit_writer.cpp \
     src/base/backend/audio/mp2processor.cpp \
+    src/base/backend/audio/mp2_synthesis.cpp \
     src/base/backend/audio/mp4processor.cpp \
     src/base/backend/data/data_processor.cpp \
     src/base/backend/data/ip_datahandler.cpp \
     src/base/backend/data/journaline_datahandler.cpp \
-    src/base/backend/data/journaline_viewer.cpp \
     src/base/backend/data/pad_handler.cpp \
     src/base/backend/data/tdc_datahandler.cpp \
     src/base/backend/data/epg/epgdec.cpp \
@@ -313,7 +340,6 @@ SOURCES += \
     src/base/backend/data/mot/mot_dir.cpp \
     src/base/backend/data/mot/mot_handler.cpp \
     src/base/backend/data/mot/mot_object.cpp \
-    src/base/configuration/configuration.cpp \
     src/base/decoder/fib_config_fig0.cpp \
     src/base/decoder/fib_config_fig1.cpp \
     src/base/decoder/fib_decoder.cpp \
@@ -322,31 +348,49 @@ SOURCES += \
     src/base/decoder/fib_decoder_string_getter.cpp \
     src/base/decoder/fib_helper.cpp \
     src/base/decoder/fic_decoder.cpp \
+    src/base/eti_handler/eti_generator.cpp \
+    src/base/main/dab_processor.cpp \
+    src/base/ofdm/freq_interleaver.cpp \
+    src/base/ofdm/phasereference.cpp \
+    src/base/ofdm/phasetable.cpp \
+    src/base/ofdm/sample_reader.cpp \
+    src/base/ofdm/tii_detector.cpp \
+    src/base/ofdm/timesyncer.cpp \
+    src/base/protection/eep_protection.cpp \
+    src/base/protection/protection.cpp \
+    src/base/protection/protTables.cpp \
+    src/base/protection/uep_protection.cpp \
+    src/base/support/dab_tables.cpp \
+    src/base/support/ringbuffer.cpp \
+    src/base/support/viterbi_spiral/viterbi_kernel_avx2.cpp \
+    src/base/support/viterbi_spiral/viterbi_kernel_avx512.cpp \
+    src/base/support/viterbi_spiral/viterbi_kernel_neon.cpp \
+    src/base/support/viterbi_spiral/viterbi_kernel_scalar.cpp \
+    src/base/support/viterbi_spiral/viterbi_kernel_sse2.cpp \
+    src/base/support/viterbi_spiral/viterbi_spiral.cpp
+
+# --- src/base (GUI) ---
+SOURCES += \
+    src/base/audio/audio_pipeline.cpp \
+    src/base/audio/audioiodevice.cpp \
+    src/base/audio/audiooutputqt.cpp \
+    src/base/audio/test_tone.cpp \
+    src/base/backend/data/journaline_viewer.cpp \
+    src/base/configuration/configuration.cpp \
     src/base/ensemble_list/ensemble_list.cpp \
     src/base/ensemble_list/ensemble_list_db.cpp \
     src/base/ensemble_list/ensemble_list_db_handler.cpp \
-    src/base/eti_handler/eti_generator.cpp \
     src/base/main/audio_manager.cpp \
-    src/base/main/dab_processor.cpp \
     src/base/main/dabradio.cpp \
     src/base/main/dabradio_ctrl.cpp \
     src/base/main/dabradio_dump.cpp \
     src/base/main/dabradio_el.cpp \
+    src/base/main/dabradio_observer.cpp \
     src/base/main/dabradio_ui.cpp \
     src/base/main/epg_mot_handler.cpp \
     src/base/main/main.cpp \
     src/base/main/mot_slide_progress.cpp \
     src/base/main/tii_manager.cpp \
-    src/base/ofdm/freq_interleaver.cpp \
-    src/base/ofdm/phasereference.cpp \
-    src/base/ofdm/phasetable.cpp \
-    src/base/ofdm/sample_reader.cpp \
-    src/base/ofdm/tii_detector.cpp \
-    src/base/ofdm/timesyncer.cpp \
-    src/base/protection/eep_protection.cpp \
-    src/base/protection/protection.cpp \
-    src/base/protection/protTables.cpp \
-    src/base/protection/uep_protection.cpp \
     src/base/scopes/audio_display.cpp \
     src/base/scopes/carrier_display.cpp \
     src/base/scopes/iqdisplay.cpp \
@@ -364,13 +408,11 @@ SOURCES += \
     src/base/support/compass_direction.cpp \
     src/base/support/content_table.cpp \
     src/base/support/copyright_info.cpp \
-    src/base/support/dab_tables.cpp \
     src/base/support/dl_cache.cpp \
     src/base/support/gui_helpers.cpp \
     src/base/support/indicator_button.cpp \
     src/base/support/itu_regions.cpp \
     src/base/support/map_http_server.cpp \
-    src/base/support/ringbuffer.cpp \
     src/base/support/techdata.cpp \
     src/base/support/tii_list_display.cpp \
     src/base/support/time_table.cpp \
@@ -378,7 +420,6 @@ SOURCES += \
     src/base/support/wav_writer.cpp \
     src/base/support/window_visibility_watcher.cpp \
     src/base/support/tii_library/tii_codes.cpp \
-    src/base/support/viterbi_spiral/viterbi_spiral.cpp \
     src/base/update/updatechecker.cpp \
     src/base/update/updatedialog.cpp
 
@@ -542,18 +583,6 @@ datastreamer	{
     SOURCES		+= src/base/server_thread/tcp_server.cpp
 }
 
-avx2	{
-    QMAKE_CXXFLAGS	+= -mavx2
-    DEFINES		+= HAVE_VITERBI_AVX2
-    HEADERS		+= src/base/support/viterbi_spiral/viterbi_16way.h
-}else:sse2	{
-    DEFINES		+= HAVE_VITERBI_SSE2
-    HEADERS		+= src/base/support/viterbi_spiral/viterbi_8way.h
-}else	{
-    HEADERS		+= src/base/support/viterbi_spiral/viterbi_scalar.h
-}
-
-
 fdk-aac {
     DEFINES		+= __WITH_FDK_AAC__
     INCLUDEPATH	+= $$EXT_INC/fdk-aac
@@ -569,8 +598,10 @@ fdk-aac {
 volk	{
     DEFINES		+= HAVE_SSE_OR_AVX
     HEADERS		+= src/base/support/simd_extensions.h \
-               src/base/ofdm/ofdm_decoder_simd.h
-    SOURCES		+= src/base/ofdm/ofdm_decoder_simd.cpp
+               src/base/ofdm/ofdm_decoder_simd.h \
+               src/base/ofdm/ofdm_soft_bit_kernels.h
+    SOURCES		+= src/base/ofdm/ofdm_decoder_simd.cpp \
+               src/base/ofdm/ofdm_soft_bit_kernels.cpp
     LIBS		+= -lvolk.dll
 }else	{
     HEADERS		+= src/base/ofdm/ofdm_decoder.h
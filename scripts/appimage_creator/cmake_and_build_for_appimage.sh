@@ -13,7 +13,7 @@ rm -rf "$DST"
 mkdir -p "$DST"
 cd "$DST"
 
-if cmake "$SRC" $CMFLAG $QtPath -DSSE_OR_AVX=ON -DUSE_LTO=ON -DAIRSPY=ON -DSDRPLAY=ON -DHACKRF=ON -DLIMESDR=ON -DRTL_TCP=ON -DPLUTO=ON -DUHD=ON -DRTLSDR=ON -DSPYSERVER=ON -DUSE_LIQUID=ON -DDATA_STREAMER=OFF -DVITERBI_SSE2=ON -DVITERBI_NEON=OFF -DFDK_AAC=ON -DSOAPY=ON; then
+if cmake "$SRC" $CMFLAG $QtPath -DSSE_OR_AVX=ON -DUSE_LTO=ON -DAIRSPY=ON -DSDRPLAY=ON -DHACKRF=ON -DLIMESDR=ON -DRTL_TCP=ON -DPLUTO=ON -DUHD=ON -DRTLSDR=ON -DSPYSERVER=ON -DUSE_LIQUID=ON -DDATA_STREAMER=OFF -DFDK_AAC=ON -DSOAPY=ON; then
     echo "cmake runs successfully, now we begin to build the application"
     "$CUD/build_only.sh"
 else
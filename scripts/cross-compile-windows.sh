@@ -433,7 +433,6 @@ build_dabstar() {
         -DUHD=OFF \
         -DSOAPY=OFF \
         -DFDK_AAC=ON \
-        -DVITERBI_SSE2=ON \
         -DSSE_OR_AVX=OFF \
         -DUSE_LTO=OFF \
         "-DCMAKE_AUTORCC_OPTIONS=--compress-algo;zlib"
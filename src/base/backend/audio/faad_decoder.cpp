@@ -30,21 +30,20 @@
 */
 #include "faad_decoder.h"
 #include "neaacdec.h"
-#include "dabradio.h"
-#include "audio_pipeline.h"
+#include "dab_observer_if.h"
 #include <algorithm>
 #include <cmath>
 
-FaadDecoder::FaadDecoder(const DabRadio * const ipDR, RingBuffer<i16> * ipBuffer)
+FaadDecoder::FaadDecoder(IDabObserver * const ipObserver, RingBuffer<i16> * ipBuffer)
 {
   mpAudioBuffer = ipBuffer;
   mAacCap = NeAACDecGetCapabilities();
   mAacHandle = NeAACDecOpen();
   mAacConf = NeAACDecGetCurrentConfiguration(mAacHandle);
 
-  if (ipDR != nullptr && ipDR->get_audio_pipeline() != nullptr)
+  if (ipObserver != nullptr)
   {
-    connect(this, &FaadDecoder::signal_new_audio, ipDR->get_audio_pipeline(), &AudioPipeline::slot_new_audio);
+    connect(this, &FaadDecoder::signal_new_audio, this, [ipObserver](i32 iNumSamples, u32 iSampleRate, u32 iAudioFlags) { ipObserver->new_audio(iNumSamples, iSampleRate, iAudioFlags); }, Qt::DirectConnection);
   }
 }
 
@@ -136,8 +135,8 @@ i16 FaadDecoder::convert_mp4_to_pcm(const SStreamParms * const iSP, const u8 * c
     return -1;
   }
 
-  const u32 audioFlags = (aacInfo.ps  ? DabRadio::AFL_PS_USED  : DabRadio::AFL_NONE) |
-                         (aacInfo.sbr ? DabRadio::AFL_SBR_USED : DabRadio::AFL_NONE);
+  const u32 audioFlags = (aacInfo.ps  ? IDabObserver::AFL_PS_USED  : IDabObserver::AFL_NONE) |
+                         (aacInfo.sbr ? IDabObserver::AFL_SBR_USED : IDabObserver::AFL_NONE);
 
   if (aacInfo.channels == 2)
   {
@@ -34,7 +34,7 @@
 #include "neaacdec.h"
 #include "ringbuffer.h"
 
-class DabRadio;
+class IDabObserver;
 
 struct SStreamParms
 {
@@ -53,7 +53,7 @@ class FaadDecoder : public QObject
 {
 Q_OBJECT
 public:
-  FaadDecoder(const DabRadio * ipDR, RingBuffer<i16> * ipBuffer);
+  FaadDecoder(IDabObserver * ipObserver, RingBuffer<i16> * ipBuffer);
   ~FaadDecoder();
 
   i16 convert_mp4_to_pcm(const SStreamParms * iSP, const u8 * ipBuffer, i16 iBufferLength);
@@ -31,16 +31,15 @@
  *  Use the fdk-aac library.
  */
 #include "mp4processor.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "fdk_aac.h"
-#include "audio_pipeline.h"
 
 /**
   * \class mp4Processor is the main handler for the aac frames
   * the class proper processes input and extracts the aac frames
   * that are processed by the "faadDecoder" class
   */
-FdkAAC::FdkAAC(const DabRadio * const ipDR, RingBuffer<i16> * const ipBuffer)
+FdkAAC::FdkAAC(IDabObserver * const ipObserver, RingBuffer<i16> * const ipBuffer)
   : mpAudioBuffer(ipBuffer)
 {
   mAacHandle = aacDecoder_Open(TT_MP4_LOAS, 1);
@@ -58,9 +57,9 @@ FdkAAC::FdkAAC(const DabRadio * const ipDR, RingBuffer<i16> * const ipBuffer)
   //       some AOTs (Audio Object Type), so it would require reworking the good-frame path - not used.
   aacDecoder_SetParam(mAacHandle, AAC_CONCEAL_METHOD, 1);
 
-  if (ipDR != nullptr && ipDR->get_audio_pipeline() != nullptr)
+  if (ipObserver != nullptr)
   {
-    connect(this, &FdkAAC::signal_new_audio, ipDR->get_audio_pipeline(), &AudioPipeline::slot_new_audio);
+    connect(this, &FdkAAC::signal_new_audio, this, [ipObserver](i32 iNumSamples, u32 iSampleRate, u32 iAudioFlags) { ipObserver->new_audio(iNumSamples, iSampleRate, iAudioFlags); }, Qt::DirectConnection);
   }
 
   mIsWorking = true;
@@ -126,8 +125,8 @@ i16 FdkAAC::convert_mp4_to_pcm(const SStreamParms * const iSP, const u8 * const
 
   const i32 audioBufferFillSize = info->sampleRate / 8; // 6000S@48000Sps -> 125ms
   const i32 stereoFrameSize = info->frameSize * 2;
-  const u32 audioFlags = (iSP->psFlag  ? DabRadio::AFL_PS_USED  : DabRadio::AFL_NONE) |
-                         (iSP->sbrFlag ? DabRadio::AFL_SBR_USED : DabRadio::AFL_NONE);
+  const u32 audioFlags = (iSP->psFlag  ? IDabObserver::AFL_PS_USED  : IDabObserver::AFL_NONE) |
+                         (iSP->sbrFlag ? IDabObserver::AFL_SBR_USED : IDabObserver::AFL_NONE);
 
   if (info->numChannels == 2)
   {
@@ -51,14 +51,14 @@ struct SStreamParms
   i32 ExtensionSrIndex;
 };
 
-class DabRadio;
+class IDabObserver;
 
 // fdkAAC is an interface to the fdk-aac library, using the LOAS protocol
 class FdkAAC : public QObject
 {
   Q_OBJECT
 public:
-  FdkAAC(const DabRadio * ipDR, RingBuffer<i16> * ipBuffer);
+  FdkAAC(IDabObserver * ipObserver, RingBuffer<i16> * ipBuffer);
   ~FdkAAC() override;
 
   i16 convert_mp4_to_pcm(const SStreamParms * iSP, const u8 * ipBuffer, i16 iPacketLength);
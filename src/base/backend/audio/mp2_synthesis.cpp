@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "mp2_synthesis.h"
+#include "cpu_features.h"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define TARGET_AVX2  __attribute__((target("avx2")))
+#else
+  #define TARGET_SSE41
+  #define TARGET_AVX2
+#endif
+
+/*
+ * Notes to the SIMD variants:
+ * - The matrixing calculates several V values at once with the transposed matrix N, each subband sample is
+ *   broadcast to all lanes. The sums are exact in 32 bit, the result is truncated (not saturated) to 16 bit like
+ *   the assignment to the i16 V ring in the scalar code.
+ * - The windowing needs the 16 blocks of 32 V values, which are contiguous in the V ring (the offset is a multiple
+ *   of 64), so the construction of U is only an address calculation. The window products use a wrapping 32 bit
+ *   multiplication like the scalar code.
+ * - The final clamping to 16 bit is done with a saturating pack.
+ */
+
+// synthesis window
+static const i32 D[512] = {
+  0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, -0x00001, -0x00001, -0x00001, -0x00001, -0x00002, -0x00002, -0x00003,
+  -0x00003, -0x00004, -0x00004, -0x00005, -0x00006, -0x00006, -0x00007, -0x00008, -0x00009, -0x0000A, -0x0000C, -0x0000D, -0x0000F,
+  -0x00010, -0x00012, -0x00014, -0x00017, -0x00019, -0x0001C, -0x0001E, -0x00022, -0x00025, -0x00028, -0x0002C, -0x00030, -0x00034,
+  -0x00039, -0x0003E, -0x00043, -0x00048, -0x0004E, -0x00054, -0x0005A, -0x00060, -0x00067, -0x0006E, -0x00074, -0x0007C, -0x00083,
+  -0x0008A, -0x00092, -0x00099, -0x000A0, -0x000A8, -0x000AF, -0x000B6, -0x000BD, -0x000C3, -0x000C9, -0x000CF, 0x000D5, 0x000DA, 0x000DE,
+  0x000E1, 0x000E3, 0x000E4, 0x000E4, 0x000E3, 0x000E0, 0x000DD, 0x000D7, 0x000D0, 0x000C8, 0x000BD, 0x000B1, 0x000A3, 0x00092, 0x0007F,
+  0x0006A, 0x00053, 0x00039, 0x0001D, -0x00001, -0x00023, -0x00047, -0x0006E, -0x00098, -0x000C4, -0x000F3, -0x00125, -0x0015A, -0x00190,
+  -0x001CA, -0x00206, -0x00244, -0x00284, -0x002C6, -0x0030A, -0x0034F, -0x00396, -0x003DE, -0x00427, -0x00470, -0x004B9, -0x00502,
+  -0x0054B, -0x00593, -0x005D9, -0x0061E, -0x00661, -0x006A1, -0x006DE, -0x00718, -0x0074D, -0x0077E, -0x007A9, -0x007D0, -0x007EF,
+  -0x00808, -0x0081A, -0x00824, -0x00826, -0x0081F, -0x0080E, 0x007F5, 0x007D0, 0x007A0, 0x00765, 0x0071E, 0x006CB, 0x0066C, 0x005FF,
+  0x00586, 0x00500, 0x0046B, 0x003CA, 0x0031A, 0x0025D, 0x00192, 0x000B9, -0x0002C, -0x0011F, -0x00220, -0x0032D, -0x00446, -0x0056B,
+  -0x0069B, -0x007D5, -0x00919, -0x00A66, -0x00BBB, -0x00D16, -0x00E78, -0x00FDE, -0x01148, -0x012B3, -0x01420, -0x0158C, -0x016F6,
+  -0x0185C, -0x019BC, -0x01B16, -0x01C66, -0x01DAC, -0x01EE5, -0x02010, -0x0212A, -0x02232, -0x02325, -0x02402, -0x024C7, -0x02570,
+  -0x025FE, -0x0266D, -0x026BB, -0x026E6, -0x026ED, -0x026CE, -0x02686, -0x02615, -0x02577, -0x024AC, -0x023B2, -0x02287, -0x0212B,
+  -0x01F9B, -0x01DD7, -0x01BDD, 0x019AE, 0x01747, 0x014A8, 0x011D1, 0x00EC0, 0x00B77, 0x007F5, 0x0043A, 0x00046, -0x003E5, -0x00849,
+  -0x00CE3, -0x011B4, -0x016B9, -0x01BF1, -0x0215B, -0x026F6, -0x02CBE, -0x032B3, -0x038D3, -0x03F1A, -0x04586, -0x04C15, -0x052C4,
+  -0x05990, -0x06075, -0x06771, -0x06E80, -0x0759F, -0x07CCA, -0x083FE, -0x08B37, -0x09270, -0x099A7, -0x0A0D7, -0x0A7FD, -0x0AF14,
+  -0x0B618, -0x0BD05, -0x0C3D8, -0x0CA8C, -0x0D11D, -0x0D789, -0x0DDC9, -0x0E3DC, -0x0E9BD, -0x0EF68, -0x0F4DB, -0x0FA12, -0x0FF09,
+  -0x103BD, -0x1082C, -0x10C53, -0x1102E, -0x113BD, -0x116FB, -0x119E8, -0x11C82, -0x11EC6, -0x120B3, -0x12248, -0x12385, -0x12467,
+  -0x124EF, 0x1251E, 0x124F0, 0x12468, 0x12386, 0x12249, 0x120B4, 0x11EC7, 0x11C83, 0x119E9, 0x116FC, 0x113BE, 0x1102F, 0x10C54, 0x1082D,
+  0x103BE, 0x0FF0A, 0x0FA13, 0x0F4DC, 0x0EF69, 0x0E9BE, 0x0E3DD, 0x0DDCA, 0x0D78A, 0x0D11E, 0x0CA8D, 0x0C3D9, 0x0BD06, 0x0B619, 0x0AF15,
+  0x0A7FE, 0x0A0D8, 0x099A8, 0x09271, 0x08B38, 0x083FF, 0x07CCB, 0x075A0, 0x06E81, 0x06772, 0x06076, 0x05991, 0x052C5, 0x04C16, 0x04587,
+  0x03F1B, 0x038D4, 0x032B4, 0x02CBF, 0x026F7, 0x0215C, 0x01BF2, 0x016BA, 0x011B5, 0x00CE4, 0x0084A, 0x003E6, -0x00045, -0x00439, -0x007F4,
+  -0x00B76, -0x00EBF, -0x011D0, -0x014A7, -0x01746, 0x019AE, 0x01BDE, 0x01DD8, 0x01F9C, 0x0212C, 0x02288, 0x023B3, 0x024AD, 0x02578,
+  0x02616, 0x02687, 0x026CF, 0x026EE, 0x026E7, 0x026BC, 0x0266E, 0x025FF, 0x02571, 0x024C8, 0x02403, 0x02326, 0x02233, 0x0212B, 0x02011,
+  0x01EE6, 0x01DAD, 0x01C67, 0x01B17, 0x019BD, 0x0185D, 0x016F7, 0x0158D, 0x01421, 0x012B4, 0x01149, 0x00FDF, 0x00E79, 0x00D17, 0x00BBC,
+  0x00A67, 0x0091A, 0x007D6, 0x0069C, 0x0056C, 0x00447, 0x0032E, 0x00221, 0x00120, 0x0002D, -0x000B8, -0x00191, -0x0025C, -0x00319,
+  -0x003C9, -0x0046A, -0x004FF, -0x00585, -0x005FE, -0x0066B, -0x006CA, -0x0071D, -0x00764, -0x0079F, -0x007CF, 0x007F5, 0x0080F, 0x00820,
+  0x00827, 0x00825, 0x0081B, 0x00809, 0x007F0, 0x007D1, 0x007AA, 0x0077F, 0x0074E, 0x00719, 0x006DF, 0x006A2, 0x00662, 0x0061F, 0x005DA,
+  0x00594, 0x0054C, 0x00503, 0x004BA, 0x00471, 0x00428, 0x003DF, 0x00397, 0x00350, 0x0030B, 0x002C7, 0x00285, 0x00245, 0x00207, 0x001CB,
+  0x00191, 0x0015B, 0x00126, 0x000F4, 0x000C5, 0x00099, 0x0006F, 0x00048, 0x00024, 0x00002, -0x0001C, -0x00038, -0x00052, -0x00069,
+  -0x0007E, -0x00091, -0x000A2, -0x000B0, -0x000BC, -0x000C7, -0x000CF, -0x000D6, -0x000DC, -0x000DF, -0x000E2, -0x000E3, -0x000E3,
+  -0x000E2, -0x000E0, -0x000DD, -0x000D9, 0x000D5, 0x000D0, 0x000CA, 0x000C4, 0x000BE, 0x000B7, 0x000B0, 0x000A9, 0x000A1, 0x0009A, 0x00093,
+  0x0008B, 0x00084, 0x0007D, 0x00075, 0x0006F, 0x00068, 0x00061, 0x0005B, 0x00055, 0x0004F, 0x00049, 0x00044, 0x0003F, 0x0003A, 0x00035,
+  0x00031, 0x0002D, 0x00029, 0x00026, 0x00023, 0x0001F, 0x0001D, 0x0001A, 0x00018, 0x00015, 0x00013, 0x00011, 0x00010, 0x0000E, 0x0000D,
+  0x0000B, 0x0000A, 0x00009, 0x00008, 0x00007, 0x00007, 0x00006, 0x00005, 0x00005, 0x00004, 0x00004, 0x00003, 0x00003, 0x00002, 0x00002,
+  0x00002, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001 };
+
+struct SSynthesisTables
+{
+  i16 N[64][32];   // matrixing coefficients
+  i32 NT[32][64];  // the same transposed for the SIMD variants
+
+  SSynthesisTables()
+  {
+    for (i32 i = 0; i < 64; i++)
+    {
+      for (i32 j = 0; j < 32; ++j)
+      {
+        N[i][j] = (i16)(256.0 * cos(((16 + i) * ((j << 1) + 1)) * 0.0490873852123405));
+        NT[j][i] = N[i][j];
+      }
+    }
+  }
+};
+
+static const SSynthesisTables & get_tables()
+{
+  static const SSynthesisTables tables;
+  return tables;
+}
+
+// start of block m (0..15) of U within the V ring, U[32 * m + j] = V[get_v_block_offset(iVOffs, m) + j]
+static inline i32 get_v_block_offset(const i32 iVOffs, const i32 m)
+{
+  return (iVOffs + ((m >> 1) << 7) + ((m & 1) ? 96 : 0)) & 1023;
+}
+
+void mp2_synthesis_kernel_scalar(const i32 * const ipSamples, i16 * const iopV, const i32 iVOffs, i16 * const opPcm, const i32 iPcmStride)
+{
+  const SSynthesisTables & t = get_tables();
+  i32 U[512];
+  i32 i, j, sum;
+
+  // matrixing
+  for (i = 0; i < 64; ++i)
+  {
+    sum = 0;
+    for (j = 0; j < 32; ++j) // 8b*15b=23b
+      sum += t.N[i][j] * ipSamples[j];
+    // intermediate value is 28 bit (23 + 5), clamp to 14b
+    //
+    iopV[iVOffs + i] = (i16)((sum + 8192) >> 14);
+  }
+
+  // construction of U
+  for (i = 0; i < 8; ++i)
+    for (j = 0; j < 32; ++j)
+    {
+      U[(i << 6) + j] = iopV[(iVOffs + (i << 7) + j) & 1023];
+      U[(i << 6) + j + 32] = iopV[(iVOffs + (i << 7) + j + 96) & 1023];
+    }
+
+  // apply window
+  for (i = 0; i < 512; ++i)
+    U[i] = (U[i] * D[i] + 32) >> 6;
+
+  // output samples
+  for (j = 0; j < 32; ++j)
+  {
+    sum = 0;
+    for (i = 0; i < 16; ++i)
+      sum -= U[(i << 5) + j];
+    sum = (sum + 8) >> 4;
+    if (sum < -32768)
+      sum = -32768;
+    if (sum > 32767)
+      sum = 32767;
+    opPcm[j * iPcmStride] = (i16)sum;
+  }
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TARGET_SSE41 void mp2_synthesis_kernel_sse41(const i32 * const ipSamples, i16 * const iopV, const i32 iVOffs, i16 * const opPcm, const i32 iPcmStride)
+{
+  const SSynthesisTables & t = get_tables();
+
+  // matrixing, 4 V values per vector
+  __m128i acc[16];
+  for (i32 k = 0; k < 16; ++k)
+  {
+    acc[k] = _mm_setzero_si128();
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    const __m128i s = _mm_set1_epi32(ipSamples[j]);
+    for (i32 k = 0; k < 16; ++k)
+    {
+      acc[k] = _mm_add_epi32(acc[k], _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)&t.NT[j][4 * k]), s));
+    }
+  }
+
+  const __m128i rnd14 = _mm_set1_epi32(8192);
+  const __m128i mask16 = _mm_set1_epi32(0xFFFF);
+  for (i32 k = 0; k < 16; k += 2)
+  {
+    const __m128i a = _mm_and_si128(_mm_srai_epi32(_mm_add_epi32(acc[k], rnd14), 14), mask16);
+    const __m128i b = _mm_and_si128(_mm_srai_epi32(_mm_add_epi32(acc[k + 1], rnd14), 14), mask16);
+    _mm_storeu_si128((__m128i *)&iopV[iVOffs + 4 * k], _mm_packus_epi32(a, b));
+  }
+
+  // windowing and summation of the 16 U blocks, 4 output samples per vector
+  const __m128i rnd6 = _mm_set1_epi32(32);
+  __m128i sum[8];
+  for (i32 q = 0; q < 8; ++q)
+  {
+    sum[q] = _mm_setzero_si128();
+  }
+
+  for (i32 m = 0; m < 16; ++m)
+  {
+    const i16 * const pV = &iopV[get_v_block_offset(iVOffs, m)];
+    const i32 * const pD = &D[32 * m];
+    for (i32 q = 0; q < 8; ++q)
+    {
+      const __m128i u = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)&pV[4 * q]));
+      const __m128i w = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(u, _mm_loadu_si128((const __m128i *)&pD[4 * q])), rnd6), 6);
+      sum[q] = _mm_sub_epi32(sum[q], w);
+    }
+  }
+
+  const __m128i rnd4 = _mm_set1_epi32(8);
+  alignas(16) i16 pcm[32];
+  for (i32 q = 0; q < 8; q += 2)
+  {
+    const __m128i a = _mm_srai_epi32(_mm_add_epi32(sum[q], rnd4), 4);
+    const __m128i b = _mm_srai_epi32(_mm_add_epi32(sum[q + 1], rnd4), 4);
+    _mm_store_si128((__m128i *)&pcm[4 * q], _mm_packs_epi32(a, b));
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    opPcm[j * iPcmStride] = pcm[j];
+  }
+}
+
+TARGET_AVX2 void mp2_synthesis_kernel_avx2(const i32 * const ipSamples, i16 * const iopV, const i32 iVOffs, i16 * const opPcm, const i32 iPcmStride)
+{
+  const SSynthesisTables & t = get_tables();
+
+  // matrixing, 8 V values per vector
+  __m256i acc[8];
+  for (i32 k = 0; k < 8; ++k)
+  {
+    acc[k] = _mm256_setzero_si256();
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    const __m256i s = _mm256_set1_epi32(ipSamples[j]);
+    for (i32 k = 0; k < 8; ++k)
+    {
+      acc[k] = _mm256_add_epi32(acc[k], _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i *)&t.NT[j][8 * k]), s));
+    }
+  }
+
+  // the packs work within the 128 bit lanes, so the 64 bit quarters have to be reordered afterwards
+  const __m256i rnd14 = _mm256_set1_epi32(8192);
+  const __m256i mask16 = _mm256_set1_epi32(0xFFFF);
+  for (i32 k = 0; k < 8; k += 2)
+  {
+    const __m256i a = _mm256_and_si256(_mm256_srai_epi32(_mm256_add_epi32(acc[k], rnd14), 14), mask16);
+    const __m256i b = _mm256_and_si256(_mm256_srai_epi32(_mm256_add_epi32(acc[k + 1], rnd14), 14), mask16);
+    _mm256_storeu_si256((__m256i *)&iopV[iVOffs + 8 * k], _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8));
+  }
+
+  // windowing and summation of the 16 U blocks, 8 output samples per vector
+  const __m256i rnd6 = _mm256_set1_epi32(32);
+  __m256i sum[4];
+  for (i32 q = 0; q < 4; ++q)
+  {
+    sum[q] = _mm256_setzero_si256();
+  }
+
+  for (i32 m = 0; m < 16; ++m)
+  {
+    const i16 * const pV = &iopV[get_v_block_offset(iVOffs, m)];
+    const i32 * const pD = &D[32 * m];
+    for (i32 q = 0; q < 4; ++q)
+    {
+      const __m256i u = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&pV[8 * q]));
+      const __m256i w = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(u, _mm256_loadu_si256((const __m256i *)&pD[8 * q])), rnd6), 6);
+      sum[q] = _mm256_sub_epi32(sum[q], w);
+    }
+  }
+
+  const __m256i rnd4 = _mm256_set1_epi32(8);
+  alignas(32) i16 pcm[32];
+  for (i32 q = 0; q < 4; q += 2)
+  {
+    const __m256i a = _mm256_srai_epi32(_mm256_add_epi32(sum[q], rnd4), 4);
+    const __m256i b = _mm256_srai_epi32(_mm256_add_epi32(sum[q + 1], rnd4), 4);
+    _mm256_store_si256((__m256i *)&pcm[8 * q], _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8));
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    opPcm[j * iPcmStride] = pcm[j];
+  }
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+void mp2_synthesis_kernel_neon(const i32 * const ipSamples, i16 * const iopV, const i32 iVOffs, i16 * const opPcm, const i32 iPcmStride)
+{
+  const SSynthesisTables & t = get_tables();
+
+  // matrixing, 4 V values per vector
+  int32x4_t acc[16];
+  for (i32 k = 0; k < 16; ++k)
+  {
+    acc[k] = vdupq_n_s32(0);
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    const i32 s = ipSamples[j];
+    for (i32 k = 0; k < 16; ++k)
+    {
+      acc[k] = vmlaq_n_s32(acc[k], vld1q_s32(&t.NT[j][4 * k]), s);
+    }
+  }
+
+  const int32x4_t rnd14 = vdupq_n_s32(8192);
+  for (i32 k = 0; k < 16; ++k)
+  {
+    vst1_s16(&iopV[iVOffs + 4 * k], vmovn_s32(vshrq_n_s32(vaddq_s32(acc[k], rnd14), 14))); // truncating narrow
+  }
+
+  // windowing and summation of the 16 U blocks, 4 output samples per vector
+  const int32x4_t rnd6 = vdupq_n_s32(32);
+  int32x4_t sum[8];
+  for (i32 q = 0; q < 8; ++q)
+  {
+    sum[q] = vdupq_n_s32(0);
+  }
+
+  for (i32 m = 0; m < 16; ++m)
+  {
+    const i16 * const pV = &iopV[get_v_block_offset(iVOffs, m)];
+    const i32 * const pD = &D[32 * m];
+    for (i32 q = 0; q < 8; ++q)
+    {
+      const int32x4_t u = vmovl_s16(vld1_s16(&pV[4 * q]));
+      sum[q] = vsubq_s32(sum[q], vshrq_n_s32(vaddq_s32(vmulq_s32(u, vld1q_s32(&pD[4 * q])), rnd6), 6));
+    }
+  }
+
+  const int32x4_t rnd4 = vdupq_n_s32(8);
+  i16 pcm[32];
+  for (i32 q = 0; q < 8; ++q)
+  {
+    vst1_s16(&pcm[4 * q], vqmovn_s32(vshrq_n_s32(vaddq_s32(sum[q], rnd4), 4))); // saturating narrow
+  }
+
+  for (i32 j = 0; j < 32; ++j)
+  {
+    opPcm[j * iPcmStride] = pcm[j];
+  }
+}
+
+#endif
+
+const SMp2SynthesisKernel & get_mp2_synthesis_kernel()
+{
+  static const SMp2SynthesisKernel kernel = []() -> SMp2SynthesisKernel
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (CpuFeatures::has_avx2()) return { mp2_synthesis_kernel_avx2, "AVX2" };
+    if (CpuFeatures::has_sse41()) return { mp2_synthesis_kernel_sse41, "SSE4.1" };
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (CpuFeatures::has_neon()) return { mp2_synthesis_kernel_neon, "NEON" };
+#endif
+    return { mp2_synthesis_kernel_scalar, "Scalar" };
+  }();
+  return kernel;
+}
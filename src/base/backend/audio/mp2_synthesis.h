@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+/*
+ * Polyphase synthesis filterbank of the MP2 (kjmp2) decoder for one channel and one sub-block: matrixing of the
+ * 32 subband samples into the V ring and windowing of the V ring into 32 PCM samples.
+ * All variants use the same integer arithmetic as the original kjmp2 code (incl. rounding, the truncation of the
+ * matrixing result to 16 bit and the clamping of the output), so the PCM output is bit-identical.
+ * The scalar, SSE4.1, AVX2 and NEON (AArch64) variants are compiled in, the best one is chosen at runtime.
+ */
+#include "glob_data_types.h"
+
+// ipSamples: 32 subband samples, iopV: V ring of 1024 values, iVOffs: current offset in the V ring (multiple of 64),
+// opPcm: 32 output samples, written with the distance iPcmStride (2 for interleaved stereo)
+using TMp2SynthesisKernel = void (*)(const i32 * ipSamples, i16 * iopV, i32 iVOffs, i16 * opPcm, i32 iPcmStride);
+
+void mp2_synthesis_kernel_scalar(const i32 * ipSamples, i16 * iopV, i32 iVOffs, i16 * opPcm, i32 iPcmStride);
+#if defined(__x86_64__) || defined(_M_X64)
+void mp2_synthesis_kernel_sse41(const i32 * ipSamples, i16 * iopV, i32 iVOffs, i16 * opPcm, i32 iPcmStride);
+void mp2_synthesis_kernel_avx2(const i32 * ipSamples, i16 * iopV, i32 iVOffs, i16 * opPcm, i32 iPcmStride);
+#elif defined(__aarch64__) || defined(_M_ARM64)
+void mp2_synthesis_kernel_neon(const i32 * ipSamples, i16 * iopV, i32 iVOffs, i16 * opPcm, i32 iPcmStride);
+#endif
+
+struct SMp2SynthesisKernel
+{
+  TMp2SynthesisKernel pFunc;
+  const char * pName;
+};
+
+const SMp2SynthesisKernel & get_mp2_synthesis_kernel();
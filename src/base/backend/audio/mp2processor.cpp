@@ -36,10 +36,11 @@
 //	of the sdr-j DAB/DAB+ software
 //
 #include "mp2processor.h"
-#include "dabradio.h"
-#include "audio_pipeline.h"
+#include "dab_observer_if.h"
 #include "bit_extractors.h"
 #include "pad_handler.h"
+#include "mp2_synthesis.h"
+#include <algorithm>
 
 #ifdef _MSC_VER
   #define FASTCALL __fastcall
@@ -72,46 +73,6 @@ static const short bitrates[28] = {
 // scale factor base values (24-bit fixed-point)
 static const i32 scf_base[3] = { 0x02000000, 0x01965FEA, 0x01428A30 };
 
-// synthesis window
-static const i32 D[512] = {
-  0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, -0x00001, -0x00001, -0x00001, -0x00001, -0x00002, -0x00002, -0x00003,
-  -0x00003, -0x00004, -0x00004, -0x00005, -0x00006, -0x00006, -0x00007, -0x00008, -0x00009, -0x0000A, -0x0000C, -0x0000D, -0x0000F,
-  -0x00010, -0x00012, -0x00014, -0x00017, -0x00019, -0x0001C, -0x0001E, -0x00022, -0x00025, -0x00028, -0x0002C, -0x00030, -0x00034,
-  -0x00039, -0x0003E, -0x00043, -0x00048, -0x0004E, -0x00054, -0x0005A, -0x00060, -0x00067, -0x0006E, -0x00074, -0x0007C, -0x00083,
-  -0x0008A, -0x00092, -0x00099, -0x000A0, -0x000A8, -0x000AF, -0x000B6, -0x000BD, -0x000C3, -0x000C9, -0x000CF, 0x000D5, 0x000DA, 0x000DE,
-  0x000E1, 0x000E3, 0x000E4, 0x000E4, 0x000E3, 0x000E0, 0x000DD, 0x000D7, 0x000D0, 0x000C8, 0x000BD, 0x000B1, 0x000A3, 0x00092, 0x0007F,
-  0x0006A, 0x00053, 0x00039, 0x0001D, -0x00001, -0x00023, -0x00047, -0x0006E, -0x00098, -0x000C4, -0x000F3, -0x00125, -0x0015A, -0x00190,
-  -0x001CA, -0x00206, -0x00244, -0x00284, -0x002C6, -0x0030A, -0x0034F, -0x00396, -0x003DE, -0x00427, -0x00470, -0x004B9, -0x00502,
-  -0x0054B, -0x00593, -0x005D9, -0x0061E, -0x00661, -0x006A1, -0x006DE, -0x00718, -0x0074D, -0x0077E, -0x007A9, -0x007D0, -0x007EF,
-  -0x00808, -0x0081A, -0x00824, -0x00826, -0x0081F, -0x0080E, 0x007F5, 0x007D0, 0x007A0, 0x00765, 0x0071E, 0x006CB, 0x0066C, 0x005FF,
-  0x00586, 0x00500, 0x0046B, 0x003CA, 0x0031A, 0x0025D, 0x00192, 0x000B9, -0x0002C, -0x0011F, -0x00220, -0x0032D, -0x00446, -0x0056B,
-  -0x0069B, -0x007D5, -0x00919, -0x00A66, -0x00BBB, -0x00D16, -0x00E78, -0x00FDE, -0x01148, -0x012B3, -0x01420, -0x0158C, -0x016F6,
-  -0x0185C, -0x019BC, -0x01B16, -0x01C66, -0x01DAC, -0x01EE5, -0x02010, -0x0212A, -0x02232, -0x02325, -0x02402, -0x024C7, -0x02570,
-  -0x025FE, -0x0266D, -0x026BB, -0x026E6, -0x026ED, -0x026CE, -0x02686, -0x02615, -0x02577, -0x024AC, -0x023B2, -0x02287, -0x0212B,
-  -0x01F9B, -0x01DD7, -0x01BDD, 0x019AE, 0x01747, 0x014A8, 0x011D1, 0x00EC0, 0x00B77, 0x007F5, 0x0043A, 0x00046, -0x003E5, -0x00849,
-  -0x00CE3, -0x011B4, -0x016B9, -0x01BF1, -0x0215B, -0x026F6, -0x02CBE, -0x032B3, -0x038D3, -0x03F1A, -0x04586, -0x04C15, -0x052C4,
-  -0x05990, -0x06075, -0x06771, -0x06E80, -0x0759F, -0x07CCA, -0x083FE, -0x08B37, -0x09270, -0x099A7, -0x0A0D7, -0x0A7FD, -0x0AF14,
-  -0x0B618, -0x0BD05, -0x0C3D8, -0x0CA8C, -0x0D11D, -0x0D789, -0x0DDC9, -0x0E3DC, -0x0E9BD, -0x0EF68, -0x0F4DB, -0x0FA12, -0x0FF09,
-  -0x103BD, -0x1082C, -0x10C53, -0x1102E, -0x113BD, -0x116FB, -0x119E8, -0x11C82, -0x11EC6, -0x120B3, -0x12248, -0x12385, -0x12467,
-  -0x124EF, 0x1251E, 0x124F0, 0x12468, 0x12386, 0x12249, 0x120B4, 0x11EC7, 0x11C83, 0x119E9, 0x116FC, 0x113BE, 0x1102F, 0x10C54, 0x1082D,
-  0x103BE, 0x0FF0A, 0x0FA13, 0x0F4DC, 0x0EF69, 0x0E9BE, 0x0E3DD, 0x0DDCA, 0x0D78A, 0x0D11E, 0x0CA8D, 0x0C3D9, 0x0BD06, 0x0B619, 0x0AF15,
-  0x0A7FE, 0x0A0D8, 0x099A8, 0x09271, 0x08B38, 0x083FF, 0x07CCB, 0x075A0, 0x06E81, 0x06772, 0x06076, 0x05991, 0x052C5, 0x04C16, 0x04587,
-  0x03F1B, 0x038D4, 0x032B4, 0x02CBF, 0x026F7, 0x0215C, 0x01BF2, 0x016BA, 0x011B5, 0x00CE4, 0x0084A, 0x003E6, -0x00045, -0x00439, -0x007F4,
-  -0x00B76, -0x00EBF, -0x011D0, -0x014A7, -0x01746, 0x019AE, 0x01BDE, 0x01DD8, 0x01F9C, 0x0212C, 0x02288, 0x023B3, 0x024AD, 0x02578,
-  0x02616, 0x02687, 0x026CF, 0x026EE, 0x026E7, 0x026BC, 0x0266E, 0x025FF, 0x02571, 0x024C8, 0x02403, 0x02326, 0x02233, 0x0212B, 0x02011,
-  0x01EE6, 0x01DAD, 0x01C67, 0x01B17, 0x019BD, 0x0185D, 0x016F7, 0x0158D, 0x01421, 0x012B4, 0x01149, 0x00FDF, 0x00E79, 0x00D17, 0x00BBC,
-  0x00A67, 0x0091A, 0x007D6, 0x0069C, 0x0056C, 0x00447, 0x0032E, 0x00221, 0x00120, 0x0002D, -0x000B8, -0x00191, -0x0025C, -0x00319,
-  -0x003C9, -0x0046A, -0x004FF, -0x00585, -0x005FE, -0x0066B, -0x006CA, -0x0071D, -0x00764, -0x0079F, -0x007CF, 0x007F5, 0x0080F, 0x00820,
-  0x00827, 0x00825, 0x0081B, 0x00809, 0x007F0, 0x007D1, 0x007AA, 0x0077F, 0x0074E, 0x00719, 0x006DF, 0x006A2, 0x00662, 0x0061F, 0x005DA,
-  0x00594, 0x0054C, 0x00503, 0x004BA, 0x00471, 0x00428, 0x003DF, 0x00397, 0x00350, 0x0030B, 0x002C7, 0x00285, 0x00245, 0x00207, 0x001CB,
-  0x00191, 0x0015B, 0x00126, 0x000F4, 0x000C5, 0x00099, 0x0006F, 0x00048, 0x00024, 0x00002, -0x0001C, -0x00038, -0x00052, -0x00069,
-  -0x0007E, -0x00091, -0x000A2, -0x000B0, -0x000BC, -0x000C7, -0x000CF, -0x000D6, -0x000DC, -0x000DF, -0x000E2, -0x000E3, -0x000E3,
-  -0x000E2, -0x000E0, -0x000DD, -0x000D9, 0x000D5, 0x000D0, 0x000CA, 0x000C4, 0x000BE, 0x000B7, 0x000B0, 0x000A9, 0x000A1, 0x0009A, 0x00093,
-  0x0008B, 0x00084, 0x0007D, 0x00075, 0x0006F, 0x00068, 0x00061, 0x0005B, 0x00055, 0x0004F, 0x00049, 0x00044, 0x0003F, 0x0003A, 0x00035,
-  0x00031, 0x0002D, 0x00029, 0x00026, 0x00023, 0x0001F, 0x0001D, 0x0001A, 0x00018, 0x00015, 0x00013, 0x00011, 0x00010, 0x0000E, 0x0000D,
-  0x0000B, 0x0000A, 0x00009, 0x00008, 0x00007, 0x00007, 0x00006, 0x00005, 0x00005, 0x00004, 0x00004, 0x00003, 0x00003, 0x00002, 0x00002,
-  0x00002, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001 };
-
 
 ///////////// Table 3-B.2: Possible quantization per subband ///////////////////
 
@@ -194,42 +155,31 @@ static struct SQuantizerSpec quantizer_table[17] = {{ 3,     1,  5 },  //  1
 //	(J van Katwijk)
 ////////////////////////////////////////////////////////////////////////////////
 
-Mp2Processor::Mp2Processor(DabRadio * mr, i16 bitRate, RingBuffer<i16> * const iopAudioBuffer, RingBuffer<u8> * const iopFrameBuffer)
-  : my_padhandler(mr)
+Mp2Processor::Mp2Processor(IDabObserver * ipObserver, i16 bitRate, RingBuffer<i16> * const iopAudioBuffer, RingBuffer<u8> * const iopFrameBuffer)
+  : my_padhandler(ipObserver)
   , audioBuffer(iopAudioBuffer)
   , frameBuffer(iopFrameBuffer)
 {
-  i16 i, j;
-  i16 * nPtr = &N[0][0];
-
-  // compute N[i][j]
-  for (i = 0; i < 64; i++)
-  {
-    for (j = 0; j < 32; ++j)
-    {
-      *nPtr++ = (i16)(256.0 * cos(((16 + i) * ((j << 1) + 1)) * 0.0490873852123405));
-    }
-  }
+  qInfo("Using %s for MP2 synthesis filterbank", get_mp2_synthesis_kernel().pName);
 
   // perform local initialization:
-  for (i = 0; i < 2; ++i)
+  for (i16 i = 0; i < 2; ++i)
   {
-    for (j = 1023; j >= 0; j--)
+    for (i16 j = 1023; j >= 0; j--)
     {
       V[i][j] = 0;
     }
   }
 
-  myRadioInterface = mr;
   this->bitRate = bitRate;
 
-  connect(this, &Mp2Processor::signal_show_frameErrors, mr, &DabRadio::slot_show_frame_errors);
-  if (mr != nullptr && mr->get_audio_pipeline() != nullptr)
+  if (ipObserver != nullptr)
   {
-    connect(this, &Mp2Processor::signal_new_audio, mr->get_audio_pipeline(), &AudioPipeline::slot_new_audio);
-    connect(this, &Mp2Processor::signal_new_mp2_frame, mr->get_audio_pipeline(), &AudioPipeline::slot_new_aac_mp2_frame);
+    connect(this, &Mp2Processor::signal_show_frameErrors, this, [ipObserver](i32 iErrors) { ipObserver->show_frame_errors(iErrors); }, Qt::DirectConnection);
+    connect(this, &Mp2Processor::signal_new_audio, this, [ipObserver](i32 iNumSamples, u32 iSampleRate, u32 iAudioFlags) { ipObserver->new_audio(iNumSamples, iSampleRate, iAudioFlags); }, Qt::DirectConnection);
+    connect(this, &Mp2Processor::signal_new_mp2_frame, this, [ipObserver]() { ipObserver->new_aac_mp2_frame(); }, Qt::DirectConnection);
+    connect(this, &Mp2Processor::signal_is_stereo, this, [ipObserver](bool iStereo) { ipObserver->set_stereo(iStereo); }, Qt::DirectConnection);
   }
-  connect(this, &Mp2Processor::signal_is_stereo, mr, &DabRadio::slot_set_stereo);
 
   Voffs = 0;
   sampleRate = 48000;  // default for DAB
@@ -382,8 +332,9 @@ i32 Mp2Processor::_mp2_decode_frame(const std::vector<u8> & iFrame, i16 * opPcm)
   u32 mode;
   u32 frame_size;
   i32 bound, sblimit;
-  i32 sb, ch, gr, part, idx, nch, i, j, sum;
+  i32 sb, ch, gr, part, idx, nch;
   i32 table_idx;
+  const TMp2SynthesisKernel synthesis = get_mp2_synthesis_kernel().pFunc;
 
   numberofFrames++;
   if (numberofFrames >= 25)
@@ -563,42 +514,12 @@ i32 Mp2Processor::_mp2_decode_frame(const std::vector<u8> & iFrame, i16 * opPcm)
 
         for (ch = 0; ch < 2; ++ch)
         {
-          // matrixing
-          for (i = 0; i < 64; ++i)
-          {
-            sum = 0;
-            for (j = 0; j < 32; ++j) // 8b*15b=23b
-              sum += N[i][j] * sample[ch][j][idx];
-            // intermediate value is 28 bit (23 + 5), clamp to 14b
-            //
-            V[ch][table_idx + i] = (sum + 8192) >> 14;
-          }
+          // matrixing, windowing and output of 32 interleaved PCM samples
+          i32 subbandSamples[32];
+          for (sb = 0; sb < 32; ++sb)
+            subbandSamples[sb] = sample[ch][sb][idx];
 
-          // construction of U
-          for (i = 0; i < 8; ++i)
-            for (j = 0; j < 32; ++j)
-            {
-              U[(i << 6) + j] = V[ch][(table_idx + (i << 7) + j) & 1023];
-              U[(i << 6) + j + 32] = V[ch][(table_idx + (i << 7) + j + 96) & 1023];
-            }
-
-          // apply window
-          for (i = 0; i < 512; ++i)
-            U[i] = (U[i] * D[i] + 32) >> 6;
-
-          // output samples
-          for (j = 0; j < 32; ++j)
-          {
-            sum = 0;
-            for (i = 0; i < 16; ++i)
-              sum -= U[(i << 5) + j];
-            sum = (sum + 8) >> 4;
-            if (sum < -32768)
-              sum = -32768;
-            if (sum > 32767)
-              sum = 32767;
-            opPcm[(idx << 6) | (j << 1) | ch] = (u16)sum;
-          }
+          synthesis(subbandSamples, V[ch], table_idx, &opPcm[(idx << 6) | ch], 2);
         } // end of synthesis channel loop
       } // end of synthesis sub-block loop
       // adjust PCM output pointer: decoded 3 * 32 = 96 stereo samples
@@ -608,20 +529,20 @@ i32 Mp2Processor::_mp2_decode_frame(const std::vector<u8> & iFrame, i16 * opPcm)
   return frame_size;
 }
 
-void Mp2Processor::_process_pad_data(const std::vector<u8> & iBits)
+void Mp2Processor::_process_pad_data(const std::vector<u8> & iData)
 {
   i16 vLengthBytes = 24 * bitRate / 8;
 
-  if (vLengthBytes * 8 != (i16)iBits.size())
+  if (vLengthBytes != (i16)iData.size())
   {
-    qCritical() << "MP2: pad data length mismatch" << vLengthBytes << iBits.size();
+    qCritical() << "MP2: pad data length mismatch" << vLengthBytes << iData.size();
   }
 
   const i16 scfCrcSize = bitRate * 1000 >= 56000 ? 4 : 2;
   vLengthBytes -= scfCrcSize + 2; // remove CRC bytes and L0, L1
 
-  const u8 L0 = getBits_8(iBits.data(), iBits.size() - 1 * 8);
-  const u8 L1 = getBits_8(iBits.data(), iBits.size() - 2 * 8);
+  const u8 L0 = iData[iData.size() - 1];
+  const u8 L1 = iData[iData.size() - 2];
 
   const u8 fPadType = (L1 >> 6) & 0x3;
   const u8 xPadInd  = (L1 >> 4) & 0x3;
@@ -644,55 +565,44 @@ void Mp2Processor::_process_pad_data(const std::vector<u8> & iBits)
     return;
   }
 
-  const u8 * pBits;
+  const u8 * pPadData;
 
   if (xPadInd == 0x1) // short X-PAD
   {
-    pBits = iBits.data() + 8 * (vLengthBytes - 4); // only 4 bytes for short X-PAD is needed
+    pPadData = iData.data() + (vLengthBytes - 4); // only 4 bytes for short X-PAD is needed
     vLengthBytes = 4;
   }
   else // variable size X-PAD
   {
-    pBits = iBits.data(); // assume full vector is PAD
-  }
-
-
-  auto * const pPadData = make_vla(u8, vLengthBytes);
-
-  // convert one-bit-per-byte to a byte value stream
-  for (i16 i = 0; i < vLengthBytes; i++)
-  {
-    pPadData[i] = 0;
-    for (i16 j = 0; j < 8; j++)
-    {
-      pPadData[i] <<= 1;
-      pPadData[i] |= pBits[8 * i + j] & 01;
-    }
+    pPadData = iData.data(); // assume full vector is PAD
   }
 
   my_padhandler.process_PAD(pPadData, vLengthBytes - 1, L1, L0);
 }
 
 //
-//	bits to MP2 frames, amount is amount of bits
-void Mp2Processor::add_to_frame(const std::vector<u8> & iBits)
+//	bits to MP2 frames, amount is amount of bits, iData holds them packed into bytes
+void Mp2Processor::add_to_frame(const std::vector<u8> & iData)
 {
   i16 lf = sampleRate == 48000 ? MP2framesize : 2 * MP2framesize;
   const i16 amount = MP2framesize;
-  assert(amount == (i16)iBits.size());
+  assert(amount == 8 * (i16)iData.size());
   const i32 audioBufferFillSize = sampleRate / 8; // 6000S@48000Sps -> 125us
 
-  for (i16 i = 0; i < amount; i++)
+  for (i16 i = 0; i < amount; )
   {
     if (MP2SyncState == ESyncState::GetData)
     {
-      _add_bit_to_mp2(MP2frame, iBits[i], MP2bitCount++);
+      // take all bits up to the end of the MP2 frame at once
+      const i16 numBits = std::min<i16>(amount - i, std::max<i16>(lf - MP2bitCount, 0));
+      _add_bits_to_mp2(iData.data(), i, numBits);
+      i += numBits;
 
       if (MP2bitCount >= lf)
       {
         i16 sample_buf[KJMP2_SAMPLES_PER_FRAME * 2];
 
-        _process_pad_data(iBits);  // only the last frame contains the PAD data
+        _process_pad_data(iData);  // only the last frame contains the PAD data
         const i32 frameSize = _mp2_decode_frame(MP2frame, sample_buf);
 
         if (frameSize > 0)
@@ -715,7 +625,7 @@ void Mp2Processor::add_to_frame(const std::vector<u8> & iBits)
     else if (MP2SyncState == ESyncState::SearchingForSync)
     {
       //	apparently , we are not in sync yet
-      if (iBits[i] == 01)
+      if (extract_bit_from_byte_stream(iData.data(), i++) == 01)
       {
         if (++MP2headerCount == 12)
         {
@@ -734,7 +644,10 @@ void Mp2Processor::add_to_frame(const std::vector<u8> & iBits)
     }
     else if (MP2SyncState == ESyncState::GetSampleRate)
     {
-      _add_bit_to_mp2(MP2frame, iBits[i], MP2bitCount++);
+      const i16 numBits = std::min<i16>(amount - i, 24 - MP2bitCount);
+      _add_bits_to_mp2(iData.data(), i, numBits);
+      i += numBits;
+
       if (MP2bitCount == 24)
       {
         _set_sample_rate(_get_mp2_sample_rate(MP2frame));
@@ -762,3 +675,27 @@ void Mp2Processor::_add_bit_to_mp2(std::vector<u8> & ioV, u8 ib, i16 iNm)
   }
 }
 
+// appends iNumBits bits of the packed input (beginning with bit iBitOffset) to MP2frame, byte-wise as far as possible
+void Mp2Processor::_add_bits_to_mp2(const u8 * const ipData, i16 iBitOffset, i16 iNumBits)
+{
+  while (iNumBits > 0 && (MP2bitCount & 7) != 0)
+  {
+    _add_bit_to_mp2(MP2frame, extract_bit_from_byte_stream(ipData, iBitOffset++), MP2bitCount++);
+    iNumBits--;
+  }
+
+  while (iNumBits >= 8)
+  {
+    MP2frame[MP2bitCount >> 3] = extract_byte_from_byte_stream(ipData, iBitOffset);
+    MP2bitCount += 8;
+    iBitOffset += 8;
+    iNumBits -= 8;
+  }
+
+  while (iNumBits > 0)
+  {
+    _add_bit_to_mp2(MP2frame, extract_bit_from_byte_stream(ipData, iBitOffset++), MP2bitCount++);
+    iNumBits--;
+  }
+}
+
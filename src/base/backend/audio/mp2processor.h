@@ -52,18 +52,17 @@ struct SQuantizerSpec
   u8 cw_bits;
 };
 
-class DabRadio;
+class IDabObserver;
 
 class Mp2Processor : public QObject, public FrameProcessor
 {
 Q_OBJECT
 public:
-  Mp2Processor(DabRadio *, i16, RingBuffer<i16> *, RingBuffer<u8> *);
+  Mp2Processor(IDabObserver *, i16, RingBuffer<i16> *, RingBuffer<u8> *);
   ~Mp2Processor() override;
   void add_to_frame(const std::vector<u8> &) override;
 
 private:
-  DabRadio * myRadioInterface;
   i16 bitRate;
   PadHandler my_padhandler;
   RingBuffer<i16> * const audioBuffer;
@@ -71,12 +70,10 @@ private:
   i32 sampleRate;
   i16 V[2][1024];
   i16 Voffs;
-  i16 N[64][32];
   SQuantizerSpec * allocation[2][32];
   i32 scfsi[2][32];
   i32 scalefactor[2][32][3];
   i32 sample[2][32][3];
-  i32 U[512];
 
   i32 bit_window;
   i32 bits_in_window;
@@ -98,7 +95,8 @@ private:
   void _read_samples(SQuantizerSpec *, i32 iScalefactor, i32 * opSamples);
   i32 _get_bits(i32);
   void _add_bit_to_mp2(std::vector<u8> &, u8, i16);
-  void _process_pad_data(const std::vector<u8> & iBits);
+  void _add_bits_to_mp2(const u8 * ipData, i16 iBitOffset, i16 iNumBits);
+  void _process_pad_data(const std::vector<u8> & iData);
 
 signals:
   void signal_show_frameErrors(i32);
@@ -39,12 +39,10 @@
  ************************************************************************
  */
 #include "mp4processor.h"
-#include "dabradio.h"
-#include "audio_pipeline.h"
+#include "dab_observer_if.h"
 #include "pad_handler.h"
 #include "crc.h"
 #include "bit_writer.h"
-#include "setting_helper.h"
 #include <cstring>
 
 // #define SHOW_ERROR_STATISTICS
@@ -54,28 +52,26 @@
   *	the class proper processes input and extracts the aac frames
   *	that are processed by the "faadDecoder" class
   */
-Mp4Processor::Mp4Processor(DabRadio * iRI, const i16 iBitRate, RingBuffer<i16> * const iopAudioBuffer, RingBuffer<u8> * const iopFrameBuffer)
-  : mpRadioInterface(iRI)
-  , mPadhandler(iRI)
+Mp4Processor::Mp4Processor(IDabObserver * ipObserver, const i16 iBitRate, RingBuffer<i16> * const iopAudioBuffer, RingBuffer<u8> * const iopFrameBuffer)
+  : mPadhandler(ipObserver)
   , mBitRate(iBitRate)
   , mpFrameBuffer(iopFrameBuffer)  // input rate
   , mRsDims(iBitRate / 8)
-  , mRsDecoder(8, 0435, 0, 1, 10)
 {
-  connect(this, &Mp4Processor::signal_show_frame_errors, iRI, &DabRadio::slot_show_frame_errors);
-  connect(this, &Mp4Processor::signal_show_rs_errors, iRI, &DabRadio::slot_show_rs_errors);
-  connect(this, &Mp4Processor::signal_show_aac_errors, iRI, &DabRadio::slot_show_aac_errors);
-  connect(this, &Mp4Processor::signal_is_stereo, iRI, &DabRadio::slot_set_stereo);
-  if (iRI != nullptr && iRI->get_audio_pipeline() != nullptr)
+  if (ipObserver != nullptr)
   {
-    connect(this, &Mp4Processor::signal_new_aac_frame, iRI->get_audio_pipeline(), &AudioPipeline::slot_new_aac_mp2_frame);
+    connect(this, &Mp4Processor::signal_show_frame_errors, this, [ipObserver](i32 iErrors) { ipObserver->show_frame_errors(iErrors); }, Qt::DirectConnection);
+    connect(this, &Mp4Processor::signal_show_rs_errors, this, [ipObserver](i32 iErrors) { ipObserver->show_rs_errors(iErrors); }, Qt::DirectConnection);
+    connect(this, &Mp4Processor::signal_show_aac_errors, this, [ipObserver](i32 iErrors) { ipObserver->show_aac_errors(iErrors); }, Qt::DirectConnection);
+    connect(this, &Mp4Processor::signal_is_stereo, this, [ipObserver](bool iStereo) { ipObserver->set_stereo(iStereo); }, Qt::DirectConnection);
+    connect(this, &Mp4Processor::signal_new_aac_frame, this, [ipObserver]() { ipObserver->new_aac_mp2_frame(); }, Qt::DirectConnection);
+    connect(this, &Mp4Processor::signal_show_rs_corrections, this, [ipObserver](i32 iRsError, i32 iCrcError) { ipObserver->show_rs_corrections(iRsError, iCrcError); }, Qt::DirectConnection);
   }
-  connect(this, &Mp4Processor::signal_show_rs_corrections, iRI, &DabRadio::slot_show_rs_corrections);
 
 #ifdef  __WITH_FDK_AAC__
-  mpAacDecoder = std::make_unique<FdkAAC>(iRI, iopAudioBuffer);
+  mpAacDecoder = std::make_unique<FdkAAC>(ipObserver, iopAudioBuffer);
 #else
-  mpAacDecoder = std::make_unique<FaadDecoder>(iRI, iopAudioBuffer);
+  mpAacDecoder = std::make_unique<FaadDecoder>(ipObserver, iopAudioBuffer);
 #endif
 
   mSuperFrameSize = 110 * (iBitRate / 8);
@@ -89,26 +85,15 @@ Mp4Processor::Mp4Processor(DabRadio * iRI, const i16 iBitRate, RingBuffer<i16> *
   *	a DAB+ superframe consists of 5 consecutive DAB frames
   *	we add vector for vector to the superframe. Once we have
   *	5 lengths of "old" frames, we check.
-  *	Note that the packing in the entry vector is still one bit
-  *	per Byte, nbits is the number of Bits (i.e. containing bytes)
-  *	the function adds nbits bits, packed in bytes, to the frame.
+  *	The entry vector is already packed into bytes.
   */
 void Mp4Processor::add_to_frame(const std::vector<u8> & iV)
 {
-  const i16 numBits = 24 * mBitRate;
-  const i16 numBytes = numBits / 8;
+  const i16 numBytes = 24 * mBitRate / 8;
   i32 displayedErrors = mSumCorrections;
 
-  // convert input bit-stream in iV to a byte-stream in mFrameByteVec
-  for (i16 i = 0; i < numBytes; i++)
-  {
-    u8 temp = 0;
-    for (i16 j = 0; j < 8; j++)
-    {
-      temp = (temp << 1) | (iV[i * 8 + j] & 0x1);
-    }
-    mFrameByteVec[mBlockFillIndex * numBytes + i] = temp;
-  }
+  assert((i16)iV.size() == numBytes);
+  memcpy(&mFrameByteVec[mBlockFillIndex * numBytes], iV.data(), numBytes);
 
   mBlocksInBuffer++;
   mBlockFillIndex = (mBlockFillIndex + 1) % 5;
@@ -200,7 +185,7 @@ bool Mp4Processor::_process_reed_solomon_frame(const u8 * const ipFrameBytes, co
 
     std::array<u8, 110> rsOut;
 
-    const i16 ler = mRsDecoder.dec(rsIn.data(), rsOut.data(), 135);  // i7-6700K: ~28us
+    const i16 ler = mRsDecoder.dec(rsIn.data(), rsOut.data(), 135);  // ~1us without errors, ~3us with 5 errors (old ReedSolomon: ~15..27us)
 
     if (ler < 0)
     {
@@ -315,7 +300,7 @@ bool Mp4Processor::_process_super_frame(const u8 ipFrameBytes[], const i16 iBase
 
   // When concealment is switched off in the configuration, lost frames are left as gaps (the
   // audio buffer is not filled at all) - the former behaviour before packet-loss concealment.
-  const bool concealDropouts = Settings::Config::cbAudioConcealment.read().toBool();
+  const bool concealDropouts = sConcealDropouts.load(std::memory_order_relaxed);
 
   for (i16 auIdx = 0; auIdx < numAUs; ++auIdx)
   {
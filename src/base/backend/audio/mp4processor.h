@@ -35,9 +35,10 @@
 #include "dab_constants.h"
 #include "frame_processor.h"
 #include "firecode_checker.h"
-#include "reed_solomon.h"
+#include "reed_solomon_fast.h"
 #include "pad_handler.h"
 #include <QObject>
+#include <atomic>
 #include <vector>
 #include <memory>
 
@@ -49,24 +50,28 @@
 
 #endif
 
-class DabRadio;
+class IDabObserver;
 
 class Mp4Processor : public QObject, public FrameProcessor
 {
 Q_OBJECT
 public:
-  Mp4Processor(DabRadio *, i16, RingBuffer<i16> *, RingBuffer<u8> *);
+  Mp4Processor(IDabObserver *, i16, RingBuffer<i16> *, RingBuffer<u8> *);
   ~Mp4Processor() override = default;
 
   void add_to_frame(const std::vector<u8> &) override;
 
+  // when switched off, lost frames are left as gaps (the audio buffer is not filled at all)
+  static void set_concealment(bool iConcealDropouts) { sConcealDropouts.store(iConcealDropouts, std::memory_order_relaxed); }
+
 private:
-  DabRadio * const mpRadioInterface;
+  static inline std::atomic<bool> sConcealDropouts{true};
+
   PadHandler mPadhandler;
   i16 const mBitRate;
   RingBuffer<u8> * const mpFrameBuffer;
   const i16 mRsDims;
-  ReedSolomon mRsDecoder;
+  ReedSolomonFast mRsDecoder;
 
   i16 mSuperFrameSize;
   i16 mBlockFillIndex = 0;
@@ -29,22 +29,34 @@
  *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 #include "dab_constants.h"
-#include "dabradio.h"
 #include "backend.h"
+#include <chrono>
+#ifndef _WIN32
+  #include <ctime>
+#endif
 
-// Interleaving is - for reasons of simplicity - done inline rather than through a special class-object
 constexpr i16 cCuSizeBits = 64;
 
+// CPU time of the calling thread, so time slices where a worker was preempted are not accounted to the backend
+static u64 thread_cpu_time_ns()
+{
+#ifdef _WIN32
+  return (u64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); // wall clock as fallback
+#else
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (u64)ts.tv_sec * 1'000'000'000ULL + (u64)ts.tv_nsec;
+#endif
+}
+
 //	fragmentsize == Length * CUSize
-Backend::Backend(DabRadio * ipRI, const SDescriptorType * ipDescType, RingBuffer<i16> * ipoAudiobuffer, RingBuffer<u8> * ipoDatabuffer, RingBuffer<u8> * frameBuffer, EProcessFlag iProcessFlag)
+Backend::Backend(IDabObserver * ipObserver, const SDescriptorType * ipDescType, RingBuffer<i16> * ipoAudiobuffer, RingBuffer<u8> * ipoDatabuffer, RingBuffer<u8> * frameBuffer, EProcessFlag iProcessFlag,
+                 RingBuffer<u8> * ipoMscDataGroupBuffer)
   : deconvolver(ipDescType)
-  , outV(ipDescType->bitRate /*kbit/s*/ * 24 /*ms*/)
-  , driver(ipRI, ipDescType, ipoAudiobuffer, ipoDatabuffer, frameBuffer)
-#ifdef  __THREADED_BACKEND__
-  , freeSlots(NUMBER_SLOTS)
-#endif
+  , outV(ipDescType->bitRate /*kbit/s*/ * 24 /*ms*/ / 8) // packed bits
+  , driver(ipObserver, ipDescType, ipoAudiobuffer, ipoDatabuffer, frameBuffer, ipoMscDataGroupBuffer)
+  , deInterleaver(ipDescType->CuSize * cCuSizeBits)
 {
-  this->radioInterface = ipRI;
   this->CuStartAddr = ipDescType->CuStartAddr;
   this->CuSize = ipDescType->CuSize;
   this->fragmentSize = ipDescType->CuSize * cCuSizeBits;
@@ -57,20 +69,13 @@ Backend::Backend(DabRadio * ipRI, const SDescriptorType * ipDescType, RingBuffer
   this->processFlag = iProcessFlag;
 
   //fprintf(stdout, "starting a backend for %s (%X) %d\n", serviceName.toUtf8().data(), serviceId, startAddr);
-  interleaveData.resize(16);
-  for (i32 i = 0; i < 16; i++)
-  {
-    interleaveData[i].resize(fragmentSize);
-    memset(interleaveData[i].data(), 0, fragmentSize * sizeof(i16));
-  }
-
   countforInterleaver = 0;
-  interleaverIndex = 0;
 
   tempX.resize(fragmentSize);
 
+  // the PRBS of the energy dispersal is packed like the Viterbi output (MSB first)
   u8 shiftRegister[9];
-  disperseVector.resize(24 * bitRate);
+  disperseVector.resize(24 * bitRate / 8, 0);
   memset(shiftRegister, 1, 9);
   for (i32 i = 0; i < bitRate * 24; i++)
   {
@@ -80,67 +85,66 @@ Backend::Backend(DabRadio * ipRI, const SDescriptorType * ipDescType, RingBuffer
       shiftRegister[j] = shiftRegister[j - 1];
     }
     shiftRegister[0] = b;
-    disperseVector[i] = b;
+    disperseVector[i >> 3] |= b << (7 - (i & 7));
   }
-#ifdef  __THREADED_BACKEND__
-  //	for local buffering the input, we have
-  nextIn = 0;
-  nextOut = 0;
-  for (i = 0; i < NUMBER_SLOTS; i++)
-  {
-    theData[i].resize(fragmentSize);
-  }
-  running.store(true);
-  start();
-#endif
 }
 
 Backend::~Backend()
 {
-#ifdef  __THREADED_BACKEND__
-  running.store(false);
-  while (this->isRunning())
+  stop_running();
+}
+
+i32 Backend::push_segment(const TCifBufferPtr & ipCif, const i16 * const ipV)
+{
+  // only the consumer decreases pendingSlots, so a free slot stays free until it is filled here
+  if (!running.load())
   {
-    usleep(1000);
+    return -1;
   }
-#endif
+  if (pendingSlots.load(std::memory_order_acquire) >= NUMBER_SLOTS)
+  {
+    segmentsDropped.fetch_add(1, std::memory_order_relaxed);
+    return -1;
+  }
+  theData[nextIn].pCif = ipCif;
+  theData[nextIn].pData = ipV;
+  nextIn = (nextIn + 1) % NUMBER_SLOTS;
+  return pendingSlots.fetch_add(1, std::memory_order_acq_rel);
 }
 
-i32 Backend::process(const i16 * const iV, const i32 cnt)
+bool Backend::process_pending_segment()
 {
-  (void)cnt;
-#ifdef  __THREADED_BACKEND__
-  while (!freeSlots.tryAcquire(1, 200))
+  if (running.load())
   {
-    if (!running)
+    const u64 timeBegin = thread_cpu_time_ns();
+    _process_segment(theData[nextOut].pData);
+    const u64 duration = thread_cpu_time_ns() - timeBegin;
+
+    // only this (strand) worker writes, so no CAS loop is needed for the maximum
+    cpuTimeNs.fetch_add(duration, std::memory_order_relaxed);
+    if (duration > cpuTimeMaxNs.load(std::memory_order_relaxed))
     {
-      return 0;
+      cpuTimeMaxNs.store(duration, std::memory_order_relaxed);
     }
+    segmentsDone.fetch_add(1, std::memory_order_relaxed);
   }
-  memcpy(theData[nextIn].data(), iV, fragmentSize * sizeof(i16));
-  nextIn = (nextIn + 1) % NUMBER_SLOTS;
-  usedSlots.release(1);
-#else
-  _process_segment(iV);
-#endif
-  return 1;
-}
-
-static constexpr i16 interleaveMap[] = {0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15};
+  theData[nextOut].pCif.reset(); // release the CIF before the slot is given back
+  nextOut = (nextOut + 1) % NUMBER_SLOTS;
 
-void Backend::_process_segment(const i16 * iData)
-{
-  for (i16 i = 0; i < fragmentSize; i++)
+  // The slot is given back under the lock, so stop_running() cannot miss the notification. Releasing the lock has to be
+  // the last access to this instance if no more segments are pending, stop_running() may delete it right after that.
+  std::lock_guard<std::mutex> lock(drainMutex);
+  const bool morePending = pendingSlots.fetch_sub(1, std::memory_order_acq_rel) > 1;
+  if (!morePending)
   {
-    tempX[i] = interleaveData[(interleaverIndex + interleaveMap[i & 0x0F]) & 0x0F][i];
-    interleaveData[interleaverIndex][i] = iData[i];
+    drainCv.notify_all();
   }
+  return morePending;
+}
 
-  interleaverIndex = (interleaverIndex + 1) & 0x0F;
-#ifdef  __THREADED_BACKEND__
-  nextOut = (nextOut + 1) % NUMBER_SLOTS;
-  freeSlots.release(1);
-#endif
+void Backend::_process_segment(const i16 * iData)
+{
+  deInterleaver.process(iData, tempX.data());
 
   // only continue when de-interleaver is filled
   if (countforInterleaver <= 15)
@@ -149,45 +153,26 @@ void Backend::_process_segment(const i16 * iData)
     return;
   }
 
-  deconvolver.deconvolve(tempX.data(), fragmentSize, outV.data());
-
-  // Reverse the energy dispersal
-  for (i16 i = 0; i < bitRate * 24; i++)
-  {
-    outV[i] ^= disperseVector[i];
-  }
+  // the energy dispersal is reversed while the Viterbi chainback writes the packed bytes
+  deconvolver.deconvolve(tempX.data(), fragmentSize, outV.data(), disperseVector.data());
 
   driver.add_to_frame(outV);
 }
 
-#ifdef  __THREADED_BACKEND__
-
-void Backend::run()
+Backend::SCpuLoad Backend::get_cpu_load()
 {
-  while (running.load())
-  {
-    while (!usedSlots.tryAcquire(1, 200))
-    {
-      if (!running)
-      {
-        return;
-      }
-    }
-    _process_segment(theData[nextOut].data());
-  }
+  SCpuLoad l;
+  l.segmentsDone = segmentsDone.load(std::memory_order_relaxed);
+  l.segmentsDropped = segmentsDropped.load(std::memory_order_relaxed);
+  l.cpuTimeNs = cpuTimeNs.load(std::memory_order_relaxed);
+  l.cpuTimeMaxNs = cpuTimeMaxNs.exchange(0, std::memory_order_relaxed);
+  return l;
 }
 
-#endif
-
-//	It might take a msec for the task to stop
+//	It might take a msec for the pending segments to be discarded by the decode pool, the last worker signals this
 void Backend::stop_running()
 {
-#ifdef  __THREADED_BACKEND__
-  running = false;
-  while (this->isRunning())
-  {
-    usleep(1);
-  }
-  //	myAudioSink	-> stop();
-#endif
+  running.store(false);
+  std::unique_lock<std::mutex> lock(drainMutex);
+  drainCv.wait(lock, [this] { return pendingSlots.load(std::memory_order_acquire) == 0; });
 }
@@ -33,32 +33,44 @@
 #include "ringbuffer.h"
 #include "backend_driver.h"
 #include "backend_deconvolver.h"
+#include "cif_buffer_ring.h"
+#include "time_deinterleaver.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
-#ifdef  __THREADED_BACKEND__
-  #include <QSemaphore>
-  #include <QThread>
-  #include <atomic>
-#endif
 
 #define  NUMBER_SLOTS  25
 
-class DabRadio;
-
-#ifdef  __THREADED_BACKEND__
-class Backend : public QThread
-{
-#else
+class IDabObserver;
 
+// The CIF fragments are decoded in the worker threads of the CifDecodePool.
+// The slots decouple the OFDM thread (producer) from the worker currently handling this backend (consumer).
 class Backend
 {
-#endif
-
 public:
-  Backend(DabRadio * ipRI, const SDescriptorType * ipDescType, RingBuffer<i16> * ipoAudiobuffer, RingBuffer<u8> * ipoDatabuffer, RingBuffer<u8> * frameBuffer, EProcessFlag iProcessFlag);
+  // decoding effort of this backend, measured as CPU time of the worker threads while processing its segments
+  struct SCpuLoad
+  {
+    u64 segmentsDone;     // overall
+    u64 segmentsDropped;  // overall, the input slots were full (the decode pool does not keep up)
+    u64 cpuTimeNs;        // overall
+    u64 cpuTimeMaxNs;     // maximum for one segment since last call of get_cpu_load()
+  };
+
+  Backend(IDabObserver * ipObserver, const SDescriptorType * ipDescType, RingBuffer<i16> * ipoAudiobuffer, RingBuffer<u8> * ipoDatabuffer, RingBuffer<u8> * frameBuffer, EProcessFlag iProcessFlag,
+          RingBuffer<u8> * ipoMscDataGroupBuffer = nullptr);
   ~Backend();
 
-  i32 process(const i16 * iV, i32 cnt);
+  // called from the OFDM thread, returns the number of segments pending before or -1 if the segment could not be taken,
+  // ipV points to the fragment of this sub-channel within ipCif, it is not copied but read in place
+  i32 push_segment(const TCifBufferPtr & ipCif, const i16 * ipV);
+  // called from a CifDecodePool worker, returns true if there are further segments pending
+  bool process_pending_segment();
   void stop_running();
+  // the maximum value is reset with each call
+  SCpuLoad get_cpu_load();
 
   // we need sometimes to access the key parameters for decoding
   u32 serviceId;
@@ -73,24 +85,30 @@ public:
 
 private:
   BackendDeconvolver deconvolver;
-  std::vector<u8> outV;
+  std::vector<u8> outV; // packed bits (MSB first)
   BackendDriver driver;
-#ifdef  __THREADED_BACKEND__
-  void run();
-  std::atomic<bool> running;
-  QSemaphore freeSlots;
-  QSemaphore usedSlots;
-  std::vector<i16> theData[NUMBER_SLOTS];
-  i16 nextIn;
-  i16 nextOut;
-#endif
+  std::atomic<bool> running{true};
+  std::atomic<i32> pendingSlots{0};
+  std::mutex drainMutex;              // the last pending slot is given back under this lock ...
+  std::condition_variable drainCv;    // ... and signalled, stop_running() waits for it
+  struct SSegment
+  {
+    TCifBufferPtr pCif;            // keeps the CIF alive until the segment is processed
+    const i16 * pData = nullptr;   // fragment of this sub-channel within the CIF
+  };
+  std::array<SSegment, NUMBER_SLOTS> theData;
+  i16 nextIn = 0;
+  i16 nextOut = 0;
+  std::atomic<u64> segmentsDone{0};
+  std::atomic<u64> segmentsDropped{0};
+  std::atomic<u64> cpuTimeNs{0};
+  std::atomic<u64> cpuTimeMaxNs{0};
+
   void _process_segment(const i16 * iData);
-  DabRadio * radioInterface;
 
   i16 fragmentSize;
-  std::vector<std::vector<i16>> interleaveData;
+  TimeDeInterleaver deInterleaver;
   std::vector<i16> tempX;
   i16 countforInterleaver;
-  i16 interleaverIndex;
   std::vector<u8> disperseVector;
 };
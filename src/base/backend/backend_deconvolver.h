@@ -40,7 +40,7 @@ public:
   explicit BackendDeconvolver(const SDescriptorType * d);
   ~BackendDeconvolver();
 
-  void deconvolve(const i16 * rawBits_in, i32 length, u8 * outData) const;
+  void deconvolve(const i16 * rawBits_in, i32 length, u8 * outData, const u8 * ipXorMask = nullptr) const;
   
 private:
   std::unique_ptr<Protection> mpProtectionHandler;
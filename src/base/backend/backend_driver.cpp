@@ -35,22 +35,23 @@
 
 // Driver program for the selected backend. Embodying that in a separate class simplifies the "Backend" class.
 
-BackendDriver::BackendDriver(DabRadio * ipDR, const SDescriptorType * ipDT, RingBuffer<i16> * const ipAudioBuffer, RingBuffer<u8> * const ipDataBuffer, RingBuffer<u8> * const ipFrameBuffer)
+BackendDriver::BackendDriver(IDabObserver * ipObserver, const SDescriptorType * ipDT, RingBuffer<i16> * const ipAudioBuffer, RingBuffer<u8> * const ipDataBuffer, RingBuffer<u8> * const ipFrameBuffer,
+                             RingBuffer<u8> * const ipMscDataGroupBuffer)
 {
   if (ipDT->TMId == ETMId::StreamModeAudio)
   {
     if (((SAudioData *)ipDT)->ASCTy != 077)
     {
-      mpFrameProcessor = std::make_unique<Mp2Processor>(ipDR, ipDT->bitRate, ipAudioBuffer, ipFrameBuffer);
+      mpFrameProcessor = std::make_unique<Mp2Processor>(ipObserver, ipDT->bitRate, ipAudioBuffer, ipFrameBuffer);
     }
     else // if (((AudioData *)d)->ASCTy == 077)
     {
-      mpFrameProcessor = std::make_unique<Mp4Processor>(ipDR, ipDT->bitRate, ipAudioBuffer, ipFrameBuffer);
+      mpFrameProcessor = std::make_unique<Mp4Processor>(ipObserver, ipDT->bitRate, ipAudioBuffer, ipFrameBuffer);
     }
   }
   else if (ipDT->TMId == ETMId::PacketModeData)
   {
-    mpFrameProcessor = std::make_unique<DataProcessor>(ipDR, static_cast<const SPacketData *>(ipDT), ipDataBuffer);
+    mpFrameProcessor = std::make_unique<DataProcessor>(ipObserver, static_cast<const SPacketData *>(ipDT), ipDataBuffer, ipMscDataGroupBuffer);
   }
   else
   {
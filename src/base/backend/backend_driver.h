@@ -36,12 +36,13 @@
 #include <vector>
 #include <memory>
 
-class DabRadio;
+class IDabObserver;
 
 class BackendDriver
 {
 public:
-  BackendDriver(DabRadio * ipDR, const SDescriptorType * ipDT, RingBuffer<i16> * ipAudioBuffer, RingBuffer<u8> * ipDataBuffer, RingBuffer<u8> * ipFrameBuffer);
+  BackendDriver(IDabObserver * ipObserver, const SDescriptorType * ipDT, RingBuffer<i16> * ipAudioBuffer, RingBuffer<u8> * ipDataBuffer, RingBuffer<u8> * ipFrameBuffer,
+                RingBuffer<u8> * ipMscDataGroupBuffer = nullptr);
   ~BackendDriver() = default;
 
   void add_to_frame(const std::vector<u8> & outData) const;
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "glob_data_types.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Soft bits of one complete CIF. After it is filled by the OFDM thread it is shared (immutable) with all backends,
+// each backend keeps a reference per pending segment and reads its sub-channel fragment in place.
+using TCifBuffer = std::vector<i16>;
+using TCifBufferPtr = std::shared_ptr<const TCifBuffer>;
+
+// Ring of reference-counted CIF buffers, only used by the OFDM thread. A buffer is reused when the last backend
+// has released it. The next released buffer behind the current one is taken, so buffers still referenced by a
+// lagging backend are skipped. Only if all buffers are referenced the ring grows by a new buffer, which stays in the
+// ring afterwards. So the ring adapts to the largest number of buffers concurrently held by the backends and the
+// OFDM thread does not allocate anymore once this is reached.
+class CifBufferRing
+{
+public:
+  CifBufferRing(const i32 iNumBuffers, const i32 iCifSize)
+    : mCifSize(iCifSize)
+  {
+    for (i32 i = 0; i < iNumBuffers; i++)
+    {
+      mBuffers.emplace_back(std::make_shared<TCifBuffer>(iCifSize));
+    }
+  }
+
+  // selects the next released buffer of the ring and returns its data for writing the new CIF
+  i16 * next_cif()
+  {
+    for (size_t n = 1; n <= mBuffers.size(); n++)
+    {
+      const size_t idx = (mIdx + n) % mBuffers.size();
+
+      if (mBuffers[idx].use_count() == 1)
+      {
+        std::atomic_thread_fence(std::memory_order_acquire); // the last reader has finished before releasing the buffer
+        mIdx = idx;
+        return mBuffers[mIdx]->data();
+      }
+    }
+
+    mIdx = mBuffers.size();
+    mBuffers.emplace_back(std::make_shared<TCifBuffer>(mCifSize));
+    return mBuffers[mIdx]->data();
+  }
+
+  // the buffer last returned by next_cif(), for handing it over to the backends after it is filled
+  [[nodiscard]] TCifBufferPtr current_cif() const { return mBuffers[mIdx]; }
+
+  [[nodiscard]] size_t get_num_buffers() const { return mBuffers.size(); }
+
+private:
+  const i32 mCifSize;
+  std::vector<std::shared_ptr<TCifBuffer>> mBuffers;
+  size_t mIdx = 0;
+};
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "cif_decode_pool.h"
+#include "backend.h"
+#include <chrono>
+#include <QDebug>
+
+CifDecodePool::CifDecodePool(i32 iNumWorkers)
+{
+  if (iNumWorkers <= 0)
+  {
+    iNumWorkers = (i32)std::thread::hardware_concurrency();
+    if (iNumWorkers <= 0) iNumWorkers = 1; // hardware_concurrency() may return 0 if unknown
+  }
+
+  qInfo() << "Start CIF decode pool with" << iNumWorkers << "worker threads";
+
+  for (i32 i = 0; i < iNumWorkers; i++)
+  {
+    mQueues.emplace_back(std::make_unique<SWorkerQueue>());
+  }
+
+  for (i32 i = 0; i < iNumWorkers; i++)
+  {
+    mWorkers.emplace_back(&CifDecodePool::_run_worker, this, (u32)i);
+  }
+}
+
+CifDecodePool::~CifDecodePool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mSleepMutex);
+    mRunning.store(false);
+  }
+  mSleepCv.notify_all();
+
+  for (auto & w : mWorkers)
+  {
+    w.join();
+  }
+}
+
+void CifDecodePool::post_segment(Backend * const ipBackend, const TCifBufferPtr & ipCif, const i16 * const ipV)
+{
+  const i32 pendingCnt = ipBackend->push_segment(ipCif, ipV);
+
+  if (pendingCnt < 0) // backend is not able to take the segment (its slots are full or it is stopping)
+  {
+    ++mSegmentsDropped;
+    return;
+  }
+
+  const i32 queueDepth = ++mQueueDepth;
+  if (queueDepth > mQueueDepthMax.load(std::memory_order_relaxed))
+  {
+    mQueueDepthMax.store(queueDepth, std::memory_order_relaxed);
+  }
+
+  // if there were already pending segments the backend is still scheduled (or in work) and will not be scheduled twice
+  if (pendingCnt == 0)
+  {
+    _schedule(ipBackend, mNextQueueIdx++ % (u32)mQueues.size());
+  }
+}
+
+CifDecodePool::SStatistics CifDecodePool::get_statistics()
+{
+  SStatistics s;
+  s.numWorkers = (i32)mWorkers.size();
+  s.queueDepth = mQueueDepth.load();
+  s.queueDepthMax = mQueueDepthMax.exchange(s.queueDepth);
+  s.jobsDone = mJobsDone.load();
+  s.segmentsDropped = mSegmentsDropped.load();
+
+  std::lock_guard<std::mutex> lock(mStatMutex);
+  s.jobLatencyAvrUs = (mLatencyCnt > 0 ? (f32)mLatencySumNs / (f32)mLatencyCnt / 1000.0f : 0.0f);
+  s.jobLatencyMaxUs = (f32)mLatencyMaxNs / 1000.0f;
+  mLatencySumNs = mLatencyMaxNs = mLatencyCnt = 0;
+  return s;
+}
+
+void CifDecodePool::_schedule(Backend * const ipBackend, const u32 iQueueIdx)
+{
+  {
+    std::lock_guard<std::mutex> lock(mQueues[iQueueIdx]->mutex);
+    mQueues[iQueueIdx]->queue.push_back(ipBackend);
+  }
+  ++mScheduledCnt;
+
+  // take the sleep mutex shortly, so no worker can miss the notification between checking its predicate and sleeping
+  {
+    std::lock_guard<std::mutex> lock(mSleepMutex);
+  }
+  mSleepCv.notify_one();
+}
+
+Backend * CifDecodePool::_fetch(const u32 iOwnQueueIdx)
+{
+  const u32 numQueues = (u32)mQueues.size();
+
+  for (u32 i = 0; i < numQueues; i++)
+  {
+    SWorkerQueue & wq = *mQueues[(iOwnQueueIdx + i) % numQueues];
+    std::lock_guard<std::mutex> lock(wq.mutex);
+
+    if (!wq.queue.empty())
+    {
+      Backend * b;
+      if (i == 0) // take the oldest entry from the own queue ...
+      {
+        b = wq.queue.front();
+        wq.queue.pop_front();
+      }
+      else // ... or steal the newest one from another queue
+      {
+        b = wq.queue.back();
+        wq.queue.pop_back();
+      }
+      --mScheduledCnt;
+      return b;
+    }
+  }
+  return nullptr;
+}
+
+void CifDecodePool::_run_worker(const u32 iQueueIdx)
+{
+  while (mRunning.load())
+  {
+    Backend * const b = _fetch(iQueueIdx);
+
+    if (b == nullptr)
+    {
+      std::unique_lock<std::mutex> lock(mSleepMutex);
+      mSleepCv.wait(lock, [this] { return mScheduledCnt.load() > 0 || !mRunning.load(); });
+      continue;
+    }
+
+    const auto timeBegin = std::chrono::steady_clock::now();
+    // Attention: the backend must not be accessed anymore if there are no pending segments left as it may be deleted
+    const bool morePending = b->process_pending_segment();
+    const auto timeEnd = std::chrono::steady_clock::now();
+
+    --mQueueDepth;
+    ++mJobsDone;
+    {
+      const u64 durationNs = (u64)std::chrono::duration_cast<std::chrono::nanoseconds>(timeEnd - timeBegin).count();
+      std::lock_guard<std::mutex> lock(mStatMutex);
+      mLatencySumNs += durationNs;
+      if (durationNs > mLatencyMaxNs) mLatencyMaxNs = durationNs;
+      ++mLatencyCnt;
+    }
+
+    // reschedule at the end of the own queue, so other sub-channels are served in between
+    if (morePending)
+    {
+      _schedule(b, iQueueIdx);
+    }
+  }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "glob_data_types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "cif_buffer_ring.h"
+
+class Backend;
+
+// Fixed pool of worker threads (sized to the core count) which decodes the CIF fragments of all running backends.
+// Each backend is handled like a "strand": only one worker processes a certain backend at a time, so the segments of
+// one sub-channel are processed strictly in order, while different sub-channels are processed concurrently.
+// Each worker owns its own queue; an idle worker steals pending backends from the other queues.
+class CifDecodePool
+{
+public:
+  struct SStatistics
+  {
+    i32 numWorkers;
+    i32 queueDepth;       // CIF fragments queued but not processed yet (over all backends)
+    i32 queueDepthMax;    // since last call of get_statistics()
+    f32 jobLatencyAvrUs;  // average time to process one fragment (since last call of get_statistics())
+    f32 jobLatencyMaxUs;  // maximum time to process one fragment (since last call of get_statistics())
+    u64 jobsDone;         // overall
+    u64 segmentsDropped;  // overall, fragments dropped as the backend input slots were full
+  };
+
+  explicit CifDecodePool(i32 iNumWorkers = 0); // iNumWorkers <= 0 means the number of cores
+  ~CifDecodePool();
+
+  // Called from the OFDM thread for each new CIF fragment of a backend. The backend keeps a reference to the CIF
+  // and reads the fragment (ipV within ipCif) in place.
+  void post_segment(Backend * ipBackend, const TCifBufferPtr & ipCif, const i16 * ipV);
+
+  // Retrieves the statistics, the min/max/average values are reset with each call.
+  SStatistics get_statistics();
+
+private:
+  struct SWorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<Backend *> queue;
+  };
+
+  std::vector<std::thread> mWorkers;
+  std::vector<std::unique_ptr<SWorkerQueue>> mQueues;
+  std::atomic<bool> mRunning{true};
+  std::atomic<i32> mScheduledCnt{0};  // number of backends in all queues
+  std::atomic<u32> mNextQueueIdx{0};
+  std::mutex mSleepMutex;
+  std::condition_variable mSleepCv;
+
+  // statistics
+  std::atomic<i32> mQueueDepth{0};
+  std::atomic<i32> mQueueDepthMax{0};
+  std::atomic<u64> mJobsDone{0};
+  std::atomic<u64> mSegmentsDropped{0};
+  std::mutex mStatMutex;
+  u64 mLatencySumNs = 0;
+  u64 mLatencyMaxNs = 0;
+  u64 mLatencyCnt = 0;
+
+  void _schedule(Backend * ipBackend, u32 iQueueIdx);
+  Backend * _fetch(u32 iOwnQueueIdx);
+  void _run_worker(u32 iQueueIdx);
+};
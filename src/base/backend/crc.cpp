@@ -33,11 +33,12 @@
 //	within the DAB/DAB+ sdr-j receiver software
 //	all rights are acknowledged.
 //
-#include <cstring>
+#include <cassert>
+#include <array>
 #include "crc.h"
 
 // g(x)=x^16+x^12+x^5+1 (ITU-T Recommendation X.25).
-static u16 const crctab_1021[256] = {
+static constexpr u16 crctab_1021[256] = {
   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
   0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
   0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
@@ -72,14 +73,51 @@ static u16 const crctab_1021[256] = {
   0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0x0ed1, 0x1ef0
 };
 
+// Tables for "slicing-by-8": crcTabSlice[k][b] is the CRC contribution of byte b followed by k zero bytes
+using TCrcSliceTables = std::array<std::array<u16, 256>, 8>;
+
+static constexpr TCrcSliceTables make_crc_slice_tables()
+{
+  TCrcSliceTables t{};
+
+  for (i32 i = 0; i < 256; i++)
+  {
+    t[0][i] = crctab_1021[i];
+  }
+  for (i32 k = 1; k < 8; k++)
+  {
+    for (i32 i = 0; i < 256; i++)
+    {
+      t[k][i] = (u16)((t[k - 1][i] << 8) ^ crctab_1021[t[k - 1][i] >> 8]);
+    }
+  }
+  return t;
+}
+
+static constexpr TCrcSliceTables crcTabSlice = make_crc_slice_tables();
+
+static inline u16 crc_update_byte(const u16 iCrc, const u8 iByte)
+{
+  return (u16)(crctab_1021[(iByte ^ (iCrc >> 8)) & 0xff] ^ (iCrc << 8));
+}
+
 u16 calc_crc(const u8 * const data, const i32 length)
 {
   u16 crc = 0xffff;
+  i32 i = 0;
+
+  // 8 bytes per step, the current CRC is merged into the first two bytes
+  for (; i + 8 <= length; i += 8)
+  {
+    const u8 * const d = data + i;
+    crc = crcTabSlice[7][d[0] ^ (crc >> 8)] ^ crcTabSlice[6][d[1] ^ (crc & 0xff)] ^
+          crcTabSlice[5][d[2]] ^ crcTabSlice[4][d[3]] ^ crcTabSlice[3][d[4]] ^
+          crcTabSlice[2][d[5]] ^ crcTabSlice[1][d[6]] ^ crcTabSlice[0][d[7]];
+  }
 
-  for (int i = 0; i < length; i++)
+  for (; i < length; i++)
   {
-    u32 pos = (data[i] ^ (crc >> 8)) & 0xff;
-    crc = crctab_1021[pos] ^ (crc << 8);
+    crc = crc_update_byte(crc, data[i]);
   }
 
   return ~crc;
@@ -95,38 +133,31 @@ bool check_crc_bytes(const u8 * const msg, const i32 len)
   return (crc ^ accumulator) == 0;
 }
 
+// The input holds one bit per byte (only the LSB is used), the last 16 bits are the inverted CRC.
+// The bits are gathered to bytes on the fly and processed byte-wise with the table, so iSize has to be a multiple of 8.
 bool check_CRC_bits(const u8 * const iIn, const i32 iSize)
 {
-  static const u8 crcPolynome[] = { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 };  // MSB .. LSB
-  i32 f;
-  u8 b[16];
-  int16_t Sum = 0;
-
-  memset(b, 1, 16);
+  assert(iSize % 8 == 0 && iSize >= 16);
+  u16 crc = 0xffff;
+  u16 crcRx = 0;
 
-  for (int i = 0; i < iSize; i++)
+  for (i32 i = 0; i < iSize; i += 8)
   {
-    const u8 invBit = (i >= iSize - 16 ? 1 : 0);
+    u8 byte = 0;
+    for (i32 j = 0; j < 8; j++)
+    {
+      byte = (u8)((byte << 1) | (iIn[i + j] & 0x1));
+    }
 
-    if ((b[0] ^ (iIn[i] ^ invBit)) == 1)
+    if (i < iSize - 16)
     {
-      for (f = 0; f < 15; f++)
-      {
-        b[f] = crcPolynome[f] ^ b[f + 1];
-      }
-      b[15] = 1;
+      crc = crc_update_byte(crc, byte);
     }
     else
     {
-      memmove(&b[0], &b[1], sizeof(u8) * 15); // Shift
-      b[15] = 0;
+      crcRx = (u16)((crcRx << 8) | byte);
     }
   }
 
-  for (int i = 0; i < 16; i++)
-  {
-    Sum += b[i];
-  }
-
-  return Sum == 0;
+  return (u16)~crc == crcRx;
 }
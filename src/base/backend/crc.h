@@ -40,5 +40,6 @@
 
 u16 calc_crc(const u8 * const data, const i32 length);
 bool check_crc_bytes(const u8 * const msg, const i32 len);
+// for one bit per byte input (FIB), iSize (in bits, incl. CRC) has to be a multiple of 8
 bool check_CRC_bits(const u8 * const iIn, const i32 iSize);
 
@@ -28,7 +28,6 @@
  *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 #include "dab_constants.h"
-#include "dabradio.h"
 #include "data_processor.h"
 #include "virtual_datahandler.h"
 #include "ip_datahandler.h"
@@ -39,9 +38,8 @@
 #include "crc.h"
 
 // The main function of this class is to assemble the MSCdatagroups and dispatch to the appropriate handler
-DataProcessor::DataProcessor(DabRadio * ipDR, const SPacketData * const ipPD, RingBuffer<u8> * const ipDataBuffer)
-  : mpDabRadio(ipDR)
-  , mBitRate(ipPD->bitRate)
+DataProcessor::DataProcessor(IDabObserver * ipObserver, const SPacketData * const ipPD, RingBuffer<u8> * const ipDataBuffer, RingBuffer<u8> * const ipMscDataGroupBuffer)
+  : mBitRate(ipPD->bitRate)
   , mDSCTy(ipPD->DSCTy)
   , mAppType(ipPD->appTypeVec[0]) // TODO: only first element
   , mPacketAddress(ipPD->PacketAddress)
@@ -49,6 +47,7 @@ DataProcessor::DataProcessor(DabRadio * ipDR, const SPacketData * const ipPD, Ri
   , mFEC_scheme(ipPD->FEC_scheme)
   , mSubChannel(ipPD->SubChId)
   , mpDataBuffer(ipDataBuffer)
+  , mpMscDataGroupBuffer(ipMscDataGroupBuffer)
 {
   switch (mDSCTy)
   {
@@ -56,20 +55,20 @@ DataProcessor::DataProcessor(DabRadio * ipDR, const SPacketData * const ipPD, Ri
     if (mAppType == 0x44a)
     {
       qInfo() << "Create Journaline (DSCTy 5, AppType 0x44a) data handler";
-      mpDataHandler.reset(new JournalineDataHandler(ipDR, mSubChannel));
+      mpDataHandler.reset(new JournalineDataHandler(ipObserver, mSubChannel));
       break;
     }
     else if (mAppType == 1500)
     {
       qInfo() << "Create ADV (DSCTy 5, AppType 1500) data handler (not implemented)";
-      //my_dataHandler = new adv_dataHandler(ipDR, dataBuffer, appType);
+      //my_dataHandler = new adv_dataHandler(ipObserver, dataBuffer, appType);
       mpDataHandler.reset(new VirtualDataHandler);
       break;
     }
     else if (mAppType == 4)
     {
       qInfo() << "Create TDC (DSCTy 5, AppType 4) data handler";
-      mpDataHandler.reset(new tdc_dataHandler(ipDR, mpDataBuffer, mAppType));
+      mpDataHandler.reset(new tdc_dataHandler(ipObserver, mpDataBuffer, mAppType));
       break;
     }
     else
@@ -81,17 +80,17 @@ DataProcessor::DataProcessor(DabRadio * ipDR, const SPacketData * const ipPD, Ri
 
   case 44:
     qInfo() << "Create Journaline (DSCTy 44) data handler";
-    mpDataHandler.reset(new JournalineDataHandler(ipDR, mSubChannel));
+    mpDataHandler.reset(new JournalineDataHandler(ipObserver, mSubChannel));
     break;
 
   case 59:
     qInfo() << "Create IP (DSCTy 59) data handler";
-    mpDataHandler.reset(new IpDataHandler(ipDR, mpDataBuffer));
+    mpDataHandler.reset(new IpDataHandler(ipObserver, mpDataBuffer));
     break;
 
   case 60:
     qInfo() << "Create MOT (DSCTy 60) data handler";
-    mpDataHandler.reset(new MotHandler(ipDR));
+    mpDataHandler.reset(new MotHandler(ipObserver));
     break;
 
   default:
@@ -110,42 +109,39 @@ void DataProcessor::add_to_frame(const std::vector<u8> & outV)
 
   if ((this->mDSCTy == 5) && (this->mDGflag))
   {  // no datagroups
-    _handle_TDC_async_stream(outV.data(), 24 * mBitRate);
+    _handle_TDC_async_stream(outV.data(), 24 * mBitRate / 8);
   }
   else
   {
-    _handle_packets(outV.data(), 24 * mBitRate);
+    _handle_packets(outV.data(), 24 * mBitRate / 8);
   }
 }
 
 // While for a full mix data and audio there will be a single packet in a
-// data compartment, for an empty mix, there may be many more
-void DataProcessor::_handle_packets(const u8 * data, i32 lengthBits)
+// data compartment, for an empty mix, there may be many more.
+// The data is packed into bytes (MSB first), so all lengths here are in bytes.
+void DataProcessor::_handle_packets(const u8 * data, i32 lengthBytes)
 {
   while (true)
   {
-    const i32 pLengthBits = (getBits_2(data, 0) + 1) * 24 * 8;
+    const i32 pLengthBytes = ((data[0] >> 6) + 1) * 24;
 
-    if (lengthBits < pLengthBits)
+    if (lengthBytes < pLengthBytes)
     {  // be on the safe side
-      qWarning() << "Packet lengthBits too short" << lengthBits << "bits" << pLengthBits << "needed";
+      qWarning() << "Packet length too short" << lengthBytes << "bytes" << pLengthBytes << "needed";
       return;
     }
 
     _handle_packet(data);
 
-    lengthBits -= pLengthBits;
+    lengthBytes -= pLengthBytes;
 
-    if (lengthBits < 2)
+    if (lengthBytes <= 0)
     {
-      if (lengthBits != 0)
-      {
-        qWarning() << "Packet lengthBits not zero with" << lengthBits << "bits";
-      }
       return;
     }
 
-    data = &(data[pLengthBits]);
+    data = &(data[pLengthBytes]);
   }
 }
 
@@ -155,12 +151,12 @@ void DataProcessor::_handle_packets(const u8 * data, i32 lengthBits)
 void DataProcessor::_handle_packet(const u8 * const data)
 {
   // see TS 300 401 5.3.2.0
-  const i32 packetLengthBytes = (getBits_2(data, 0) + 1) * 24;
-  const i16 continuityIndex = getBits_2(data, 2);
-  const i16 firstLast = getBits_2(data, 4);
-  const i16 address = getBits(data, 6, 10);
-  const u16 command = getBits_1(data, 16);
-  const i32 usefulLength = getBits_7(data, 17);
+  const i32 packetLengthBytes = (i32)(extract_bits_from_byte_stream(data, 0, 2) + 1) * 24;
+  const i16 continuityIndex = (i16)extract_bits_from_byte_stream(data, 2, 2);
+  const i16 firstLast = (i16)extract_bits_from_byte_stream(data, 4, 2);
+  const i16 address = (i16)extract_bits_from_byte_stream(data, 6, 10);
+  const u16 command = (u16)extract_bit_from_byte_stream(data, 16);
+  const i32 usefulLength = (i32)extract_bits_from_byte_stream(data, 17, 7);
 
   if (mPacketAddress != address)
   {
@@ -181,32 +177,24 @@ void DataProcessor::_handle_packet(const u8 * const data)
   mExpectedIndex = (mExpectedIndex + 1) % 4;
   (void)command;
 
-  if (!check_CRC_bits(data, packetLengthBytes * 8))
+  if (!check_crc_bytes(data, packetLengthBytes - 2))
   {
     return;
   }
 
-  //	assemble the full MSC datagroup
+  //	assemble the full MSC datagroup (packet header has 3 bytes)
 
   if (mPacketState == 0)
   {  // waiting for a start
     if (firstLast == 02)
     {  // first packet
       mPacketState = 1;
-      mSeriesVec.resize(usefulLength * 8);
-      for (u16 i = 0; i < mSeriesVec.size(); i++)
-      {
-        mSeriesVec[i] = data[24 + i];
-      }
+      mSeriesVec.assign(data + 3, data + 3 + usefulLength);
     }
     else if (firstLast == 03)
     {  // single packet, mostly padding
-      mSeriesVec.resize(usefulLength * 8);
-      for (u16 i = 0; i < mSeriesVec.size(); i++)
-      {
-        mSeriesVec[i] = data[24 + i];
-      }
-      mpDataHandler->add_MSC_data_group(mSeriesVec);
+      mSeriesVec.assign(data + 3, data + 3 + usefulLength);
+      _dispatch_MSC_data_group();
     }
     else
     {
@@ -217,33 +205,18 @@ void DataProcessor::_handle_packet(const u8 * const data)
   {  // within a series
     if (firstLast == 0)
     {  // intermediate packet
-      i32 currentLength = mSeriesVec.size();
-      mSeriesVec.resize(currentLength + 8 * usefulLength);
-      for (u16 i = 0; i < 8 * usefulLength; i++)
-      {
-        mSeriesVec[currentLength + i] = data[24 + i];
-      }
+      mSeriesVec.insert(mSeriesVec.cend(), data + 3, data + 3 + usefulLength);
     }
     else if (firstLast == 01)
     {  // last packet
-      i32 currentLength = mSeriesVec.size();
-      mSeriesVec.resize(currentLength + 8 * usefulLength);
-      for (u16 i = 0; i < 8 * usefulLength; i++)
-      {
-        mSeriesVec[currentLength + i] = data[24 + i];
-      }
-
-      mpDataHandler->add_MSC_data_group(mSeriesVec);
+      mSeriesVec.insert(mSeriesVec.cend(), data + 3, data + 3 + usefulLength);
+      _dispatch_MSC_data_group();
       mPacketState = 0;
     }
     else if (firstLast == 02)
     {  // first packet, previous one erroneous
       mPacketState = 1;
-      mSeriesVec.resize(usefulLength * 8);
-      for (u16 i = 0; i < mSeriesVec.size(); i++)
-      {
-        mSeriesVec[i] = data[24 + i];
-      }
+      mSeriesVec.assign(data + 3, data + 3 + usefulLength);
     }
     else
     {
@@ -253,15 +226,34 @@ void DataProcessor::_handle_packet(const u8 * const data)
   }
 }
 
+// For the optional buffer the data group is stored with a leading 16 bit byte length (big endian), so the reader is able
+// to split the groups again. A data group which does not fit completely into the buffer is skipped, so the buffer content
+// keeps consistent.
+void DataProcessor::_dispatch_MSC_data_group()
+{
+  if (const i32 numBytes = (i32)mSeriesVec.size();
+      mpMscDataGroupBuffer != nullptr && numBytes > 0 && mpMscDataGroupBuffer->get_ring_buffer_write_available() >= numBytes + 2)
+  {
+    const i32 packedSize = numBytes + 2;
+    auto * const packed = make_vla(u8, packedSize);
+    packed[0] = (u8)(numBytes >> 8);
+    packed[1] = (u8)(numBytes & 0xFF);
+    memcpy(packed + 2, mSeriesVec.data(), numBytes);
+    mpMscDataGroupBuffer->put_data_into_ring_buffer(packed, packedSize); // in one piece, so the reader never sees a partial group
+  }
+
+  mpDataHandler->add_MSC_data_group(mSeriesVec);
+}
+
 //	Really no idea what to do here
 void DataProcessor::_handle_TDC_async_stream(const u8 * data, i32 length)
 {
-  i16 packetLength = (getBits_2(data, 0) + 1) * 24;
-  i16 continuityIndex = getBits_2(data, 2);
-  i16 firstLast = getBits_2(data, 4);
-  i16 address = getBits(data, 6, 10);
-  u16 command = getBits_1(data, 16);
-  i16 usefulLength = getBits_7(data, 17);
+  i16 packetLength = (i16)(extract_bits_from_byte_stream(data, 0, 2) + 1) * 24;
+  i16 continuityIndex = (i16)extract_bits_from_byte_stream(data, 2, 2);
+  i16 firstLast = (i16)extract_bits_from_byte_stream(data, 4, 2);
+  i16 address = (i16)extract_bits_from_byte_stream(data, 6, 10);
+  u16 command = (u16)extract_bit_from_byte_stream(data, 16);
+  i16 usefulLength = (i16)extract_bits_from_byte_stream(data, 17, 7);
 
   (void)length;
   (void)packetLength;
@@ -271,7 +263,7 @@ void DataProcessor::_handle_TDC_async_stream(const u8 * data, i32 length)
   (void)command;
   (void)usefulLength;
 
-  if (!check_CRC_bits(data, packetLength * 8))
+  if (!check_crc_bytes(data, packetLength - 2))
   {
     return;
   }
@@ -38,19 +38,18 @@
 #include <cstring>
 #include <QObject>
 
-class DabRadio;
+class IDabObserver;
 
 class DataProcessor : public QObject, public FrameProcessor
 {
 Q_OBJECT
 public:
-  DataProcessor(DabRadio * ipDR, const SPacketData * ipPD, RingBuffer<u8> * ipDataBuffer);
+  DataProcessor(IDabObserver * ipObserver, const SPacketData * ipPD, RingBuffer<u8> * ipDataBuffer, RingBuffer<u8> * ipMscDataGroupBuffer = nullptr);
   ~DataProcessor() override = default;
 
   void add_to_frame(const std::vector<u8> &) override;
 
 private:
-  DabRadio * const mpDabRadio;
   const i16 mBitRate;
   const u8 mDSCTy;
   const i16 mAppType;
@@ -59,11 +58,12 @@ private:
   const i16 mFEC_scheme;
   const i16 mSubChannel;
   RingBuffer<u8> * const mpDataBuffer;
+  RingBuffer<u8> * const mpMscDataGroupBuffer; // optional, gets a copy of each assembled MSC data group
   QScopedPointer<VirtualDataHandler> mpDataHandler;
 
   i16 mExpectedIndex = 0;
   bool mFirstPacket = true; // only to suppress message while startup
-  std::vector<u8> mSeriesVec;
+  std::vector<u8> mSeriesVec; // assembled MSC data group (bytes)
   u8 mPacketState;
   i32 mStreamAddress;    // int since we init with -1
 
@@ -71,6 +71,7 @@ private:
   void _handle_TDC_async_stream(const u8 *, i32);
   void _handle_packets(const u8 *, i32);
   void _handle_packet(const u8 *);
+  void _dispatch_MSC_data_group();
 
 signals:
   void signal_show_MSC_errors(int);
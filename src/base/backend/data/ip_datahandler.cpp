@@ -30,33 +30,35 @@
  */
 
 #include "ip_datahandler.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "bit_extractors.h"
 #include "crc.h"
 
-IpDataHandler::IpDataHandler(DabRadio * mr, RingBuffer<u8> * dataBuffer)
+IpDataHandler::IpDataHandler(IDabObserver * ipObserver, RingBuffer<u8> * dataBuffer)
 {
   this->dataBuffer = dataBuffer;
   this->handledPackets = 0;
-  connect(this, &IpDataHandler::signal_write_datagramm, mr,  &DabRadio::slot_send_datagram);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &IpDataHandler::signal_write_datagramm, this, [ipObserver](int iLength) { ipObserver->send_datagram(iLength); }, Qt::DirectConnection);
+  }
 }
 
 void IpDataHandler::add_MSC_data_group(const std::vector<u8> & msc)
 {
-  u8 * data = (u8 *)(msc.data());
-  bool extensionFlag = getBits_1(data, 0) != 0;
-  bool crcFlag = getBits_1(data, 1) != 0;
-  bool segmentFlag = getBits_1(data, 2) != 0;
-  bool userAccessFlag = getBits_1(data, 3) != 0;
-  i16 next = 16;    // bits
+  const u8 * const data = msc.data();
+  bool extensionFlag = extract_bit_from_byte_stream(data, 0) != 0;
+  bool crcFlag = extract_bit_from_byte_stream(data, 1) != 0;
+  bool segmentFlag = extract_bit_from_byte_stream(data, 2) != 0;
+  bool userAccessFlag = extract_bit_from_byte_stream(data, 3) != 0;
+  i32 next = 16;    // bits
   bool lastSegment = false;
   u16 segmentNumber = 0;
   bool transportIdFlag = false;
   u16 transportId = 0;
   u8 lengthInd;
-  i16 i;
 
-  if (crcFlag && !check_CRC_bits(data, msc.size()))
+  if (crcFlag && !check_crc_bytes(data, (i32)msc.size() - 2))
   {
     return;
   }
@@ -68,8 +70,8 @@ void IpDataHandler::add_MSC_data_group(const std::vector<u8> & msc)
 
   if (segmentFlag)
   {
-    lastSegment = getBits_1(data, next) != 0;
-    segmentNumber = getBits(data, next + 1, 15);
+    lastSegment = extract_bit_from_byte_stream(data, next) != 0;
+    segmentNumber = (u16)extract_bits_from_byte_stream(data, next + 1, 15);
     next += 16;
   }
 
@@ -77,29 +79,22 @@ void IpDataHandler::add_MSC_data_group(const std::vector<u8> & msc)
   (void)segmentNumber;
   if (userAccessFlag)
   {
-    transportIdFlag = getBits_1(data, next + 3);
-    lengthInd = getBits_4(data, next + 4);
+    transportIdFlag = extract_bit_from_byte_stream(data, next + 3) != 0;
+    lengthInd = (u8)extract_bits_from_byte_stream(data, next + 4, 4);
     next += 8;
     if (transportIdFlag)
     {
-      transportId = getBits(data, next, 16);
+      transportId = (u16)extract_bits_from_byte_stream(data, next, 16);
     }
     next += lengthInd * 8;
   }
   (void)transportId;
   u16 ipLength = 0;
-  i16 sizeinBits = msc.size() - next - (crcFlag != 0 ? 16 : 0);
 
-  (void)sizeinBits;
-  ipLength = getBits(data, next + 16, 16);
-  if (ipLength < msc.size() / 8)
-  {  // just to be sure
-    std::vector<u8> ipVector;
-    ipVector.resize(ipLength);
-    for (i = 0; i < ipLength; i++)
-    {
-      ipVector[i] = getBits_8(data, next + 8 * i);
-    }
+  ipLength = (u16)extract_bits_from_byte_stream(data, next + 16, 16);
+  if (ipLength > 0 && next / 8 + ipLength <= (i32)msc.size())
+  {  // just to be sure, all fields are byte aligned
+    const std::vector<u8> ipVector(data + next / 8, data + next / 8 + ipLength);
     if ((ipVector[0] >> 4) != 4)
     {
       return;
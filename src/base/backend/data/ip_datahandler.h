@@ -35,13 +35,13 @@
 #include <vector>
 #include "ringbuffer.h"
 
-class DabRadio;
+class IDabObserver;
 
 class IpDataHandler : public VirtualDataHandler
 {
 Q_OBJECT
 public:
-  IpDataHandler(DabRadio *, RingBuffer<u8> *);
+  IpDataHandler(IDabObserver *, RingBuffer<u8> *);
   ~IpDataHandler() override = default;
 
   void add_MSC_data_group(const std::vector<u8> &) override ;
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "NML.h"
+#include "glob_data_types.h"
+#include <memory>
+#include <QMap>
+
+// Journaline database, filled by the JournalineDataHandler and shown by the JournalineViewer
+struct SJournalineElement
+{
+  std::shared_ptr<NML::News_t> pElement;
+  bool isOpened = false;
+  bool wasVisited = false;
+};
+
+using TJournalineMap = QMap<i32, SJournalineElement>;
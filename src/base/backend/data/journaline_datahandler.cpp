@@ -31,9 +31,8 @@
 #include "journaline_datahandler.h"
 #include "dabdatagroupdecoder.h"
 #include "bit_extractors.h"
-#include "journaline_viewer.h"
 #include <sys/time.h>
-#include "dabradio.h"
+#include "dab_observer_if.h"
 
 static void callback_func(const DAB_DATAGROUP_DECODER_msc_datagroup_header_t * const pHeader,
                           const unsigned long iLen, const unsigned char * ipBuffer, void * pArg)
@@ -53,35 +52,36 @@ static void callback_func(const DAB_DATAGROUP_DECODER_msc_datagroup_header_t * c
   pDataHandler->add_to_dataBase(pNml);
 }
 
-JournalineDataHandler::JournalineDataHandler(DabRadio * const ipDR, const i32 iSubChannel)
-  : mJournalineViewer(mDataMap, iSubChannel)
+JournalineDataHandler::JournalineDataHandler(IDabObserver * const ipObserver, const i32 iSubChannel)
+  : mpDabObserver(ipObserver)
+  , mSubChannel(iSubChannel)
+  , mpDataMap(std::make_shared<TJournalineMap>())
 {
   mDataGroupDecoder = DAB_DATAGROUP_DECODER_createDec(callback_func, this);
 
-  connect(this, &JournalineDataHandler::signal_new_data, &mJournalineViewer, &JournalineViewer::slot_new_data);
-  connect(&mJournalineViewer, &JournalineViewer::signal_window_closed, ipDR, &DabRadio::slot_handle_journaline_viewer_closed, Qt::QueuedConnection);
+  if (mpDabObserver != nullptr)
+  {
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &JournalineDataHandler::signal_new_data, this, [pObs, iSubChannel]() { pObs->journaline_new_data(iSubChannel); }, Qt::DirectConnection);
+    mpDabObserver->journaline_started(mSubChannel, mpDataMap);
+  }
 }
 
 JournalineDataHandler::~JournalineDataHandler()
 {
   DAB_DATAGROUP_DECODER_deleteDec(mDataGroupDecoder);
-  _destroy_database();
+
+  // the database itself lives on as long as the observer holds it
+  if (mpDabObserver != nullptr)
+  {
+    mpDabObserver->journaline_stopped(mSubChannel);
+  }
 }
 
 //void	journaline_dataHandler::add_mscDatagroup (QByteArray &msc) {
 void JournalineDataHandler::add_MSC_data_group(const std::vector<u8> & msc)
 {
-  const i32 len = (i32)msc.size();
-  assert(len % 8 == 0);
-  const i32 lenBytes = len / 8;
-  auto * const buffer = make_vla(u8, lenBytes);
-
-  for (i32 i = 0; i < lenBytes; i++)
-  {
-    buffer[i] = getBits_8(msc.data(), i << 3);
-  }
-
-  const u32 res = DAB_DATAGROUP_DECODER_putData(mDataGroupDecoder, len / 8, buffer);
+  const u32 res = DAB_DATAGROUP_DECODER_putData(mDataGroupDecoder, msc.size(), msc.data());
 
   if (res != 0)
   {
@@ -89,15 +89,6 @@ void JournalineDataHandler::add_MSC_data_group(const std::vector<u8> & msc)
   }
 }
 
-void JournalineDataHandler::_destroy_database()
-{
-  for (auto i : mDataMap)
-  {
-    i.pElement.reset(); // not really necessary
-  }
-  mDataMap.clear();
-}
-
 void JournalineDataHandler::add_to_dataBase(const std::shared_ptr<NML> & ipNmlElement)
 {
   switch (ipNmlElement->GetObjectType())
@@ -110,16 +101,17 @@ void JournalineDataHandler::add_to_dataBase(const std::shared_ptr<NML> & ipNmlEl
   case NML::PLAIN:
   case NML::LIST:
   {
+    TJournalineMap & dataMap = *mpDataMap;
     const auto objId = ipNmlElement->GetObjectId();
-    const auto it = mDataMap.find(objId);
+    const auto it = dataMap.find(objId);
     const auto revIdxNew = ipNmlElement->GetRevisionIndex();
-    const auto revIdxMap = (it != mDataMap.end()) ? it.value().pElement->revision_index : ~revIdxNew; // invert id if it is a new object to trigger the signal
+    const auto revIdxMap = (it != dataMap.end()) ? it.value().pElement->revision_index : ~revIdxNew; // invert id if it is a new object to trigger the signal
 
     if (revIdxNew != revIdxMap)
     {
-      JournalineViewer::STableElement & tblElem = mDataMap[objId]; // a not existing map element will be created and initialized here
+      SJournalineElement & tblElem = dataMap[objId]; // a not existing map element will be created and initialized here
       tblElem.pElement = ipNmlElement->get_news_ptr(); // get data ownership here
-      mDataMap.insert(objId, tblElem);
+      dataMap.insert(objId, tblElem);
 
       emit signal_new_data();
     }
@@ -33,32 +33,32 @@
 #include "dab_constants.h"
 #include "virtual_datahandler.h"
 #include "dabdatagroupdecoder.h"
-#include "journaline_viewer.h"
+#include "journaline_data.h"
 #include "NML.h"
+#include <memory>
 #include <vector>
 #include <QObject>
 
-class DabRadio;
+class IDabObserver;
 
 class JournalineDataHandler : public VirtualDataHandler
 {
   Q_OBJECT
 
 public:
-  JournalineDataHandler(DabRadio * ipDR, i32 iSubChannel);
+  JournalineDataHandler(IDabObserver * ipObserver, i32 iSubChannel);
   ~JournalineDataHandler();
 
   void add_MSC_data_group(const std::vector<u8> &);
   void add_to_dataBase(const std::shared_ptr<NML> & ipNmlElement);
 
 private:
-  JournalineViewer::TMapData mDataMap;
-  JournalineViewer mJournalineViewer;
+  IDabObserver * const mpDabObserver;
+  const i32 mSubChannel;
+  const std::shared_ptr<TJournalineMap> mpDataMap; // shared with the viewer of the observer
   DAB_DATAGROUP_DECODER_t mDataGroupDecoder;
   DAB_DATAGROUP_DECODER_data mDataGroupCallBack;
 
-  void _destroy_database();
-
 signals:
   void signal_new_data();
 };
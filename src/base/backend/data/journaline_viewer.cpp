@@ -26,8 +26,9 @@ static const QString cColorVisiting  = QSL("#FFFF00");  // opened and actual vis
 static const QString cColorVisited   = QSL("#FF6060");  // closed but visited before
 static const QString cColorText      = QSL("#FFFFFF");  // information text
 
-JournalineViewer::JournalineViewer(TMapData & ioTableVec, const i32 iSubChannel)
-  : mDataMap(ioTableVec)
+JournalineViewer::JournalineViewer(const std::shared_ptr<TMapData> & ipTableVec, const i32 iSubChannel)
+  : mpDataMap(ipTableVec)
+  , mDataMap(*ipTableVec)
   , mSubChannel(iSubChannel)
 {
   mFrame.setWindowFlag(Qt::Tool, true);
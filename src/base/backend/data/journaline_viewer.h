@@ -12,7 +12,7 @@
  */
 #pragma once
 
-#include "NML.h"
+#include "journaline_data.h"
 #include "glob_data_types.h"
 #include <memory>
 #include <QObject>
@@ -26,22 +26,17 @@ class JournalineViewer : public QObject
   Q_OBJECT
 
 public:
-  struct STableElement
-  {
-    std::shared_ptr<NML::News_t> pElement;
-    bool isOpened = false;
-    bool wasVisited = false;
-  };
+  using STableElement = SJournalineElement;
+  using TMapData = TJournalineMap;
 
-  using TMapData = QMap<i32, STableElement>;
-
-  JournalineViewer(TMapData & ioTableVec, i32 iSubChannel);
+  JournalineViewer(const std::shared_ptr<TMapData> & ipTableVec, i32 iSubChannel);
   ~JournalineViewer() override;
 
 protected:
   bool eventFilter(QObject * watched, QEvent * event) override;
 
 private:
+  const std::shared_ptr<TMapData> mpDataMap; // shared with the JournalineDataHandler
   TMapData & mDataMap;
   const i32 mSubChannel;
   STableElement mCurrTableElement;
@@ -25,7 +25,7 @@
  */
 #include "mot_dir.h"
 
-MotDirectory::MotDirectory (DabRadio *mr,
+MotDirectory::MotDirectory (IDabObserver *mr,
                             u16	transportId,
                             i16	segmentSize,
                             i32	dirSize,
@@ -33,7 +33,7 @@ MotDirectory::MotDirectory (DabRadio *mr,
                             u8	*segment) {
 i16	i;
 
-	   this	-> myRadioInterface	= mr;
+	   this	-> myObserver	= mr;
 	   for (i = 0; i < 512; i ++)
 	      marked [i] = false;
 	   num_dirSegments	= -1;
@@ -137,7 +137,7 @@ u16 extensionLength	= (dir_segments [currentBase] << 8) |
 
 //	   fprintf (stdout, "motObject with transportId %d and \n", transportId);
 	   u8 *segment	= &dir_segments [currentBase + 2];
-	   MotObject *handle	= new MotObject (myRadioInterface,
+	   MotObject *handle	= new MotObject (myObserver,
                                          true,
                                          false,
                                          transportId,
@@ -28,11 +28,11 @@
 #include "mot_object.h"
 #include	<QString>
 #include	<vector>
-class	DabRadio;
+class	IDabObserver;
 
 class	MotDirectory {
 public:
-			MotDirectory	(DabRadio *,
+			MotDirectory	(IDabObserver *,
                      u16,
                      i16,
                      i32,
@@ -51,7 +51,7 @@ private:
 	void		analyse_theDirectory();
 	u16	transportId;
 
-	DabRadio	*myRadioInterface;
+	IDabObserver	*myObserver;
 	std::vector<u8>	dir_segments;
 	bool		marked [512];
 	i16		dir_segmentSize;
@@ -32,12 +32,11 @@
 #include "mot_handler.h"
 #include "mot_object.h"
 #include "mot_dir.h"
-#include "dabradio.h"
 #include "bit_extractors.h"
 #include "crc.h"
 
-MotHandler::MotHandler(DabRadio * mr)
-  : mpRadioInterface(mr)
+MotHandler::MotHandler(IDabObserver * ipObserver)
+  : mpDabObserver(ipObserver)
 {
   for (auto & mt: mMotTable)
   {
@@ -68,13 +67,18 @@ MotHandler::~MotHandler()
 
 void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
 {
+  if (msc.size() < 2)
+  {
+    return;
+  }
+
   const u8 * const data = msc.data();
-  const bool extensionFlag = getBits_1(data, 0) != 0;
-  const bool crcFlag = getBits_1(data, 1) != 0;
-  const bool segmentFlag = getBits_1(data, 2) != 0;
-  const bool userAccessFlag = getBits_1(data, 3) != 0;
-  const u8 groupType = getBits_4(data, 4);
-  const u8 CI = getBits_4(data, 8);
+  const bool extensionFlag = extract_bit_from_byte_stream(data, 0) != 0;
+  const bool crcFlag = extract_bit_from_byte_stream(data, 1) != 0;
+  const bool segmentFlag = extract_bit_from_byte_stream(data, 2) != 0;
+  const bool userAccessFlag = extract_bit_from_byte_stream(data, 3) != 0;
+  const u8 groupType = (u8)extract_bits_from_byte_stream(data, 4, 4);
+  const u8 CI = (u8)extract_bits_from_byte_stream(data, 8, 4);
   i32 next = 16;    // bits
   bool lastFlag = false;
   u16 segmentNumber = 0;
@@ -83,12 +87,8 @@ void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
   u8 lengthInd;
 
   (void)CI;
-  if (msc.size() <= 0)
-  {
-    return;
-  }
 
-  if (crcFlag && !check_CRC_bits(data, msc.size()))
+  if (crcFlag && !check_crc_bytes(data, (i32)msc.size() - 2))
   {
     return;
   }
@@ -100,41 +100,32 @@ void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
 
   if (segmentFlag)
   {
-    lastFlag = getBits_1(data, next) != 0;
-    segmentNumber = getBits(data, next + 1, 15);
+    lastFlag = extract_bit_from_byte_stream(data, next) != 0;
+    segmentNumber = (u16)extract_bits_from_byte_stream(data, next + 1, 15);
     next += 16;
   }
 
   if (userAccessFlag)
   {
-    transportIdFlag = getBits_1(data, next + 3);
-    lengthInd = getBits_4(data, next + 4);
+    transportIdFlag = extract_bit_from_byte_stream(data, next + 3) != 0;
+    lengthInd = (u8)extract_bits_from_byte_stream(data, next + 4, 4);
     next += 8;
     if (transportIdFlag)
     {
-      transportId = getBits(data, next, 16);
+      transportId = (u16)extract_bits_from_byte_stream(data, next, 16);
     }
     next += lengthInd * 8;
   }
 
-  i32 sizeinBits = msc.size() - next - (crcFlag != 0 ? 16 : 0);
+  i32 sizeinBits = 8 * (i32)msc.size() - next - (crcFlag != 0 ? 16 : 0);
 
-  if (!transportIdFlag)
+  if (!transportIdFlag || sizeinBits < 16)
   {
     return;
   }
 
-  std::vector<u8> motVector;
-  motVector.resize(sizeinBits / 8);
-  for (i32 i = 0; i < sizeinBits / 8; i++)
-  {
-    u8 t = 0;
-    for (i32 j = 0; j < 8; j++)
-    {
-      t = (t << 1) | data[next + 8 * i + j];
-    }
-    motVector[i] = t;
-  }
+  // all fields are byte aligned
+  std::vector<u8> motVector(data + next / 8, data + next / 8 + sizeinBits / 8);
 
   u32 segmentSize = ((motVector[0] & 0x1F) << 8) | motVector[1];
   switch (groupType)
@@ -147,7 +138,7 @@ void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
       {
         break;
       }
-      h = new MotObject(mpRadioInterface, false, false, // not within a directory
+      h = new MotObject(mpDabObserver, false, false, // not within a directory
                         transportId, &motVector[2], segmentSize, lastFlag);
       setHandle(h, transportId);
     }
@@ -158,7 +149,7 @@ void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
     MotObject * h = getHandle(transportId);
     if (h == nullptr)
     {
-      h = new MotObject(mpRadioInterface, false, false, // not within a directory
+      h = new MotObject(mpDabObserver, false, false, // not within a directory
                         transportId, &motVector[2], segmentSize, lastFlag);
       setHandle(h, transportId);
     }
@@ -191,7 +182,7 @@ void MotHandler::add_MSC_data_group(const std::vector<u8> & msc)
       //	                          (segment [7] <<  8) | segment [8];
       //	         i32 segSize
       //	                        = ((segment [9] & 0x1F) << 8) | segment [10];
-      mpDirectory = new MotDirectory(mpRadioInterface, transportId, segmentSize, dirSize, numObjects, segment);
+      mpDirectory = new MotDirectory(mpDabObserver, transportId, segmentSize, dirSize, numObjects, segment);
     }
     else
     {
@@ -34,14 +34,14 @@
 #include "virtual_datahandler.h"
 #include <vector>
 
-class DabRadio;
+class IDabObserver;
 class MotObject;
 class MotDirectory;
 
 class MotHandler : public VirtualDataHandler
 {
 public:
-  explicit MotHandler(DabRadio *);
+  explicit MotHandler(IDabObserver *);
   ~MotHandler() override;
 
   void add_MSC_data_group(const std::vector<u8> &);
@@ -55,7 +55,7 @@ private:
   };
 
   MotDirectory * mpDirectory = nullptr;
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   int mOrderNumber = 0;
   std::array<SMotTable, 15> mMotTable; // TODO: are 55 or 15 the better number?
 
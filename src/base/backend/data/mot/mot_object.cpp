@@ -33,7 +33,7 @@
  */
 
 #include "mot_object.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "bit_extractors.h"
 #include "qt_compat.h"
 #include <QLoggingCategory>
@@ -42,29 +42,40 @@
 Q_LOGGING_CATEGORY(sLogMotObject, "MotObject", QtWarningMsg)
 
 
-MotObject::MotObject(DabRadio * ipDR, const bool iDirElement, const bool iPadElement, const u16 iTransportId, const u8 * const ipSegment, const i32 iSegmentSize, const bool iLastFlag)
-  : mpDR(ipDR)
+MotObject::MotObject(IDabObserver * ipObserver, const bool iDirElement, const bool iPadElement, const u16 iTransportId, const u8 * const ipSegment, const i32 iSegmentSize, const bool iLastFlag)
+  : mpDabObserver(ipObserver)
   , mIsDirElement(iDirElement)
   , mIsPadElement(iPadElement)
 {
   qCDebug(sLogMotObject()) << "Init MotObject() (1) with dirElement" << iDirElement << "and transportId" << iTransportId << "and segmentSize" << iSegmentSize << "and lastFlag" << iLastFlag;
   qCWarning(sLogMotObject()) << "This is not working well yet";
 
-  connect(this, &MotObject::signal_new_mot_object, ipDR, &DabRadio::slot_handle_mot_object);
-  connect(this, &MotObject::signal_pad_mot_progress, ipDR, &DabRadio::slot_pad_mot_progress);
+  _connect_observer();
 
   set_header(ipSegment, iSegmentSize, iLastFlag, iTransportId);
 }
 
-MotObject::MotObject(DabRadio * const ipDR, const bool iDirElement, const bool iPadElement)
-  : mpDR(ipDR)
+MotObject::MotObject(IDabObserver * const ipObserver, const bool iDirElement, const bool iPadElement)
+  : mpDabObserver(ipObserver)
   , mIsDirElement(iDirElement)
   , mIsPadElement(iPadElement)
 {
   qCDebug(sLogMotObject()) << "Init MotObject() (2) with dirElement" << iDirElement;
 
-  connect(this, &MotObject::signal_new_mot_object, ipDR, &DabRadio::slot_handle_mot_object);
-  connect(this, &MotObject::signal_pad_mot_progress, ipDR, &DabRadio::slot_pad_mot_progress);
+  _connect_observer();
+}
+
+void MotObject::_connect_observer()
+{
+  if (mpDabObserver != nullptr)
+  {
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &MotObject::signal_new_mot_object, this, [pObs](const QByteArray & iData, const QString & iName, i32 iContentType, bool iDirElement)
+    {
+      pObs->handle_mot_object(iData, iName, iContentType, iDirElement);
+    }, Qt::DirectConnection);
+    connect(this, &MotObject::signal_pad_mot_progress, this, [pObs](i32 iPercent) { pObs->pad_mot_progress(iPercent); }, Qt::DirectConnection);
+  }
 }
 
 
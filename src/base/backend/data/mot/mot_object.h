@@ -34,20 +34,19 @@
 #include "dab_constants.h"
 #include "mot_content_types.h"
 #include <QObject>
-#include <QLabel>
 #include <QByteArray>
 #include <QString>
 #include <QDir>
 #include <map>
 
-class DabRadio;
+class IDabObserver;
 
 class MotObject : public QObject
 {
 Q_OBJECT
 public:
-  MotObject(DabRadio * ipDR, bool iDirElement, bool iPadElement);
-  MotObject(DabRadio * ipDR, bool iDirElement, bool iPadElement, u16 iTransportId, const u8 * ipSegment, i32 iSegmentSize, bool iLastFlag);
+  MotObject(IDabObserver * ipObserver, bool iDirElement, bool iPadElement);
+  MotObject(IDabObserver * ipObserver, bool iDirElement, bool iPadElement, u16 iTransportId, const u8 * ipSegment, i32 iSegmentSize, bool iLastFlag);
   ~MotObject() override = default;
 
   void set_header(const u8 * iSegment, i32 iSegmentSize, bool iLastFlag, i32 iTransportId);
@@ -56,7 +55,7 @@ public:
   void reset();
 
 private:
-  DabRadio * const mpDR;
+  IDabObserver * const mpDabObserver;
   const bool mIsDirElement;
   const bool mIsPadElement;
 
@@ -86,6 +85,7 @@ private:
   i32 mSumSegmentSize = 0;
 
   bool _check_if_complete();
+  void _connect_observer();
   void _handle_complete();
   void _process_parameter_id(const u8 * ipSegment, i32 & ioPointer, u8 iParamId, u16 iLength);
   void _process_header_extension(const u8 * iSegment, i32 & ioPointer);
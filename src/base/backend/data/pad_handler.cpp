@@ -30,7 +30,7 @@
  */
 
 #include "pad_handler.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "crc.h"
 #include <QLoggingCategory>
 
@@ -48,13 +48,16 @@ private:
   static constexpr std::array<i16, 8> cLengthTable = { 4, 6, 8, 12, 16, 24, 32, 48 };
 };
 
-PadHandler::PadHandler(DabRadio * mr)
-  : mpRadioInterface(mr)
+PadHandler::PadHandler(IDabObserver * ipObserver)
+  : mpDabObserver(ipObserver)
 {
-  mpMotObject.reset(new MotObject(mr, false, true));
+  mpMotObject.reset(new MotObject(ipObserver, false, true));
 
-  connect(this, &PadHandler::signal_show_label, mr, &DabRadio::slot_show_label);
-  connect(this, &PadHandler::signal_show_mot_handling, mr, &DabRadio::slot_trigger_mot_indicator);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &PadHandler::signal_show_label, this, [ipObserver](const QString & iLabel) { ipObserver->show_label(iLabel); }, Qt::DirectConnection);
+    connect(this, &PadHandler::signal_show_mot_handling, this, [ipObserver]() { ipObserver->trigger_mot_indicator(); }, Qt::DirectConnection);
+  }
 
   mMscDataGroupBuffer.reserve(1024); // try to avoid future memory swapping
   mDataBuffer.reserve(1024); // try to avoid future memory swapping
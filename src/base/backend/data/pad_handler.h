@@ -39,7 +39,7 @@
 #include <QObject>
 #include <QScopedPointer>
 
-class DabRadio;
+class IDabObserver;
 class MotObject;
 
 class PadHandler : public QObject
@@ -47,13 +47,13 @@ class PadHandler : public QObject
   Q_OBJECT
 
 public:
-  explicit PadHandler(DabRadio *);
+  explicit PadHandler(IDabObserver *);
   ~PadHandler() override = default;
 
   void process_PAD(const u8 * iBuffer, i16 iLast, u8 iL1, u8 iL0);
 
 private:
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   void _handle_variable_PAD(const u8 * iBuffer, i16 iLast, bool iCiFlag);
   void _handle_short_PAD(const u8 * iBuffer, i16 iLast, bool iCIFlag);
   void _dynamic_label(const std::vector<u8> &, u8 iApplType);
@@ -20,16 +20,18 @@
  */
 
 #include "tdc_datahandler.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "bit_extractors.h"
 #include "crc.h"
 
-tdc_dataHandler::tdc_dataHandler(DabRadio * mr, RingBuffer<u8> * dataBuffer, i16 /*appType*/)
+tdc_dataHandler::tdc_dataHandler(IDabObserver * ipObserver, RingBuffer<u8> * dataBuffer, i16 /*appType*/)
 {
-  myRadioInterface = mr;
   this->dataBuffer = dataBuffer;
   //	for the moment we assume appType 4
-  connect(this, &tdc_dataHandler::signal_bytes_out, myRadioInterface,  &DabRadio::slot_handle_tdc_data);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &tdc_dataHandler::signal_bytes_out, this, [ipObserver](int iFrameType, int iLength) { ipObserver->handle_tdc_data(iFrameType, iLength); }, Qt::DirectConnection);
+  }
 }
 
 #define  swap(a)  (((a) << 8) | ((a) >> 8))
@@ -52,16 +54,16 @@ u16 usCalculCRC(u8 * buf, int lg)
 void tdc_dataHandler::add_MSC_data_group(const std::vector<u8> & m)
 {
   i32 offset = 0;
-  u8 * data = (u8 *)(m.data());
-  i32 size = m.size();
+  const u8 * const data = m.data();
+  i32 size = 8 * (i32)m.size();
   i16 i;
 
-  //	we maintain offsets in bits, the "m" array has one bit per byte
+  //	we maintain offsets in bits, the "m" array is packed into bytes (all offsets are byte aligned)
   while (offset < size)
   {
     while (offset + 16 < size)
     {
-      if (getBits(data, offset, 16) == 0xFF0F)
+      if (extract_bits_from_byte_stream(data, offset, 16) == 0xFF0F)
       {
         break;
       }
@@ -77,11 +79,11 @@ void tdc_dataHandler::add_MSC_data_group(const std::vector<u8> & m)
 
     //	we have a syncword
     //	   u16 syncword	= getBits (data, offset,      16);
-    i16 length = getBits(data, offset + 16, 16);
-    u16 crc = getBits(data, offset + 32, 16);
+    i16 length = (i16)extract_bits_from_byte_stream(data, offset + 16, 16);
+    u16 crc = (u16)extract_bits_from_byte_stream(data, offset + 32, 16);
 
     (void)crc;
-    u8 frametypeIndicator = getBits(data, offset + 48, 8);
+    u8 frametypeIndicator = data[(offset + 48) / 8];
     if ((length < 0) || (length >= (size - offset) / 8))
     {
       return;
@@ -93,19 +95,19 @@ void tdc_dataHandler::add_MSC_data_group(const std::vector<u8> & m)
     //	first the syncword and the length
     for (i = 0; i < 4; i++)
     {
-      checkVector[i] = getBits(data, offset + i * 8, 8);
+      checkVector[i] = data[offset / 8 + i];
     }
     //
     //	we skip the crc in the incoming data and take the frametype
-    checkVector[4] = getBits(data, offset + 6 * 8, 8);
+    checkVector[4] = data[offset / 8 + 6];
 
     int size = length < 11 ? length : 11;
     for (i = 0; i < size; i++)
     {
-      checkVector[5 + i] = getBits(data, offset + 7 * 8 + i * 8, 8);
+      checkVector[5 + i] = data[offset / 8 + 7 + i];
     }
-    checkVector[5 + size] = getBits(data, offset + 4 * 8, 8);
-    checkVector[5 + size + 1] = getBits(data, offset + 5 * 8, 8);
+    checkVector[5 + size] = data[offset / 8 + 4];
+    checkVector[5 + size + 1] = data[offset / 8 + 5];
     if (!check_crc_bytes(checkVector, 5 + size))
     {
       qWarning("CRC failed");
@@ -127,16 +129,11 @@ void tdc_dataHandler::add_MSC_data_group(const std::vector<u8> & m)
   }
 }
 
-i32 tdc_dataHandler::handleFrame_type_0(u8 * data, i32 offset, i32 length)
+i32 tdc_dataHandler::handleFrame_type_0(const u8 * data, i32 offset, i32 length)
 {
-  i16 i;
   //i16 noS	= getBits (data, offset, 8);
-  auto * const buffer = make_vla(u8, length);
+  const u8 * const buffer = data + offset / 8;
 
-  for (i = 0; i < length; i++)
-  {
-    buffer[i] = getBits(data, offset + i * 8, 8);
-  }
   if (!check_crc_bytes(buffer, length - 2))
   {
     fprintf(stdout, "crc check failed\n");
@@ -150,10 +147,9 @@ i32 tdc_dataHandler::handleFrame_type_0(u8 * data, i32 offset, i32 length)
   return offset + length * 8;
 }
 
-i32 tdc_dataHandler::handleFrame_type_1(u8 * data, i32 offset, i32 length)
+i32 tdc_dataHandler::handleFrame_type_1(const u8 * data, i32 offset, i32 length)
 {
-  i16 i;
-  auto * const buffer = make_vla(u8, length);
+  const u8 * const buffer = data + offset / 8;
   int lOffset;
   int llengths = length - 4;
 #if 0
@@ -163,18 +159,14 @@ i32 tdc_dataHandler::handleFrame_type_1(u8 * data, i32 offset, i32 length)
                                getBits (data, offset + 16, 8));
   fprintf (stdout, "encryption %d\n", getBits (data, offset + 24, 8));
 #endif
-  for (i = 0; i < length; i++)
-  {
-    buffer[i] = getBits(data, offset + i * 8, 8);
-  }
   dataBuffer->put_data_into_ring_buffer(buffer, length);
-  if (getBits(data, offset + 24, 8) == 0)
+  if (buffer[3] == 0)
   {  // no encryption
     lOffset = offset + 4 * 8;
     do
     {
       //	      int compInd	= getBits (data, lOffset, 8);
-      int flength = getBits(data, lOffset + 8, 16);
+      int flength = (int)extract_bits_from_byte_stream(data, lOffset + 8, 16);
       //	      int crc		= getBits (data, lOffset + 3 * 8, 8);
 #if 0
       fprintf (stdout, "segment %d, length %d\n",
@@ -203,7 +195,7 @@ bool tdc_dataHandler::serviceComponentFrameheaderCRC(const u8 * data, i16 offset
 {
   u8 testVector[18];
   i16 i;
-  i16 length = getBits(data, offset + 8, 16);
+  i16 length = (i16)extract_bits_from_byte_stream(data, offset + 8, 16);
   i16 size = length < 13 ? length : 13;
   u16 crc;
 
@@ -211,13 +203,13 @@ bool tdc_dataHandler::serviceComponentFrameheaderCRC(const u8 * data, i16 offset
   {
     return false;
   }    // assumed garbage
-  crc = getBits(data, offset + 24, 16);  // the crc
-  testVector[0] = getBits(data, offset + 0, 8);
-  testVector[1] = getBits(data, offset + 8, 8);
-  testVector[2] = getBits(data, offset + 16, 8);
+  crc = (u16)extract_bits_from_byte_stream(data, offset + 24, 16);  // the crc
+  testVector[0] = data[offset / 8 + 0];
+  testVector[1] = data[offset / 8 + 1];
+  testVector[2] = data[offset / 8 + 2];
   for (i = 0; i < size; i++)
   {
-    testVector[3 + i] = getBits(data, offset + 40 + i * 8, 8);
+    testVector[3 + i] = data[offset / 8 + 5 + i];
   }
 
   return usCalculCRC(testVector, 3 + size) == crc;
@@ -41,6 +41,7 @@ public:
   VirtualDataHandler() = default;
   virtual ~VirtualDataHandler() = default;
 
+  // the MSC data group is packed into bytes
   virtual void add_MSC_data_group(const std::vector<u8> &)  {}
 };
 
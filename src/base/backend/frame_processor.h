@@ -33,7 +33,8 @@
 #include <vector>
 #include <cstdio>
 
-// Virtual class, just for providing a common base for the real decoder classes
+// Virtual class, just for providing a common base for the real decoder classes.
+// add_to_frame() gets the 24ms MSC data of a sub-channel packed into bytes (MSB first, 3 * bitrate bytes).
 class FrameProcessor
 {
 public:
@@ -29,9 +29,11 @@
  *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 #include "dab_constants.h"
-#include "dabradio.h"
 #include "msc_handler.h"
 #include "backend.h"
+#include "fib_decoder_if.h"
+#include <map>
+#include <thread>
 
 // Interface program for processing the MSC.
 // The DabProcessor assumes the existence of an msc-handler, whether a service is selected or not.
@@ -39,42 +41,73 @@
 constexpr i32 cCUSizeBits = 64;
 constexpr i32 cCifSizeBits = 55296; // bits for one CIF (== 864 CUs with a 64 bits), there are 4 CIFs per Frame, need 4 * 18 = 72 symbols
 constexpr i32 cNumberOfBlocksPerCif = 18; // 18, 72, 0(?), 36 for DAB-Mode 1..4
+constexpr i32 cNumCifBuffers = NUMBER_SLOTS + 2; // initial ring size (one backend with all NUMBER_SLOTS pending, one in writing, one spare), grows if more are referenced
 
 // Note: CIF counts from 0 .. 3
-MscHandler::MscHandler(DabRadio * const iRI, RingBuffer<u8> * const ipFrameBuffer)
-  : mpRadioInterface(iRI)
+MscHandler::MscHandler(IDabObserver * const ipObserver, RingBuffer<u8> * const ipFrameBuffer)
+  : mpDabObserver(ipObserver)
   , mpFrameBuffer(ipFrameBuffer)
+  , mCifRing(cNumCifBuffers, cCifSizeBits)
 {
-  mCifVector.resize(cCifSizeBits);
+  mpCifWrite = mCifRing.next_cif();
+  mpBackendList = std::make_shared<SBackendList>();
 }
 
 MscHandler::~MscHandler()
 {
-  QVector<QSharedPointer<Backend>> backendsToStop;
+  stop_full_multiplex();
+  _stop_backends(_take_all_backends());
+}
+
+// mMutex must be held by the caller
+void MscHandler::_publish_backend_list(TBackendListPtr ipNewList)
+{
+  std::atomic_exchange_explicit(&mpBackendList, std::move(ipNewList), std::memory_order_seq_cst);
+
+  // Grace period: process_block() may still post segments from the old list if it has loaded it before the exchange.
+  // It makes mPostEpoch odd before it loads the list and even again when all segments are posted. If the epoch is odd
+  // now, we wait until this posting loop is left (some microseconds), a new posting loop already sees the new list.
+  // After that no more segments are posted to a backend missing in the new list, so the caller can stop it safely.
+  // (Counting the references of the old list is not usable, as the callers and other readers hold some, too.)
+  //
+  // This is a store-then-load handshake on two different variables (list here, epoch in process_block()), which only
+  // works if neither side can move its load before its store. The shared_ptr atomics of C++17 may be (and in libstdc++
+  // are) implemented with a lock, which gives only acquire/release ordering. Hence the seq_cst fences on both sides:
+  // either this load sees the odd epoch, or the posting loop loads the new list.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const u32 epoch = mPostEpoch.load(std::memory_order_seq_cst);
+  if (epoch & 1)
   {
-    QMutexLocker lock(&mMutex);
-    backendsToStop.swap(mBackendList);
+    while (mPostEpoch.load(std::memory_order_acquire) == epoch)
+    {
+      std::this_thread::yield();
+    }
   }
-  for (auto & b: backendsToStop)
+}
+
+QVector<QSharedPointer<Backend>> MscHandler::_take_all_backends()
+{
+  QMutexLocker lock(&mMutex);
+  const TBackendListPtr pList = _get_backend_list();
+  auto pNewList = std::make_shared<SBackendList>();
+  pNewList->muxSubChannels = pList->muxSubChannels;
+  _publish_backend_list(std::move(pNewList));
+  return pList->backends;
+}
+
+void MscHandler::_stop_backends(const QVector<QSharedPointer<Backend>> & iBackends)
+{
+  for (const auto & b: iBackends)
   {
     b->stop_running();
-    b.reset();
   }
 }
 
 void MscHandler::reset_channel()
 {
   qDebug() << "Channel reset: all services will be stopped";
-  QVector<QSharedPointer<Backend>> backendsToStop;
-  {
-    QMutexLocker lock(&mMutex);
-    backendsToStop.swap(mBackendList);
-  }
-  for (auto & b: backendsToStop)
-  {
-    b->stop_running();
-    b.reset();
-  }
+  stop_full_multiplex();
+  _stop_backends(_take_all_backends());
 }
 
 void MscHandler::stop_service(const i32 iSubChId, const EProcessFlag iProcessFlag)
@@ -82,44 +115,46 @@ void MscHandler::stop_service(const i32 iSubChId, const EProcessFlag iProcessFla
   QVector<QSharedPointer<Backend>> backendsToStop;
   {
     QMutexLocker lock(&mMutex);
-    for (qsizetype i = 0; i < mBackendList.size(); i++)
+    const TBackendListPtr pList = _get_backend_list();
+    auto pNewList = std::make_shared<SBackendList>();
+    pNewList->muxSubChannels = pList->muxSubChannels;
+
+    for (const auto & b : pList->backends)
     {
-      if (auto & b = mBackendList[i];
-          b->subChId == iSubChId && b->processFlag == iProcessFlag)
+      if (b->subChId == iSubChId && b->processFlag == iProcessFlag)
       {
         qDebug() << "Stopping SubChannel" << iSubChId;
         backendsToStop.append(b);
-        mBackendList.removeAt(i);
-        --i; // we removed one element
+      }
+      else
+      {
+        pNewList->backends.append(b);
       }
     }
+
+    if (backendsToStop.isEmpty())
+    {
+      return;
+    }
+    _publish_backend_list(std::move(pNewList));
   }
-  for (auto & b: backendsToStop)
-  {
-    b->stop_running();
-    b.reset();
-  }
+  _stop_backends(backendsToStop);
 }
 
 void MscHandler::stop_all_services()
 {
-  QVector<QSharedPointer<Backend>> backendsToStop;
-  {
-    QMutexLocker lock(&mMutex);
-    backendsToStop.swap(mBackendList);
-  }
-  for (auto & b: backendsToStop)
+  const QVector<QSharedPointer<Backend>> backendsToStop = _take_all_backends();
+  for (const auto & b: backendsToStop)
   {
     qDebug() << "Stopping SId" << Qt::hex << Qt::showbase << b->serviceId << Qt::dec << "SubChannel" << b->subChId << "ProcessFlag" << (b->processFlag == EProcessFlag::Primary ? "Primary" : "Secondary");
-    b->stop_running();
-    b.reset();
   }
+  _stop_backends(backendsToStop);
 }
 
 bool MscHandler::is_service_running(const i32 iSubChId, const EProcessFlag iProcessFlag) const
 {
-  QMutexLocker lock(&mMutex);
-  for (const auto & b : mBackendList)
+  const TBackendListPtr pList = _get_backend_list();
+  for (const auto & b : pList->backends)
   {
     if (b->subChId == iSubChId && b->processFlag == iProcessFlag)
     {
@@ -131,27 +166,31 @@ bool MscHandler::is_service_running(const i32 iSubChId, const EProcessFlag iProc
 
 bool MscHandler::set_channel(const SDescriptorType * d, RingBuffer<i16> * ipoAudioBuffer, RingBuffer<u8> * ipoDataBuffer, const EProcessFlag iProcessFlag)
 {
-  qInfo() << "Create backend" << mBackendList.size() + 1 << "for SId" <<  Qt::hex << Qt::showbase << d->SId
+  qInfo() << "Create backend" << _get_backend_list()->backends.size() + 1 << "for SId" <<  Qt::hex << Qt::showbase << d->SId
           << "and ServiceLabel" << (d->serviceLabel.isEmpty() ? "(Unknown yet)" : d->serviceLabel.trimmed())
           << "Audio" << (ipoAudioBuffer != nullptr) << "Data" << (ipoDataBuffer != nullptr)
           << "ProcessFlag" << (iProcessFlag == EProcessFlag::Primary ? "Primary" : "Secondary");
 
+  // the backend is created before the lock is taken, so its (expensive) setup does not delay other list changes
+  const QSharedPointer<Backend> backend(new Backend(mpDabObserver, d, ipoAudioBuffer, ipoDataBuffer, mpFrameBuffer, iProcessFlag));
+
   QMutexLocker lock(&mMutex);
-  const QSharedPointer<Backend> backend(new Backend(mpRadioInterface, d, ipoAudioBuffer, ipoDataBuffer, mpFrameBuffer, iProcessFlag));
-  mBackendList.append(backend);
+  auto pNewList = std::make_shared<SBackendList>(*_get_backend_list());
+  pNewList->backends.append(backend);
+  _publish_backend_list(std::move(pNewList));
   return true;
 }
 
 // Add blocks. First is (should be) block 4, last is (should be) nrBlocks -1.
 // Note that this method is called from within the ofdm-processor thread while the set_xxx methods
-// are called from within the gui thread, so some locking is added.
+// are called from within the gui thread. It works lock-free on the currently published backend list.
 void MscHandler::process_block(const std::vector<i16> & iSoftBits, const i32 iBlockNr)
 {
   assert(iBlockNr >= 4);
   assert(iSoftBits.size() == c2K);
 
   const i32 curBlockIdx = (iBlockNr - 4) % cNumberOfBlocksPerCif;
-  memcpy(&mCifVector[curBlockIdx * c2K], iSoftBits.data(), c2K * sizeof(i16));
+  memcpy(&mpCifWrite[curBlockIdx * c2K], iSoftBits.data(), c2K * sizeof(i16));
 
   if (curBlockIdx < cNumberOfBlocksPerCif - 1)
   {
@@ -159,10 +198,176 @@ void MscHandler::process_block(const std::vector<i16> & iSoftBits, const i32 iBl
   }
 
   // OK, now we have a full CIF and it seems there is some work to be done.
-  // We assume that the backend itself does the work in a separate thread.
-  QMutexLocker lock(&mMutex);
-  for (const auto & b: mBackendList)
+  // The sub-channel fragments are handed over to the decode pool, which processes the backends concurrently.
+  // The backends only get a reference to the (now immutable) CIF, the next CIF is written into another buffer.
+  const TCifBufferPtr pCif = mCifRing.current_cif();
+  mpCifWrite = mCifRing.next_cif();
+
+  mPostEpoch.fetch_add(1, std::memory_order_seq_cst); // odd: posting
+  std::atomic_thread_fence(std::memory_order_seq_cst);  // the list must not be loaded before the epoch is odd (see _publish_backend_list())
+  {
+    const TBackendListPtr pList = _get_backend_list();
+    for (const auto & b: pList->backends)
+    {
+      mDecodePool.post_segment(b.data(), pCif, &(*pCif)[b->CuStartAddr * cCUSizeBits]);
+    }
+    for (const auto & m: pList->muxSubChannels)
+    {
+      mDecodePool.post_segment(m->pBackend.data(), pCif, &(*pCif)[m->pBackend->CuStartAddr * cCUSizeBits]);
+    }
+  }
+  mPostEpoch.fetch_add(1, std::memory_order_release); // even: done
+}
+
+// The descriptors are taken from the service components which use the sub-channel. For packet data only the first
+// component (packet address) of a sub-channel is decoded, further services in the same sub-channel are not served.
+// Sub-channels without known audio or packet service component (e.g. stream data) are not decoded.
+// The FIB data have to be loaded completely (S4_FullyPacketDataLoaded).
+i32 MscHandler::start_full_multiplex(const IFibDecoder * const ipFibDecoder)
+{
+  stop_full_multiplex();
+
+  // collect the first found audio or packet service component of each sub-channel
+  std::map<i16, SAudioData> audioMap;
+  std::map<i16, SPacketData> packetMap;
+
+  for (const auto & sl : ipFibDecoder->get_service_list())
+  {
+    if (sl.isAudioChannel)
+    {
+      SAudioData ad;
+      ipFibDecoder->get_data_for_audio_service(sl.SId, ad);
+      if (ad.isDefined)
+      {
+        audioMap.emplace(ad.SubChId, ad);
+      }
+    }
+
+    std::vector<SPacketData> pdVec;
+    ipFibDecoder->get_data_for_packet_service(sl.SId, pdVec); // also audio services can have packet data components (e.g. SPI)
+    for (const auto & pd : pdVec)
+    {
+      if (pd.isDefined)
+      {
+        packetMap.emplace(pd.SubChId, pd);
+      }
+    }
+  }
+
+  const std::vector<i8> subChIdList = ipFibDecoder->get_sub_channel_id_list();
+  std::vector<std::shared_ptr<SMuxSubChannel>> muxList;
+
+  for (const i8 subChId : subChIdList)
   {
-    b->process(&mCifVector[b->CuStartAddr * cCUSizeBits], b->CuSize * cCUSizeBits);
+    const SDescriptorType * pDesc = nullptr;
+
+    if (const auto itA = audioMap.find(subChId); itA != audioMap.end())
+    {
+      pDesc = &itA->second;
+    }
+    else if (const auto itP = packetMap.find(subChId); itP != packetMap.end())
+    {
+      pDesc = &itP->second;
+    }
+    else
+    {
+      qInfo() << "Full multiplex: no audio or packet service found for SubChannel" << subChId << "-> not decoded";
+      continue;
+    }
+
+    auto pMux = std::make_shared<SMuxSubChannel>();
+    pMux->SubChId = pDesc->SubChId;
+    pMux->SId = pDesc->SId;
+    pMux->serviceLabel = pDesc->serviceLabel.trimmed();
+    pMux->TMId = pDesc->TMId;
+    pMux->bitRate = pDesc->bitRate;
+    // no observer is given, so the GUI is not bothered with the results of sub-channels nobody has selected
+    pMux->pBackend.reset(new Backend(nullptr, pDesc, &pMux->pcmBuffer, &pMux->dataBuffer, &pMux->frameBuffer, EProcessFlag::Primary, &pMux->mscDataGroupBuffer));
+    muxList.emplace_back(std::move(pMux));
   }
+
+  qInfo() << "Full multiplex: decode" << muxList.size() << "of" << subChIdList.size() << "sub-channels";
+
+  const i32 numSubChannels = (i32)muxList.size();
+  mMuxLoadLastList.assign(muxList.size(), SMuxLoadLast());
+  mMuxLoadLastTime = std::chrono::steady_clock::now();
+  {
+    QMutexLocker lock(&mMutex);
+    auto pNewList = std::make_shared<SBackendList>(*_get_backend_list());
+    pNewList->muxSubChannels.swap(muxList);
+    _publish_backend_list(std::move(pNewList));
+  }
+  return numSubChannels;
+}
+
+void MscHandler::stop_full_multiplex()
+{
+  std::vector<std::shared_ptr<SMuxSubChannel>> muxToStop;
+  {
+    QMutexLocker lock(&mMutex);
+    if (!_get_backend_list()->muxSubChannels.empty())
+    {
+      auto pNewList = std::make_shared<SBackendList>(*_get_backend_list());
+      muxToStop.swap(pNewList->muxSubChannels);
+      _publish_backend_list(std::move(pNewList));
+    }
+  }
+  for (auto & m : muxToStop)
+  {
+    m->pBackend->stop_running();
+  }
+  mMuxLoadLastList.clear();
+}
+
+bool MscHandler::is_full_multiplex_running() const
+{
+  return !_get_backend_list()->muxSubChannels.empty();
+}
+
+std::vector<std::shared_ptr<MscHandler::SMuxSubChannel>> MscHandler::get_full_multiplex_sub_channels() const
+{
+  return _get_backend_list()->muxSubChannels;
+}
+
+// The CPU load relates the CPU time the workers spent for a sub-channel to the elapsed time, so the sum over all
+// sub-channels has to stay (well) below 100% * number of cores (see get_decode_pool_statistics()) to keep up in realtime.
+std::vector<MscHandler::SMuxLoad> MscHandler::get_full_multiplex_load()
+{
+  const std::vector<std::shared_ptr<SMuxSubChannel>> muxList = get_full_multiplex_sub_channels();
+  std::vector<SMuxLoad> loadList;
+
+  if (muxList.size() != mMuxLoadLastList.size()) // multiplex was (re)started in between
+  {
+    return loadList;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  const f64 elapsedNs = (f64)std::chrono::duration_cast<std::chrono::nanoseconds>(now - mMuxLoadLastTime).count();
+  mMuxLoadLastTime = now;
+
+  for (size_t i = 0; i < muxList.size(); i++)
+  {
+    const SMuxSubChannel & m = *muxList[i];
+    const Backend::SCpuLoad cl = m.pBackend->get_cpu_load();
+    SMuxLoadLast & last = mMuxLoadLastList[i];
+    const u64 segmentsDelta = cl.segmentsDone - last.segmentsDone;
+    const u64 cpuTimeDeltaNs = cl.cpuTimeNs - last.cpuTimeNs;
+
+    SMuxLoad l;
+    l.SubChId = m.SubChId;
+    l.SId = m.SId;
+    l.serviceLabel = m.serviceLabel;
+    l.bitRate = m.bitRate;
+    l.cpuLoadPercent = (elapsedNs > 0 ? (f32)(100.0 * (f64)cpuTimeDeltaNs / elapsedNs) : 0.0f);
+    l.decodeAvrUs = (segmentsDelta > 0 ? (f32)cpuTimeDeltaNs / (f32)segmentsDelta / 1000.0f : 0.0f);
+    l.decodeMaxUs = (f32)cl.cpuTimeMaxNs / 1000.0f;
+    l.segmentsDone = cl.segmentsDone;
+    l.segmentsDropped = cl.segmentsDropped;
+    loadList.emplace_back(l);
+
+    last.segmentsDone = cl.segmentsDone;
+    last.cpuTimeNs = cl.cpuTimeNs;
+  }
+
+  return loadList;
 }
@@ -25,18 +25,53 @@
 
 #include "dab_constants.h"
 #include "ringbuffer.h"
+#include "cif_decode_pool.h"
 #include <QVector>
 #include <QSharedPointer>
 #include <QMutex>
+#include <QString>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <vector>
 
-class DabRadio;
+class IDabObserver;
+class IFibDecoder;
 class Backend;
 
 class MscHandler
 {
 public:
-  MscHandler(DabRadio *, RingBuffer<u8> *);
+  // One sub-channel of the full multiplex decoding. The sinks are filled by the backend and can be read by a
+  // monitoring client. Nobody has to read them, a full sink just drops the new data.
+  struct SMuxSubChannel
+  {
+    i16 SubChId = -1;
+    u32 SId = 0;
+    QString serviceLabel;
+    ETMId TMId = ETMId::StreamModeAudio;
+    i16 bitRate = 0;
+    RingBuffer<i16> pcmBuffer{32768};          // decoded PCM audio (stereo interleaved)
+    RingBuffer<u8> frameBuffer{16384};         // AAC super frames or MP2 frames
+    RingBuffer<u8> mscDataGroupBuffer{32768};  // MSC data groups, each with a leading 16 bit byte length (big endian)
+    RingBuffer<u8> dataBuffer{32768};          // output of the IP and TDC data handlers
+    QSharedPointer<Backend> pBackend;
+  };
+
+  struct SMuxLoad
+  {
+    i16 SubChId;
+    u32 SId;
+    QString serviceLabel;
+    i16 bitRate;
+    f32 cpuLoadPercent;   // of one core since last call of get_full_multiplex_load()
+    f32 decodeAvrUs;      // average CPU time for one CIF segment (24ms of data) since last call
+    f32 decodeMaxUs;      // maximum CPU time for one CIF segment since last call
+    u64 segmentsDone;     // overall
+    u64 segmentsDropped;  // overall, not zero means the decoding did not keep up in realtime
+  };
+
+  MscHandler(IDabObserver *, RingBuffer<u8> *);
   ~MscHandler();
 
   void process_block(const std::vector<i16> & iSoftBits, i32 iBlockNr);
@@ -45,19 +80,51 @@ public:
   void stop_service(i32 iSubChId, EProcessFlag iProcessFlag);
   void stop_all_services();
   bool is_service_running(i32 iSubChId, EProcessFlag iProcessFlag) const;
+  CifDecodePool::SStatistics get_decode_pool_statistics() { return mDecodePool.get_statistics(); }
+
+  // Full multiplex decoding (for monitoring and CPU load measurements): each audio and packet data sub-channel of the
+  // ensemble is decoded in an own backend, independently of the services selected with set_channel().
+  i32 start_full_multiplex(const IFibDecoder * ipFibDecoder); // returns the number of decoded sub-channels
+  void stop_full_multiplex();
+  bool is_full_multiplex_running() const;
+  std::vector<std::shared_ptr<SMuxSubChannel>> get_full_multiplex_sub_channels() const;
+  std::vector<SMuxLoad> get_full_multiplex_load();
 
 private:
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   RingBuffer<u8> * const mpFrameBuffer;
 
-  mutable QMutex mMutex;
-  QVector<QSharedPointer<Backend>> mBackendList;
-  std::vector<i16> mCifVector;
+  // Immutable list of all running backends. A change creates a new list and publishes it as a whole (copy-on-write),
+  // so process_block() (OFDM thread) only takes a reference to the current list and never waits for the GUI thread.
+  struct SBackendList
+  {
+    QVector<QSharedPointer<Backend>> backends;
+    std::vector<std::shared_ptr<SMuxSubChannel>> muxSubChannels;
+  };
+  using TBackendListPtr = std::shared_ptr<const SBackendList>;
+
+  CifDecodePool mDecodePool; // declared before mpBackendList so it is destroyed after all backends are stopped
+  mutable QMutex mMutex;     // serializes the list modifications only, process_block() does not use it
+  TBackendListPtr mpBackendList; // only accessed via std::atomic_load_explicit() and std::atomic_exchange_explicit()
+  std::atomic<u32> mPostEpoch = 0; // incremented by process_block() before and after posting, odd while it posts
+  struct SMuxLoadLast
+  {
+    u64 segmentsDone = 0;
+    u64 cpuTimeNs = 0;
+  };
+  std::vector<SMuxLoadLast> mMuxLoadLastList; // same index as SBackendList::muxSubChannels, only accessed by get_full_multiplex_load()
+  std::chrono::steady_clock::time_point mMuxLoadLastTime;
+  CifBufferRing mCifRing;
+  i16 * mpCifWrite = nullptr; // CIF buffer currently filled by process_block()
   i16 mCifCount = 0;
   i16 mBlkCount = 0;
   i16 mBlockCount = 0;
 
   void processMsc(i32 n);
+  TBackendListPtr _get_backend_list() const { return std::atomic_load_explicit(&mpBackendList, std::memory_order_seq_cst); }
+  void _publish_backend_list(TBackendListPtr ipNewList);
+  QVector<QSharedPointer<Backend>> _take_all_backends();
+  void _stop_backends(const QVector<QSharedPointer<Backend>> & iBackends);
 };
 
 
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "reed_solomon_fast.h"
+#include "cpu_features.h"
+#include <cstring>
+#include <QDebug>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_SSSE3  __attribute__((target("ssse3")))
+#else
+  #define TARGET_SSSE3
+#endif
+
+/*
+ * Notes to the algorithm (it follows exactly the steps of ReedSolomon::decode_rs()):
+ * - The exp table covers four periods of the field, so the sum of up to three logarithms can be used as index
+ *   without modulo. The log of zero is marked with cA0 (like in the Galois class).
+ * - The received bytes are zero-padded in front to a multiple of 16 bytes (leading zeros do not change a syndrome).
+ *   For root i each block of 16 bytes is processed with one Horner step, i.e. the accumulator is multiplied with
+ *   alpha^(16 * i) and the next block is added. The multiplication with a constant is done with two 16 entry
+ *   tables, one for the low and one for the high nibble of each byte (pshufb / tbl). At the end the 16 lanes
+ *   are combined with a scalar Horner step with alpha^i.
+ * - The Chien search stops when deg(lambda) roots are found, as a polynomial cannot have more roots.
+ */
+
+static constexpr i16 cNumRoots = ReedSolomonFast::cNumRoots;
+static constexpr i16 cCodeLength = ReedSolomonFast::cCodeLength;
+static constexpr u8 cA0 = (u8)cCodeLength; // log(0)
+static constexpr u16 cGfPoly = 0x11D;     // x^8 + x^4 + x^3 + x^2 + 1 (0435)
+
+struct SGfTables
+{
+  u8 exp[4 * cCodeLength];
+  u8 log[cCodeLength + 1];
+  alignas(16) u8 mulLo[cNumRoots][16]; // x * alpha^(16 * root) for x = 0x00..0x0F
+  alignas(16) u8 mulHi[cNumRoots][16]; // x * alpha^(16 * root) for x = 0x00..0xF0
+};
+
+static constexpr SGfTables make_gf_tables()
+{
+  SGfTables t{};
+  u16 sr = 1;
+
+  for (i32 i = 0; i < cCodeLength; i++)
+  {
+    t.log[sr] = (u8)i;
+    for (i32 p = 0; p < 4; p++)
+    {
+      t.exp[i + p * cCodeLength] = (u8)sr;
+    }
+    sr <<= 1;
+    if (sr & 0x100)
+    {
+      sr ^= cGfPoly;
+    }
+  }
+  t.log[0] = cA0;
+
+  for (i32 root = 0; root < cNumRoots; root++)
+  {
+    const u8 logFactor = t.log[t.exp[16 * root]];
+
+    for (i32 x = 1; x < 16; x++)
+    {
+      t.mulLo[root][x] = t.exp[t.log[x] + logFactor];
+      t.mulHi[root][x] = t.exp[t.log[x << 4] + logFactor];
+    }
+  }
+  return t;
+}
+
+static constexpr SGfTables cGf = make_gf_tables();
+
+static inline u8 gf_mul(const u8 iA, const u8 iB)
+{
+  return (iA == 0 || iB == 0) ? 0 : cGf.exp[cGf.log[iA] + cGf.log[iB]];
+}
+
+static inline u8 gf_div(const u8 iA, const u8 iB) // iB must not be zero
+{
+  return (iA == 0) ? 0 : cGf.exp[cGf.log[iA] + cCodeLength - cGf.log[iB]];
+}
+
+// returns the polynomial iPoly[0] + iPoly[1] * x + ... + iPoly[iDegree] * x^iDegree (all in poly form) at x = alpha^iLogX
+static inline u8 gf_poly_eval(const u8 * const iPoly, const i16 iDegree, const u8 iLogX)
+{
+  u8 res = iPoly[iDegree];
+
+  for (i16 i = iDegree - 1; i >= 0; i--)
+  {
+    res = (res == 0 ? 0 : cGf.exp[cGf.log[res] + iLogX]) ^ iPoly[i];
+  }
+  return res;
+}
+
+// combines the 16 lanes of the block-wise Horner scheme: S = sum(iLanes[l] * alpha^(iRoot * (15 - l)))
+static inline u8 combine_lanes(const u8 * const iLanes, const i32 iRoot)
+{
+  u8 syn = 0;
+
+  for (i32 l = 0; l < 16; l++)
+  {
+    syn = (syn == 0 ? 0 : cGf.exp[cGf.log[syn] + iRoot]) ^ iLanes[l];
+  }
+  return syn;
+}
+
+// ipData has iNumBlocks * 16 bytes, returns true if all syndromes are zero
+using TSyndromeKernel = ReedSolomonFast::TSyndromeKernel;
+
+static bool syndromes_scalar(const u8 * const ipData, const i32 iNumBlocks, u8 * const opSyndromes)
+{
+  u8 synOr = 0;
+
+  for (i32 root = 0; root < cNumRoots; root++)
+  {
+    u8 syn = 0;
+
+    for (i32 j = 0; j < iNumBlocks * 16; j++)
+    {
+      syn = (syn == 0 ? 0 : cGf.exp[cGf.log[syn] + root]) ^ ipData[j];
+    }
+    opSyndromes[root] = syn;
+    synOr |= syn;
+  }
+  return synOr == 0;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TARGET_SSSE3 static bool syndromes_ssse3(const u8 * const ipData, const i32 iNumBlocks, u8 * const opSyndromes)
+{
+  const __m128i maskLo = _mm_set1_epi8(0x0F);
+  alignas(16) u8 lanes[16];
+  u8 synOr = 0;
+
+  for (i32 root = 0; root < cNumRoots; root++)
+  {
+    const __m128i tabLo = _mm_load_si128((const __m128i *)cGf.mulLo[root]);
+    const __m128i tabHi = _mm_load_si128((const __m128i *)cGf.mulHi[root]);
+    __m128i acc = _mm_loadu_si128((const __m128i *)ipData);
+
+    for (i32 blk = 1; blk < iNumBlocks; blk++)
+    {
+      const __m128i lo = _mm_shuffle_epi8(tabLo, _mm_and_si128(acc, maskLo));
+      const __m128i hi = _mm_shuffle_epi8(tabHi, _mm_and_si128(_mm_srli_epi64(acc, 4), maskLo));
+      acc = _mm_xor_si128(_mm_xor_si128(lo, hi), _mm_loadu_si128((const __m128i *)(ipData + 16 * blk)));
+    }
+
+    _mm_store_si128((__m128i *)lanes, acc);
+    opSyndromes[root] = combine_lanes(lanes, root);
+    synOr |= opSyndromes[root];
+  }
+  return synOr == 0;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static bool syndromes_neon(const u8 * const ipData, const i32 iNumBlocks, u8 * const opSyndromes)
+{
+  const uint8x16_t maskLo = vdupq_n_u8(0x0F);
+  alignas(16) u8 lanes[16];
+  u8 synOr = 0;
+
+  for (i32 root = 0; root < cNumRoots; root++)
+  {
+    const uint8x16_t tabLo = vld1q_u8(cGf.mulLo[root]);
+    const uint8x16_t tabHi = vld1q_u8(cGf.mulHi[root]);
+    uint8x16_t acc = vld1q_u8(ipData);
+
+    for (i32 blk = 1; blk < iNumBlocks; blk++)
+    {
+      const uint8x16_t lo = vqtbl1q_u8(tabLo, vandq_u8(acc, maskLo));
+      const uint8x16_t hi = vqtbl1q_u8(tabHi, vshrq_n_u8(acc, 4));
+      acc = veorq_u8(veorq_u8(lo, hi), vld1q_u8(ipData + 16 * blk));
+    }
+
+    vst1q_u8(lanes, acc);
+    opSyndromes[root] = combine_lanes(lanes, root);
+    synOr |= opSyndromes[root];
+  }
+  return synOr == 0;
+}
+
+#endif
+
+struct SSyndromeKernel
+{
+  TSyndromeKernel pFunc;
+  const char * pName;
+};
+
+static const SSyndromeKernel & get_syndrome_kernel()
+{
+  static const SSyndromeKernel kernel = []() -> SSyndromeKernel
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (CpuFeatures::has_ssse3()) return { syndromes_ssse3, "SSSE3" };
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (CpuFeatures::has_neon()) return { syndromes_neon, "NEON" };
+#endif
+    return { syndromes_scalar, "Scalar" };
+  }();
+  return kernel;
+}
+
+ReedSolomonFast::ReedSolomonFast(const bool iUseSimd)
+  : mpSyndromeKernel(iUseSimd ? get_syndrome_kernel().pFunc : syndromes_scalar)
+{
+  qInfo("Using %s for Reed-Solomon syndromes", iUseSimd ? get_syndrome_kernel().pName : "Scalar");
+}
+
+i16 ReedSolomonFast::dec(const u8 * const ipDataIn, u8 * const opDataOut, const i16 iCutLen) const
+{
+  const i32 dataLen = cCodeLength - iCutLen;              // received symbols incl. parity
+  const i32 numBlocks = (dataLen + 15) / 16;
+  const i32 padLen = numBlocks * 16 - dataLen;
+  alignas(16) u8 padded[256];
+
+  memset(padded, 0, padLen);
+  memcpy(padded + padLen, ipDataIn, dataLen);
+  memcpy(opDataOut, ipDataIn, dataLen - cNumRoots);
+
+  // Step 1: syndromes (poly form)
+  u8 syndromes[cNumRoots];
+
+  if (mpSyndromeKernel(padded, numBlocks, syndromes))
+  {
+    return 0;
+  }
+
+  // Step 2: Berlekamp-Massey, lambda in poly form
+  u8 lambda[cNumRoots + 1] = {};
+  u8 corrector[cNumRoots] = {};
+  u8 error = syndromes[0];
+  u16 L = 0;
+
+  lambda[0] = 1;
+  corrector[1] = 1;
+
+  for (i16 K = 1; K < cNumRoots; K++)
+  {
+    u8 oldLambda[cNumRoots];
+    memcpy(oldLambda, lambda, cNumRoots);
+
+    for (i16 i = 0; i < cNumRoots; i++)
+    {
+      lambda[i] ^= gf_mul(error, corrector[i]);
+    }
+    if ((2 * L < K) && (error != 0))
+    {
+      L = K - L;
+      for (i16 i = 0; i < cNumRoots; i++)
+      {
+        corrector[i] = gf_div(oldLambda[i], error);
+      }
+    }
+
+    memmove(&corrector[1], &corrector[0], cNumRoots - 1); // x * C(x)
+    corrector[0] = 0;
+
+    error = syndromes[K];
+    for (i16 i = 1; i <= K; i++)
+    {
+      error ^= gf_mul(syndromes[K - i], lambda[i]);
+    }
+  }
+
+  i16 lambdaDegree = 0;
+
+  for (i16 i = 0; i < cNumRoots; i++)
+  {
+    lambda[i] ^= gf_mul(error, corrector[i]);
+    if (lambda[i] != 0)
+    {
+      lambdaDegree = i;
+    }
+  }
+
+  // Step 3: Chien search, the working register holds lambda[j] * alpha^(j * i) in power form
+  u16 workReg[cNumRoots];
+  u8 rootTable[cNumRoots];
+  i16 locTable[cNumRoots];
+  i16 rootCount = 0;
+
+  for (i16 j = 1; j <= lambdaDegree; j++)
+  {
+    workReg[j] = cGf.log[lambda[j]];
+  }
+
+  for (i16 i = 1; i <= cCodeLength && rootCount < lambdaDegree; i++)
+  {
+    u8 result = 1; // lambda[0] is always 1
+
+    for (i16 j = lambdaDegree; j > 0; j--)
+    {
+      if (workReg[j] != cA0)
+      {
+        workReg[j] += j;
+        if (workReg[j] >= cCodeLength)
+        {
+          workReg[j] -= cCodeLength;
+        }
+        result ^= cGf.exp[workReg[j]];
+      }
+    }
+
+    if (result == 0)
+    {
+      rootTable[rootCount] = (u8)i;
+      locTable[rootCount] = i - 1;
+      rootCount++;
+    }
+  }
+
+  if (rootCount != lambdaDegree)
+  {
+    return -1;
+  }
+
+  // Step 4: error evaluator omega(x) = s(x) * lambda(x) mod x^nroots (poly form)
+  u8 omega[cNumRoots];
+  i16 omegaDegree = 0;
+
+  for (i16 i = 0; i < cNumRoots; i++)
+  {
+    u8 tmp = 0;
+
+    for (i16 j = (lambdaDegree < i ? lambdaDegree : i); j >= 0; j--)
+    {
+      tmp ^= gf_mul(syndromes[i - j], lambda[j]);
+    }
+    if (tmp != 0)
+    {
+      omegaDegree = i;
+    }
+    omega[i] = tmp;
+  }
+
+  // Step 5: Forney, error value = omega(X^-1) * X^-1 / lambda'(X^-1) with X^-1 = alpha^root (fcr = 0)
+  u8 lambdaDeriv[cNumRoots / 2]; // the odd coefficients of lambda are the even ones of the formal derivative
+  const i16 lambdaDerivDegree = ((lambdaDegree < cNumRoots - 1 ? lambdaDegree : cNumRoots - 1) & ~1) / 2;
+
+  for (i16 i = 0; i <= lambdaDerivDegree; i++)
+  {
+    lambdaDeriv[i] = lambda[2 * i + 1];
+  }
+
+  i16 numCorrections = rootCount;
+
+  for (i16 j = rootCount - 1; j >= 0; j--)
+  {
+    const u8 root = rootTable[j];
+    const u8 num1 = gf_poly_eval(omega, omegaDegree, root);
+    const u8 den = gf_poly_eval(lambdaDeriv, lambdaDerivDegree, cGf.log[cGf.exp[2 * root]]);
+
+    if (den == 0)
+    {
+      return -1;
+    }
+
+    if (num1 != 0)
+    {
+      if (locTable[j] >= cCodeLength - cNumRoots)
+      {
+        numCorrections--; // error within the parity symbols
+      }
+      else if (locTable[j] >= iCutLen) // an error within the padding would only touch a (virtual) zero
+      {
+        opDataOut[locTable[j] - iCutLen] ^= cGf.exp[cGf.log[num1] + (cCodeLength - root) + (cCodeLength - cGf.log[den])];
+      }
+    }
+  }
+
+  return numCorrections;
+}
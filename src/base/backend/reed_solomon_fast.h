@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "glob_data_types.h"
+
+/*
+ * Reed-Solomon decoder for the shortened RS(255,245) code of the DAB+ superframes (ETSI TS 102 563), which is
+ * used as RS(120,110) with a cut length of 135. The field is GF(2^8) with the polynomial 0x11D, fcr = 0, prim = 1.
+ * It delivers the same results as ReedSolomon(8, 0435, 0, 1, 10).dec() (same corrected data and same return value),
+ * but works with log/antilog tables without any modulo operation, computes the syndromes with SIMD (SSSE3 or NEON,
+ * chosen at runtime) and returns immediately if all syndromes are zero (which is the normal case on a good signal).
+ */
+class ReedSolomonFast
+{
+public:
+  using TSyndromeKernel = bool (*)(const u8 * ipData, i32 iNumBlocks, u8 * opSyndromes);
+
+  explicit ReedSolomonFast(bool iUseSimd = true); // iUseSimd = false forces the scalar syndrome kernel (for tests)
+  ~ReedSolomonFast() = default;
+
+  // returns the number of corrected symbols or -1 if the codeword could not be corrected
+  i16 dec(const u8 * ipDataIn, u8 * opDataOut, i16 iCutLen) const;
+
+  static constexpr i16 cNumRoots = 10;
+  static constexpr i16 cCodeLength = 255;
+
+private:
+  TSyndromeKernel mpSyndromeKernel;
+};
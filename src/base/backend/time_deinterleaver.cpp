@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "time_deinterleaver.h"
+#include <cassert>
+
+TimeDeInterleaver::TimeDeInterleaver(const i32 iFragmentSize)
+  : mBlockSize(iFragmentSize / 16)
+{
+  assert(iFragmentSize % 16 == 0);
+  i32 ringSize = 0;
+
+  for (i32 r = 0; r < 16; r++)
+  {
+    mDelay[r] = (i16)(16 - cInterleaveMap[r]);
+    mGroupStart[r] = ringSize;
+    ringSize += mDelay[r] * mBlockSize;
+  }
+  mRing.resize(ringSize, 0);
+}
+
+void TimeDeInterleaver::process(const i16 * const ipIn, i16 * const opOut)
+{
+  // the oldest block of each residue group is read out and overwritten by the new soft bits in the same pass
+  std::array<i16 *, 16> pBlock;
+
+  for (i32 r = 0; r < 16; r++)
+  {
+    pBlock[r] = &mRing[mGroupStart[r] + mGroupPos[r] * mBlockSize];
+  }
+
+  for (i32 k = 0; k < mBlockSize; k++)
+  {
+    for (i32 r = 0; r < 16; r++)
+    {
+      opOut[16 * k + r] = pBlock[r][k];
+      pBlock[r][k] = ipIn[16 * k + r];
+    }
+  }
+
+  for (i32 r = 0; r < 16; r++)
+  {
+    if (++mGroupPos[r] >= mDelay[r])
+    {
+      mGroupPos[r] = 0;
+    }
+  }
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "glob_data_types.h"
+#include <array>
+#include <vector>
+
+// Time de-interleaver of the MSC sub-channels (ETSI EN 300 401 clause 12). The soft bit with the index i of a fragment
+// is delayed by 16 - cInterleaveMap[i & 15] fragments (CIFs). One contiguous ring is used: the soft bits of residue r
+// (index & 15) only keep that many blocks of fragmentSize/16 values (136 instead of 256 blocks for a full copy per CIF).
+class TimeDeInterleaver
+{
+public:
+  static constexpr std::array<i16, 16> cInterleaveMap = { 0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15 };
+
+  explicit TimeDeInterleaver(i32 iFragmentSize); // iFragmentSize has to be a multiple of 16
+  ~TimeDeInterleaver() = default;
+
+  // takes the next fragment and delivers the de-interleaved one, the first 15 outputs are incomplete (zero filled)
+  void process(const i16 * ipIn, i16 * opOut);
+  [[nodiscard]] i32 get_ring_size() const { return (i32)mRing.size(); }
+
+private:
+  const i32 mBlockSize;
+  std::vector<i16> mRing;
+  std::array<i32, 16> mGroupStart{};
+  std::array<i16, 16> mDelay{};
+  std::array<i16, 16> mGroupPos{};
+};
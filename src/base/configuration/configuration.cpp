@@ -63,6 +63,8 @@ Configuration::Configuration(DabRadio * ipRI) :
   Settings::Config::sbTiiSubId.register_widget_and_update_ui_from_setting(sbTiiSubId, 2);
   Settings::Config::cbCloseDirect.register_widget_and_update_ui_from_setting(cbCloseDirect, 2);
   Settings::Config::cbUseStrongestPeak.register_widget_and_update_ui_from_setting(cbUseStrongestPeak, 0);
+  Settings::Config::cbUseFusedOfdmKernel.register_widget_and_update_ui_from_setting(cbUseFusedOfdmKernel, 2);
+  Settings::Config::cbDecodeFullMultiplex.register_widget_and_update_ui_from_setting(cbDecodeFullMultiplex, 0);
   Settings::Config::cbUseNativeFileDialog.register_widget_and_update_ui_from_setting(cbUseNativeFileDialog, 0);
   Settings::Config::cbUseNativeIqFormat.register_widget_and_update_ui_from_setting(cbUseNativeIqFormat, 2);
   Settings::Config::cbUseUtcTime.register_widget_and_update_ui_from_setting(cbUseUtcTime, 0);
@@ -44,104 +44,154 @@ void FibConfigFig0::reset()
   Fig0s13_UserApplicationInformationVec.clear();
   Fig0s14_SubChannelOrganizationVec.clear();
   Fig0s17_ProgrammeTypeVec.clear();
+
+  mFig0s1_SubChId_Index.clear();
+  mFig0s2_SId_Index.clear();
+  mFig0s2_SId_ScIdx_Index.clear();
+  mFig0s2_SId_TMId_Index.clear();
+  mFig0s2_SCId_Index.clear();
+  mFig0s3_SCId_Index.clear();
+  mFig0s5_SubChId_Index.clear();
+  mFig0s5_SCId_Index.clear();
+  mFig0s8_SId_SCIdS_Index.clear();
+  mFig0s8_SId_with_SubChId_Index.clear();
+  mFig0s8_SId_with_SCId_Index.clear();
+  mFig0s13_SId_SCIdS_Index.clear();
+  mFig0s14_SubChId_Index.clear();
+  mFig0s17_SId_Index.clear();
 }
 
-const FibConfigFig0::SFig0s1_BasicSubChannelOrganization * FibConfigFig0::get_Fig0s1_BasicSubChannelOrganization_of_SubChId(const i32 iSubChId) const
+// The index maps are filled with emplace(), which keeps an already existing entry, so a lookup returns the first added
+// element with the given key (the same result the former linear searches delivered).
+void FibConfigFig0::add_Fig0s1_BasicSubChannelOrganization(const SFig0s1_BasicSubChannelOrganization & iFig0s1)
 {
-  for (auto & fig0s1 : Fig0s1_BasicSubChannelOrganizationVec)
+  const i32 idx = (i32)Fig0s1_BasicSubChannelOrganizationVec.size();
+  Fig0s1_BasicSubChannelOrganizationVec.emplace_back(iFig0s1);
+  mFig0s1_SubChId_Index.emplace(get_index_key(iFig0s1.SubChId), idx);
+}
+
+void FibConfigFig0::add_Fig0s2_BasicService_ServiceCompDef(const SFig0s2_BasicService_ServiceCompDef & iFig0s2)
+{
+  const i32 idx = (i32)Fig0s2_BasicService_ServiceCompDefVec.size();
+  Fig0s2_BasicService_ServiceCompDefVec.emplace_back(iFig0s2);
+  const u32 SId = iFig0s2.get_SId();
+  mFig0s2_SId_Index.emplace(get_index_key(SId), idx);
+  mFig0s2_SId_ScIdx_Index.emplace(get_index_key(SId, iFig0s2.ServiceComp_C_index), idx);
+  mFig0s2_SId_TMId_Index.emplace(get_index_key(SId, iFig0s2.ServiceComp_C.TMId), idx);
+
+  if (iFig0s2.ServiceComp_C.TMId == ETMId::PacketModeData)
   {
-    if (fig0s1.SubChId == iSubChId)
-    {
-      return &fig0s1;
-    }
+    mFig0s2_SCId_Index.emplace(get_index_key(iFig0s2.ServiceComp_C.TMId11.SCId), idx);
   }
-  return nullptr;
 }
 
-const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SId(const u32 iSId) const
+void FibConfigFig0::add_Fig0s3_ServiceComponentPacketMode(const SFig0s3_ServiceComponentPacketMode & iFig0s3)
 {
-  for (const auto & fig0s2 : Fig0s2_BasicService_ServiceCompDefVec)
+  const i32 idx = (i32)Fig0s3_ServiceComponentPacketModeVec.size();
+  Fig0s3_ServiceComponentPacketModeVec.emplace_back(iFig0s3);
+  mFig0s3_SCId_Index.emplace(get_index_key(iFig0s3.SCId), idx);
+}
+
+void FibConfigFig0::add_Fig0s5_ServiceComponentLanguage(const SFig0s5_ServiceComponentLanguage & iFig0s5)
+{
+  const i32 idx = (i32)Fig0s5_ServiceComponentLanguageVec.size();
+  Fig0s5_ServiceComponentLanguageVec.emplace_back(iFig0s5);
+
+  if (iFig0s5.LS_Flag == 0)
   {
-    const u32 SId = (fig0s2.PD_Flag == 0 ? fig0s2.PD0.SId : fig0s2.PD1.SId);
-    if (SId == iSId)
-    {
-      return &fig0s2;
-    }
+    mFig0s5_SubChId_Index.emplace(get_index_key(iFig0s5.SubChId), idx);
+  }
+  else if (iFig0s5.LS_Flag == 1)
+  {
+    mFig0s5_SCId_Index.emplace(get_index_key(iFig0s5.SCId), idx);
   }
-  return nullptr;
 }
 
-const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SId_ScIdx(const u32 iSId, const i32 iScIdx) const
+void FibConfigFig0::add_Fig0s7_ConfigurationInformation(const SFig0s7_ConfigurationInformation & iFig0s7)
 {
-  for (auto & fig0s2 : Fig0s2_BasicService_ServiceCompDefVec)
+  Fig0s7_ConfigurationInformationVec.emplace_back(iFig0s7);
+}
+
+void FibConfigFig0::add_Fig0s8_ServiceCompGlobalDef(const SFig0s8_ServiceCompGlobalDef & iFig0s8)
+{
+  const i32 idx = (i32)Fig0s8_ServiceCompGlobalDefVec.size();
+  Fig0s8_ServiceCompGlobalDefVec.emplace_back(iFig0s8);
+  mFig0s8_SId_SCIdS_Index.emplace(get_index_key(iFig0s8.SId, iFig0s8.SCIdS), idx);
+
+  if (iFig0s8.LS_Flag == 0)
   {
-    const u32 SId = fig0s2.get_SId();
-    if (SId == iSId && fig0s2.ServiceComp_C_index == iScIdx)
-    {
-      return &fig0s2;
-    }
+    mFig0s8_SId_with_SubChId_Index.emplace(get_index_key(iFig0s8.SId), idx);
   }
-  return nullptr;
+  else if (iFig0s8.LS_Flag == 1)
+  {
+    mFig0s8_SId_with_SCId_Index.emplace(get_index_key(iFig0s8.SId), idx);
+  }
+}
+
+void FibConfigFig0::add_Fig0s9_CountryLtoInterTab(const SFig0s9_CountryLtoInterTab & iFig0s9)
+{
+  Fig0s9_CountryLtoInterTabVec.emplace_back(iFig0s9);
+}
+
+void FibConfigFig0::add_Fig0s13_UserApplicationInformation(const SFig0s13_UserApplicationInformation & iFig0s13)
+{
+  const i32 idx = (i32)Fig0s13_UserApplicationInformationVec.size();
+  Fig0s13_UserApplicationInformationVec.emplace_back(iFig0s13);
+  mFig0s13_SId_SCIdS_Index.emplace(get_index_key(iFig0s13.SId, iFig0s13.SCIdS), idx);
+}
+
+void FibConfigFig0::add_Fig0s14_SubChannelOrganization(const SFig0s14_SubChannelOrganization & iFig0s14)
+{
+  const i32 idx = (i32)Fig0s14_SubChannelOrganizationVec.size();
+  Fig0s14_SubChannelOrganizationVec.emplace_back(iFig0s14);
+  mFig0s14_SubChId_Index.emplace(get_index_key(iFig0s14.SubChId), idx);
+}
+
+void FibConfigFig0::add_Fig0s17_ProgrammeType(const SFig0s17_ProgrammeType & iFig0s17)
+{
+  const i32 idx = (i32)Fig0s17_ProgrammeTypeVec.size();
+  Fig0s17_ProgrammeTypeVec.emplace_back(iFig0s17);
+  mFig0s17_SId_Index.emplace(get_index_key(iFig0s17.SId), idx);
+}
+
+const FibConfigFig0::SFig0s1_BasicSubChannelOrganization * FibConfigFig0::get_Fig0s1_BasicSubChannelOrganization_of_SubChId(const i32 iSubChId) const
+{
+  return find_in_index(mFig0s1_SubChId_Index, Fig0s1_BasicSubChannelOrganizationVec, get_index_key(iSubChId));
+}
+
+const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SId(const u32 iSId) const
+{
+  return find_in_index(mFig0s2_SId_Index, Fig0s2_BasicService_ServiceCompDefVec, get_index_key(iSId));
+}
+
+const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SId_ScIdx(const u32 iSId, const i32 iScIdx) const
+{
+  return find_in_index(mFig0s2_SId_ScIdx_Index, Fig0s2_BasicService_ServiceCompDefVec, get_index_key(iSId, iScIdx));
 }
 
 const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SCId(i16 SCId) const
 {
-  for (auto & fig0s2 : Fig0s2_BasicService_ServiceCompDefVec)
-  {
-    if (fig0s2.ServiceComp_C.TMId == ETMId::PacketModeData && fig0s2.ServiceComp_C.TMId11.SCId == SCId)
-    {
-      return &fig0s2;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s2_SCId_Index, Fig0s2_BasicService_ServiceCompDefVec, get_index_key(SCId));
 }
 
 const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef * FibConfigFig0::get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(u32 iSId, u8 iTMId) const
 {
-  for (auto & fig0s2 : Fig0s2_BasicService_ServiceCompDefVec)
-  {
-    if (fig0s2.get_SId() == iSId && fig0s2.ServiceComp_C.TMId == iTMId)
-    {
-      return &fig0s2;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s2_SId_TMId_Index, Fig0s2_BasicService_ServiceCompDefVec, get_index_key(iSId, iTMId));
 }
 
 const FibConfigFig0::SFig0s3_ServiceComponentPacketMode * FibConfigFig0::get_Fig0s3_ServiceComponentPacketMode_of_SCId(const i32 iSCId) const
 {
-  for (auto & fig0s3 : Fig0s3_ServiceComponentPacketModeVec)
-  {
-    if (fig0s3.SCId == iSCId)
-    {
-      return &fig0s3;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s3_SCId_Index, Fig0s3_ServiceComponentPacketModeVec, get_index_key(iSCId));
 }
 
 const FibConfigFig0::SFig0s5_ServiceComponentLanguage * FibConfigFig0::get_Fig0s5_ServiceComponentLanguage_of_SubChId(u8 iSubChId) const
 {
-  for (auto & fig0s5 : Fig0s5_ServiceComponentLanguageVec)
-  {
-    if (fig0s5.LS_Flag == 0 && fig0s5.SubChId == iSubChId)
-    {
-      return &fig0s5;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s5_SubChId_Index, Fig0s5_ServiceComponentLanguageVec, get_index_key(iSubChId));
 }
 
 const FibConfigFig0::SFig0s5_ServiceComponentLanguage * FibConfigFig0::get_Fig0s5_ServiceComponentLanguage_of_SCId(u8 iSCId) const
 {
-  for (auto & fig0s5 : Fig0s5_ServiceComponentLanguageVec)
-  {
-    if (fig0s5.LS_Flag == 1 && fig0s5.SCId == iSCId)
-    {
-      return &fig0s5;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s5_SCId_Index, Fig0s5_ServiceComponentLanguageVec, get_index_key(iSCId));
 }
 
 const FibConfigFig0::SFig0s7_ConfigurationInformation * FibConfigFig0::get_Fig0s7_ConfigurationInformation() const
@@ -155,38 +205,17 @@ const FibConfigFig0::SFig0s7_ConfigurationInformation * FibConfigFig0::get_Fig0s
 
 const FibConfigFig0::SFig0s8_ServiceCompGlobalDef * FibConfigFig0::get_Fig0s8_ServiceCompGlobalDef_of_SId_SCIdS(u32 iSId, u8 iSCIdS) const
 {
-  for (auto & fig0s8 : Fig0s8_ServiceCompGlobalDefVec)
-  {
-    if (fig0s8.SId == iSId && fig0s8.SCIdS == iSCIdS)
-    {
-      return &fig0s8;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s8_SId_SCIdS_Index, Fig0s8_ServiceCompGlobalDefVec, get_index_key(iSId, iSCIdS));
 }
 
 const FibConfigFig0::SFig0s8_ServiceCompGlobalDef * FibConfigFig0::get_Fig0s8_ServiceCompGlobalDef_of_SId_with_SubChId(const u32 iSId) const
 {
-  for (auto & fig0s8 : Fig0s8_ServiceCompGlobalDefVec)
-  {
-    if (fig0s8.LS_Flag == 0 && fig0s8.SId == iSId) // only entries with SubChId
-    {
-      return &fig0s8;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s8_SId_with_SubChId_Index, Fig0s8_ServiceCompGlobalDefVec, get_index_key(iSId)); // only entries with SubChId
 }
 
 const FibConfigFig0::SFig0s8_ServiceCompGlobalDef * FibConfigFig0::get_Fig0s8_ServiceCompGlobalDef_of_SId_with_SCId(const u32 iSId) const
 {
-  for (auto & fig0s8 : Fig0s8_ServiceCompGlobalDefVec)
-  {
-    if (fig0s8.LS_Flag == 1 && fig0s8.SId == iSId) // only entries with SCId
-    {
-      return &fig0s8;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s8_SId_with_SCId_Index, Fig0s8_ServiceCompGlobalDefVec, get_index_key(iSId)); // only entries with SCId
 }
 
 const FibConfigFig0::SFig0s9_CountryLtoInterTab * FibConfigFig0::get_Fig0s9_CountryLtoInterTab() const
@@ -200,38 +229,17 @@ const FibConfigFig0::SFig0s9_CountryLtoInterTab * FibConfigFig0::get_Fig0s9_Coun
 
 const FibConfigFig0::SFig0s13_UserApplicationInformation * FibConfigFig0::get_Fig0s13_UserApplicationInformation_of_SId_SCIdS(const u32 iSId, const i32 iSCIdS) const
 {
-  for (auto & fig0s13 : Fig0s13_UserApplicationInformationVec)
-  {
-    if (fig0s13.SId == iSId && fig0s13.SCIdS == iSCIdS)
-    {
-      return &fig0s13;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s13_SId_SCIdS_Index, Fig0s13_UserApplicationInformationVec, get_index_key(iSId, iSCIdS));
 }
 
 const FibConfigFig0::SFig0s14_SubChannelOrganization * FibConfigFig0::get_Fig0s14_SubChannelOrganization_of_SubChId(const i32 iSubChId) const
 {
-  for (auto & fig0s14 : Fig0s14_SubChannelOrganizationVec)
-  {
-    if (fig0s14.SubChId == iSubChId)
-    {
-      return &fig0s14;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s14_SubChId_Index, Fig0s14_SubChannelOrganizationVec, get_index_key(iSubChId));
 }
 
 const FibConfigFig0::SFig0s17_ProgrammeType * FibConfigFig0::get_Fig0s17_ProgrammeType_of_SId(u16 iSId) const
 {
-  for (auto & fig0s17 : Fig0s17_ProgrammeTypeVec)
-  {
-    if (fig0s17.SId == iSId)
-    {
-      return &fig0s17;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig0s17_SId_Index, Fig0s17_ProgrammeTypeVec, get_index_key(iSId));
 }
 
 void FibConfigFig0::print_Fig0s1_BasicSubChannelOrganization(SStatistic & ioS, const bool iCollectStatisticsOnly) const
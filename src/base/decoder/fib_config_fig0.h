@@ -221,16 +221,20 @@ public:
     i8  IntCode = -1; // this 5-bit field shall specify the basic Programme Type (PTy) category. This code is chosen from an international table (see clause 8.1.3.2).
   };
 
-  std::vector<SFig0s1_BasicSubChannelOrganization> Fig0s1_BasicSubChannelOrganizationVec;
-  std::vector<SFig0s2_BasicService_ServiceCompDef> Fig0s2_BasicService_ServiceCompDefVec;
-  std::vector<SFig0s3_ServiceComponentPacketMode>  Fig0s3_ServiceComponentPacketModeVec;
-  std::vector<SFig0s5_ServiceComponentLanguage>    Fig0s5_ServiceComponentLanguageVec;
-  std::vector<SFig0s7_ConfigurationInformation>    Fig0s7_ConfigurationInformationVec; // there is only a vector length of one possible
-  std::vector<SFig0s8_ServiceCompGlobalDef>        Fig0s8_ServiceCompGlobalDefVec;
-  std::vector<SFig0s9_CountryLtoInterTab>          Fig0s9_CountryLtoInterTabVec;
-  std::vector<SFig0s13_UserApplicationInformation> Fig0s13_UserApplicationInformationVec;
-  std::vector<SFig0s14_SubChannelOrganization>     Fig0s14_SubChannelOrganizationVec;
-  std::vector<SFig0s17_ProgrammeType>              Fig0s17_ProgrammeTypeVec;
+  void add_Fig0s1_BasicSubChannelOrganization(const SFig0s1_BasicSubChannelOrganization & iFig0s1);
+  void add_Fig0s2_BasicService_ServiceCompDef(const SFig0s2_BasicService_ServiceCompDef & iFig0s2);
+  void add_Fig0s3_ServiceComponentPacketMode(const SFig0s3_ServiceComponentPacketMode & iFig0s3);
+  void add_Fig0s5_ServiceComponentLanguage(const SFig0s5_ServiceComponentLanguage & iFig0s5);
+  void add_Fig0s7_ConfigurationInformation(const SFig0s7_ConfigurationInformation & iFig0s7);
+  void add_Fig0s8_ServiceCompGlobalDef(const SFig0s8_ServiceCompGlobalDef & iFig0s8);
+  void add_Fig0s9_CountryLtoInterTab(const SFig0s9_CountryLtoInterTab & iFig0s9);
+  void add_Fig0s13_UserApplicationInformation(const SFig0s13_UserApplicationInformation & iFig0s13);
+  void add_Fig0s14_SubChannelOrganization(const SFig0s14_SubChannelOrganization & iFig0s14);
+  void add_Fig0s17_ProgrammeType(const SFig0s17_ProgrammeType & iFig0s17);
+
+  // read-only access for the FIG 0/2 iterations, the vectors are only filled by the add_...() methods above
+  const std::vector<SFig0s1_BasicSubChannelOrganization> & get_Fig0s1_BasicSubChannelOrganizationVec() const { return Fig0s1_BasicSubChannelOrganizationVec; }
+  const std::vector<SFig0s2_BasicService_ServiceCompDef> & get_Fig0s2_BasicService_ServiceCompDefVec() const { return Fig0s2_BasicService_ServiceCompDefVec; }
 
   const SFig0s1_BasicSubChannelOrganization * get_Fig0s1_BasicSubChannelOrganization_of_SubChId(i32 iSubChId) const;
   const SFig0s2_BasicService_ServiceCompDef * get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(u32 iSId, u8 iTMId) const;
@@ -263,5 +267,33 @@ public:
   template<typename T> inline QString hex_str(const T iVal) const { return QSL("0x%1").arg(iVal, 0, 16); }
 
   Cluster mClusterTable[128];
+
+private:
+  // private, as only the add_...() methods may fill the vectors (they also maintain the lookup indices below)
+  std::vector<SFig0s1_BasicSubChannelOrganization> Fig0s1_BasicSubChannelOrganizationVec;
+  std::vector<SFig0s2_BasicService_ServiceCompDef> Fig0s2_BasicService_ServiceCompDefVec;
+  std::vector<SFig0s3_ServiceComponentPacketMode>  Fig0s3_ServiceComponentPacketModeVec;
+  std::vector<SFig0s5_ServiceComponentLanguage>    Fig0s5_ServiceComponentLanguageVec;
+  std::vector<SFig0s7_ConfigurationInformation>    Fig0s7_ConfigurationInformationVec; // there is only a vector length of one possible
+  std::vector<SFig0s8_ServiceCompGlobalDef>        Fig0s8_ServiceCompGlobalDefVec;
+  std::vector<SFig0s9_CountryLtoInterTab>          Fig0s9_CountryLtoInterTabVec;
+  std::vector<SFig0s13_UserApplicationInformation> Fig0s13_UserApplicationInformationVec;
+  std::vector<SFig0s14_SubChannelOrganization>     Fig0s14_SubChannelOrganizationVec;
+  std::vector<SFig0s17_ProgrammeType>              Fig0s17_ProgrammeTypeVec;
+
+  TIndexMap mFig0s1_SubChId_Index;
+  TIndexMap mFig0s2_SId_Index;
+  TIndexMap mFig0s2_SId_ScIdx_Index;
+  TIndexMap mFig0s2_SId_TMId_Index;
+  TIndexMap mFig0s2_SCId_Index;          // only packet mode entries
+  TIndexMap mFig0s3_SCId_Index;
+  TIndexMap mFig0s5_SubChId_Index;       // only short form entries (LS_Flag == 0)
+  TIndexMap mFig0s5_SCId_Index;          // only long form entries (LS_Flag == 1)
+  TIndexMap mFig0s8_SId_SCIdS_Index;
+  TIndexMap mFig0s8_SId_with_SubChId_Index;
+  TIndexMap mFig0s8_SId_with_SCId_Index;
+  TIndexMap mFig0s13_SId_SCIdS_Index;
+  TIndexMap mFig0s14_SubChId_Index;
+  TIndexMap mFig0s17_SId_Index;
 };
 
@@ -32,42 +32,61 @@ void FibConfigFig1::reset()
   Fig1s5_DataServiceLabelVec.clear();
 
   serviceLabel_To_SId_SCIdS_Map.clear();
+
+  mFig1s1_SId_Index.clear();
+  mFig1s4_SId_SCIdS_Index.clear();
+  mFig1s5_SId_Index.clear();
 }
 
-const FibConfigFig1::SFig1s1_ProgrammeServiceLabel * FibConfigFig1::get_Fig1s1_ProgrammeServiceLabel_of_SId(const u32 SId) const
+// like in FibConfigFig0, emplace() keeps the first added element of a key
+void FibConfigFig1::add_Fig1s0_EnsembleLabel(const SFig1s0_EnsembleLabel & iFig1s0)
+{
+  Fig1s0_EnsembleLabelVec.emplace_back(iFig1s0);
+}
+
+void FibConfigFig1::add_Fig1s1_ProgrammeServiceLabel(const SFig1s1_ProgrammeServiceLabel & iFig1s1)
+{
+  const i32 idx = (i32)Fig1s1_ProgrammeServiceLabelVec.size();
+  Fig1s1_ProgrammeServiceLabelVec.emplace_back(iFig1s1);
+  mFig1s1_SId_Index.emplace(get_index_key(iFig1s1.SId), idx);
+}
+
+void FibConfigFig1::add_Fig1s4_ServiceComponentLabel(const SFig1s4_ServiceComponentLabel & iFig1s4)
 {
-  for (auto & elem : Fig1s1_ProgrammeServiceLabelVec)
+  const i32 idx = (i32)Fig1s4_ServiceComponentLabelVec.size();
+  Fig1s4_ServiceComponentLabelVec.emplace_back(iFig1s4);
+  mFig1s4_SId_SCIdS_Index.emplace(get_index_key(iFig1s4.SId, iFig1s4.SCIdS), idx);
+}
+
+void FibConfigFig1::add_Fig1s5_DataServiceLabel(const SFig1s5_DataServiceLabel & iFig1s5)
+{
+  const i32 idx = (i32)Fig1s5_DataServiceLabelVec.size();
+  Fig1s5_DataServiceLabelVec.emplace_back(iFig1s5);
+  mFig1s5_SId_Index.emplace(get_index_key(iFig1s5.SId), idx);
+}
+
+const FibConfigFig1::SFig1s0_EnsembleLabel * FibConfigFig1::get_Fig1s0_EnsembleLabel() const
+{
+  if (!Fig1s0_EnsembleLabelVec.empty())
   {
-    if (elem.SId == SId)
-    {
-      return &elem;
-    }
+    return &Fig1s0_EnsembleLabelVec[0];
   }
   return nullptr;
 }
 
+const FibConfigFig1::SFig1s1_ProgrammeServiceLabel * FibConfigFig1::get_Fig1s1_ProgrammeServiceLabel_of_SId(const u32 SId) const
+{
+  return find_in_index(mFig1s1_SId_Index, Fig1s1_ProgrammeServiceLabelVec, get_index_key(SId));
+}
+
 const FibConfigFig1::SFig1s4_ServiceComponentLabel * FibConfigFig1::get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(u32 SId, i8 SCIdS) const
 {
-  for (auto & elem : Fig1s4_ServiceComponentLabelVec)
-  {
-    if (elem.SId == SId && elem.SCIdS == SCIdS)
-    {
-      return &elem;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig1s4_SId_SCIdS_Index, Fig1s4_ServiceComponentLabelVec, get_index_key(SId, SCIdS));
 }
 
 const FibConfigFig1::SFig1s5_DataServiceLabel * FibConfigFig1::get_Fig1s5_DataServiceLabel_of_SId(u32 SId) const
 {
-  for (auto & elem : Fig1s5_DataServiceLabelVec)
-  {
-    if (elem.SId == SId)
-    {
-      return &elem;
-    }
-  }
-  return nullptr;
+  return find_in_index(mFig1s5_SId_Index, Fig1s5_DataServiceLabelVec, get_index_key(SId));
 }
 
 const QString & FibConfigFig1::get_service_label_of_SId_from_all_Fig1(const u32 iSId) const
@@ -68,11 +68,6 @@ public:
     u32 SId = -1; // this 32-bit field shall identify the service (see clause 6.3.1).
   };
 
-  std::vector<SFig1s0_EnsembleLabel>         Fig1s0_EnsembleLabelVec; // vector can only have one element!
-  std::vector<SFig1s1_ProgrammeServiceLabel> Fig1s1_ProgrammeServiceLabelVec;
-  std::vector<SFig1s4_ServiceComponentLabel> Fig1s4_ServiceComponentLabelVec;
-  std::vector<SFig1s5_DataServiceLabel>      Fig1s5_DataServiceLabelVec;
-
   struct SSId_SCIdS
   {
     u32 SId = 0;
@@ -84,6 +79,12 @@ public:
 
   template<typename T> inline QString hex_str(const T iVal) { return QSL("0x%1").arg(iVal, 0, 16); }
 
+  void add_Fig1s0_EnsembleLabel(const SFig1s0_EnsembleLabel & iFig1s0);
+  void add_Fig1s1_ProgrammeServiceLabel(const SFig1s1_ProgrammeServiceLabel & iFig1s1);
+  void add_Fig1s4_ServiceComponentLabel(const SFig1s4_ServiceComponentLabel & iFig1s4);
+  void add_Fig1s5_DataServiceLabel(const SFig1s5_DataServiceLabel & iFig1s5);
+
+  const SFig1s0_EnsembleLabel         * get_Fig1s0_EnsembleLabel() const;
   const SFig1s1_ProgrammeServiceLabel * get_Fig1s1_ProgrammeServiceLabel_of_SId(u32 SId) const;
   const SFig1s4_ServiceComponentLabel * get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(u32 SId, i8 SCIdS) const;
   const SFig1s5_DataServiceLabel      * get_Fig1s5_DataServiceLabel_of_SId(u32 SId) const;
@@ -94,5 +95,16 @@ public:
   void print_Fig1s1_ProgrammeServiceLabelVec(SStatistic & ioS, bool iCollectStatisticsOnly);
   void print_Fig1s4_ServiceComponentLabel(SStatistic & ioS, bool iCollectStatisticsOnly);
   void print_Fig1s5_DataServiceLabel(SStatistic & ioS, bool iCollectStatisticsOnly);
+
+private:
+  // private, as only the add_...() methods may fill the vectors (they also maintain the lookup indices below)
+  std::vector<SFig1s0_EnsembleLabel>         Fig1s0_EnsembleLabelVec; // vector can only have one element!
+  std::vector<SFig1s1_ProgrammeServiceLabel> Fig1s1_ProgrammeServiceLabelVec;
+  std::vector<SFig1s4_ServiceComponentLabel> Fig1s4_ServiceComponentLabelVec;
+  std::vector<SFig1s5_DataServiceLabel>      Fig1s5_DataServiceLabelVec;
+
+  TIndexMap mFig1s1_SId_Index;
+  TIndexMap mFig1s4_SId_SCIdS_Index;
+  TIndexMap mFig1s5_SId_Index;
 };
 
@@ -11,7 +11,7 @@
  * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 #include "fib_decoder.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "charsets.h"
 #include "bit_extractors.h"
 #include <cstring>
@@ -28,22 +28,27 @@
 static constexpr i32 cFibConsistencyCheckTime_ms =  300;  // max time necessary to collect new FIG 0/1 and FIG 0/2 data (measured 191 ms)
 static constexpr i32 cCheckStateAndPrintFigs_ms = 10000;  // check last state sanity and print FIG statistic
 
-/*static*/ std::unique_ptr<IFibDecoder> FibDecoderFactory::create(DabRadio* radio)
+/*static*/ std::unique_ptr<IFibDecoder> FibDecoderFactory::create(IDabObserver * ipObserver)
 {
-  return std::make_unique<FibDecoder>(radio);
+  return std::make_unique<FibDecoder>(ipObserver);
 }
 
-FibDecoder::FibDecoder(DabRadio * mr)
-  : mpRadioInterface(mr)
+FibDecoder::FibDecoder(IDabObserver * ipObserver)
+  : mpDabObserver(ipObserver)
   , mpFibConfigFig1(std::make_unique<FibConfigFig1>())
   , mpFibConfigFig0Curr (std::make_unique<FibConfigFig0>())
   , mpFibConfigFig0Next(std::make_unique<FibConfigFig0>())
 {
-  connect(this, &IFibDecoder::signal_name_of_ensemble, mpRadioInterface, &DabRadio::slot_name_of_ensemble);
-  connect(this, &IFibDecoder::signal_fib_time_info, mpRadioInterface, &DabRadio::slot_fib_time);
-  connect(this, &IFibDecoder::signal_change_in_configuration, mpRadioInterface, &DabRadio::slot_change_in_configuration);
-  connect(this, &IFibDecoder::signal_start_announcement, mpRadioInterface, &DabRadio::slot_start_announcement);
-  connect(this, &IFibDecoder::signal_stop_announcement, mpRadioInterface, &DabRadio::slot_stop_announcement);
+  if (mpDabObserver != nullptr)
+  {
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &IFibDecoder::signal_fib_loaded_state, this, [pObs](EFibLoadingState iState) { pObs->fib_loaded_state(iState); }, Qt::DirectConnection);
+    connect(this, &IFibDecoder::signal_name_of_ensemble, this, [pObs](i32 iEId, const QString & iName, const QString & iNameShort) { pObs->name_of_ensemble(iEId, iName, iNameShort); }, Qt::DirectConnection);
+    connect(this, &IFibDecoder::signal_fib_time_info, this, [pObs](const SUtcTimeSet & iTimeInfo) { pObs->fib_time(iTimeInfo); }, Qt::DirectConnection);
+    connect(this, &IFibDecoder::signal_change_in_configuration, this, [pObs]() { pObs->change_in_configuration(); }, Qt::DirectConnection);
+    connect(this, &IFibDecoder::signal_start_announcement, this, [pObs](const QString & iName, i32 iSubChId) { pObs->start_announcement(iName, iSubChId); }, Qt::DirectConnection);
+    connect(this, &IFibDecoder::signal_stop_announcement, this, [pObs](const QString & iName, i32 iSubChId) { pObs->stop_announcement(iName, iSubChId); }, Qt::DirectConnection);
+  }
 
   mpTimerDataConsistencyCheck = new QTimer(this);
   mpTimerDataConsistencyCheck->setSingleShot(true);
@@ -54,12 +59,28 @@ FibDecoder::FibDecoder(DabRadio * mr)
   mpTimerCheckStateAndPrintFigs->setInterval(cCheckStateAndPrintFigs_ms);
   mpTimerCheckStateAndPrintFigs->setSingleShot(true);
   connect(mpTimerCheckStateAndPrintFigs, &QTimer::timeout, this, &FibDecoder::_slot_timer_check_state_and_print_FIGs);
+
+  _publish_config_snapshot(); // the getters expect always a valid snapshot
 }
 
-void FibDecoder::process_FIB(const std::array<std::byte, cFibSizeVitOut> & iFibBits, u16 const /*iFicNo*/)
+void FibDecoder::process_FIBs(const std::array<std::byte, cFibSizeVitOut> * const ipFibs, const i32 iNumFibs)
 {
-  QMutexLocker lock(&mMutex); // TODO: maybe shift to emplace_back() place?
+  QMutexLocker lock(&mMutex); // once per FIC frame, the getters do not lock, they work on the published configuration snapshot
+
+  for (i32 fibIdx = 0; fibIdx < iNumFibs; fibIdx++)
+  {
+    _process_FIB(ipFibs[fibIdx]);
+  }
+
+  if (mConfigChanged)
+  {
+    _publish_config_snapshot(); // only one copy per frame, even if several FIBs changed the configuration
+  }
+}
 
+// mMutex must be held by the caller
+void FibDecoder::_process_FIB(const std::array<std::byte, cFibSizeVitOut> & iFibBits)
+{
   if (mFirstFigTimePoint == FibHelper::TTP())
   {
     mFirstFigTimePoint = TCT::now();
@@ -105,6 +126,20 @@ void FibDecoder::process_FIB(const std::array<std::byte, cFibSizeVitOut> & iFibB
   }
 }
 
+// mMutex must be held by the caller (or no other thread may run yet)
+void FibDecoder::_publish_config_snapshot()
+{
+  std::atomic_store(&mpConfigSnapshot, std::shared_ptr<const SConfigSnapshot>(new SConfigSnapshot{ *mpFibConfigFig0Curr, *mpFibConfigFig1 }));
+  mConfigChanged = false;
+}
+
+void FibDecoder::_emit_fib_loaded_state(const EFibLoadingState iState)
+{
+  // the receiver fetches the loaded data immediately, so they must already be visible in the snapshot
+  _publish_config_snapshot();
+  emit signal_fib_loaded_state(iState);
+}
+
 void FibDecoder::_reset()
 {
   // the timers live in another thread than the FIB processing, so they must not be touched directly (see also _retrigger_timer_data_loaded_fast())
@@ -116,8 +151,6 @@ void FibDecoder::_reset()
   mFirstFigTimePoint = {};
 
   mCifCount = 0;
-  mCifCount_hi = 0;
-  mCifCount_lo = 0;
   mModJulianDate = 0;
   mPrevChangeFlag = 0;
   mUtcTimeSet = {};
@@ -137,6 +170,7 @@ void FibDecoder::_restart_fib_decoding(const QString & iReason)
   mpFibConfigFig1->reset();
   _reset();
 
+  mConfigChanged = true; // is published at the end of process_FIBs()
   mRestartFibDecoding = true; // let the callers unwind, the remainder of the current FIB is not evaluated anymore
 }
 
@@ -147,6 +181,7 @@ void FibDecoder::connect_channel()
   mpFibConfigFig0Next->reset();
   mpFibConfigFig1->reset();
   _reset();
+  _publish_config_snapshot();
 }
 
 void FibDecoder::disconnect_channel()
@@ -155,6 +190,7 @@ void FibDecoder::disconnect_channel()
   mpFibConfigFig0Curr->reset();
   mpFibConfigFig0Next->reset();
   mpFibConfigFig1->reset();
+  _publish_config_snapshot();
 }
 
 void FibDecoder::set_SId_for_fast_audio_selection(const u32 iSId)
@@ -174,8 +210,6 @@ void FibDecoder::set_SId_for_fast_audio_selection(const u32 iSId)
 void FibDecoder::get_data_for_audio_service(const u32 iSId, SAudioData & oAD) const
 {
   // only FIG 0/1 and FIG 0/2 must be used here (other data could still not be available)
-  QMutexLocker lock(&mMutex);
-
   oAD.isDefined = false;
 
   if (mFibLoadingState < EFibLoadingState::S1_FastAudioDataLoaded)
@@ -184,7 +218,8 @@ void FibDecoder::get_data_for_audio_service(const u32 iSId, SAudioData & oAD) co
     return;
   }
 
-  const auto * const pFig0s2 = mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(iSId, ETMId::StreamModeAudio);
+  const auto pSnapshot = _get_config_snapshot();
+  const auto * const pFig0s2 = pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(iSId, ETMId::StreamModeAudio);
 
   if (pFig0s2 == nullptr)
   {
@@ -192,7 +227,7 @@ void FibDecoder::get_data_for_audio_service(const u32 iSId, SAudioData & oAD) co
     return;
   }
 
-  if (!_get_data_for_audio_service(*pFig0s2, &oAD))
+  if (!_get_data_for_audio_service(pSnapshot->Fig0Curr, pSnapshot->Fig1, *pFig0s2, &oAD))
   {
     return;
   }
@@ -200,9 +235,8 @@ void FibDecoder::get_data_for_audio_service(const u32 iSId, SAudioData & oAD) co
 
 void FibDecoder::get_data_for_audio_service_addon(u32 iSId, SAudioDataAddOns & oADAO) const
 {
-  QMutexLocker lock(&mMutex);
-
-  const auto * const pFig0s2 = mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(iSId, ETMId::StreamModeAudio);
+  const auto pSnapshot = _get_config_snapshot();
+  const auto * const pFig0s2 = pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(iSId, ETMId::StreamModeAudio);
 
   if (pFig0s2 == nullptr)
   {
@@ -210,13 +244,13 @@ void FibDecoder::get_data_for_audio_service_addon(u32 iSId, SAudioDataAddOns & o
     return;
   }
 
-  if (!_get_data_for_audio_service_addon(*pFig0s2, &oADAO))
+  if (!_get_data_for_audio_service_addon(pSnapshot->Fig0Curr, *pFig0s2, &oADAO))
   {
     return;
   }
 }
 
-bool FibDecoder::_get_data_for_audio_service(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioData * opAD) const
+bool FibDecoder::_get_data_for_audio_service(const FibConfigFig0 & iFig0, const FibConfigFig1 & iFig1, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioData * opAD) const
 {
   if (opAD != nullptr) opAD->isDefined = false;
 
@@ -231,14 +265,14 @@ bool FibDecoder::_get_data_for_audio_service(const FibConfigFig0::SFig0s2_BasicS
   const u16 SId = iFig0s2.get_SId();
   if ((SId & 0xFFFF0000) != 0) qWarning() << "Unexpected primary service SId" << SId;
 
-  const auto * const pFig0s1 = mpFibConfigFig0Curr->get_Fig0s1_BasicSubChannelOrganization_of_SubChId(SubChId);
+  const auto * const pFig0s1 = iFig0.get_Fig0s1_BasicSubChannelOrganization_of_SubChId(SubChId);
 
   if (pFig0s1 == nullptr)
   {
     return false;
   }
 
-  const auto * const pFig1s1 = mpFibConfigFig1->get_Fig1s1_ProgrammeServiceLabel_of_SId(SId);
+  const auto * const pFig1s1 = iFig1.get_Fig1s1_ProgrammeServiceLabel_of_SId(SId);
 
   if (pFig1s1 == nullptr && opAD == nullptr)
   {
@@ -267,7 +301,7 @@ bool FibDecoder::_get_data_for_audio_service(const FibConfigFig0::SFig0s2_BasicS
   return true;
 }
 
-bool FibDecoder::_get_data_for_audio_service_addon(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioDataAddOns * opADAO) const
+bool FibDecoder::_get_data_for_audio_service_addon(const FibConfigFig0 & iFig0, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioDataAddOns * opADAO) const
 {
   if (iFig0s2.ServiceComp_C.PS_Flag != 1) qWarning() << "This should be only a primary service";
   if (iFig0s2.PD_Flag != 0)
@@ -280,8 +314,8 @@ bool FibDecoder::_get_data_for_audio_service_addon(const FibConfigFig0::SFig0s2_
   const u32 SId = iFig0s2.get_SId();
   if ((SId & 0xFFFF0000) != 0) qWarning() << "Unexpected big ";
 
-  const auto * const pFig0s5  = mpFibConfigFig0Curr->get_Fig0s5_ServiceComponentLanguage_of_SubChId(SubChId);
-  const auto * const pFig0s17 = mpFibConfigFig0Curr->get_Fig0s17_ProgrammeType_of_SId(SId);
+  const auto * const pFig0s5  = iFig0.get_Fig0s5_ServiceComponentLanguage_of_SubChId(SubChId);
+  const auto * const pFig0s17 = iFig0.get_Fig0s17_ProgrammeType_of_SId(SId);
 
   if (pFig0s5 != nullptr)  opADAO->language    = pFig0s5->Language; else opADAO->language    = std::nullopt;
   if (pFig0s17 != nullptr) opADAO->programType = pFig0s17->IntCode; else opADAO->programType = std::nullopt;
@@ -292,14 +326,13 @@ bool FibDecoder::_get_data_for_audio_service_addon(const FibConfigFig0::SFig0s2_
 
 void FibDecoder::get_data_for_packet_service(const u32 iSId, std::vector<SPacketData> & oPDVec) const
 {
-  QMutexLocker lock(&mMutex);
-
   if (mFibLoadingState < EFibLoadingState::S4_FullyPacketDataLoaded)
   {
     qCritical() << "Data packet relevant FIB data not loaded yet";
     return;
   }
 
+  const auto pSnapshot = _get_config_snapshot();
   i16 numComp = 0;
 
   for (i16 compIdx = 0; compIdx < FibConfigFig0::SFig0s2_BasicService_ServiceCompDef::cNumServiceCompMax; ++compIdx)
@@ -309,7 +342,7 @@ void FibDecoder::get_data_for_packet_service(const u32 iSId, std::vector<SPacket
       break;  // quit for loop
     }
 
-    const auto * const pFig0s2 = mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDef_of_SId_ScIdx(iSId, compIdx);
+    const auto * const pFig0s2 = pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDef_of_SId_ScIdx(iSId, compIdx);
 
     if (pFig0s2 == nullptr || pFig0s2->ServiceComp_C.TMId != ETMId::PacketModeData)
     {
@@ -331,7 +364,7 @@ void FibDecoder::get_data_for_packet_service(const u32 iSId, std::vector<SPacket
     }
 
     SPacketData pd;
-    if (!_get_data_for_packet_service(*pFig0s2, compIdx, &pd))
+    if (!_get_data_for_packet_service(pSnapshot->Fig0Curr, pSnapshot->Fig1, *pFig0s2, compIdx, &pd))
     {
       continue; // TODO: or return?
     }
@@ -348,7 +381,7 @@ void FibDecoder::get_data_for_packet_service(const u32 iSId, std::vector<SPacket
   // }
 }
 
-bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, const i16 iCompIdx, SPacketData * opPD) const
+bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0 & iFig0, const FibConfigFig1 & iFig1, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, const i16 iCompIdx, SPacketData * opPD) const
 {
   if (opPD != nullptr) opPD->isDefined = false;
 
@@ -359,7 +392,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
 
   assert(iFig0s2.ServiceComp_C.TMId == ETMId::PacketModeData);
 
-  const auto * const pFig0s3 = mpFibConfigFig0Curr->get_Fig0s3_ServiceComponentPacketMode_of_SCId(iFig0s2.ServiceComp_C.TMId11.SCId);
+  const auto * const pFig0s3 = iFig0.get_Fig0s3_ServiceComponentPacketMode_of_SCId(iFig0s2.ServiceComp_C.TMId11.SCId);
 
   if (pFig0s3 == nullptr)
   {
@@ -367,7 +400,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
     return false;
   }
 
-  const auto * const pFig0s1 = mpFibConfigFig0Curr->get_Fig0s1_BasicSubChannelOrganization_of_SubChId(pFig0s3->SubChId);
+  const auto * const pFig0s1 = iFig0.get_Fig0s1_BasicSubChannelOrganization_of_SubChId(pFig0s3->SubChId);
 
   if (pFig0s1 == nullptr)
   {
@@ -376,7 +409,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
   }
 
   const u32 SId = iFig0s2.get_SId();
-  const auto * const pFig0s8 = mpFibConfigFig0Curr->get_Fig0s8_ServiceCompGlobalDef_of_SId_with_SCId(SId); // TODO: only for long form valid (with SCId)?
+  const auto * const pFig0s8 = iFig0.get_Fig0s8_ServiceCompGlobalDef_of_SId_with_SCId(SId); // TODO: only for long form valid (with SCId)?
 
   if (pFig0s8 == nullptr)
   {
@@ -384,7 +417,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
     return false;
   }
 
-  const auto pFig0s13 = mpFibConfigFig0Curr->get_Fig0s13_UserApplicationInformation_of_SId_SCIdS(SId, pFig0s8->SCIdS);
+  const auto pFig0s13 = iFig0.get_Fig0s13_UserApplicationInformation_of_SId_SCIdS(SId, pFig0s8->SCIdS);
 
   if (pFig0s13 == nullptr || pFig0s13->NumUserApps < 1)
   {
@@ -392,8 +425,8 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
     return false;
   }
 
-  const auto * const pFig0s14 = mpFibConfigFig0Curr->get_Fig0s14_SubChannelOrganization_of_SubChId(pFig0s3->SubChId);
-  const auto * const pFig0s5 = mpFibConfigFig0Curr->get_Fig0s5_ServiceComponentLanguage_of_SCId(iFig0s2.ServiceComp_C.TMId11.SCId);
+  const auto * const pFig0s14 = iFig0.get_Fig0s14_SubChannelOrganization_of_SubChId(pFig0s3->SubChId);
+  const auto * const pFig0s5 = iFig0.get_Fig0s5_ServiceComponentLanguage_of_SCId(iFig0s2.ServiceComp_C.TMId11.SCId);
 
   if (opPD != nullptr)
   {
@@ -423,7 +456,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
   // get service labels
   if (iFig0s2.ServiceComp_C.PS_Flag == 0) // is secondary
   {
-    const auto * const pFig1s4 = mpFibConfigFig1->get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(SId, pFig0s8->SCIdS);
+    const auto * const pFig1s4 = iFig1.get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(SId, pFig0s8->SCIdS);
 
     if (pFig1s4 != nullptr)
     {
@@ -440,7 +473,7 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
   }
   else // is primary (PS_Flag == 1)
   {
-    const auto * const pFig1s5 = mpFibConfigFig1->get_Fig1s5_DataServiceLabel_of_SId(SId);
+    const auto * const pFig1s5 = iFig1.get_Fig1s5_DataServiceLabel_of_SId(SId);
 
     if (pFig1s5 != nullptr)
     {
@@ -461,17 +494,17 @@ bool FibDecoder::_get_data_for_packet_service(const FibConfigFig0::SFig0s2_Basic
 
 std::vector<SServiceId> FibDecoder::get_service_list() const
 {
-  QMutexLocker lock(&mMutex);
+  const auto pSnapshot = _get_config_snapshot();
   std::vector<SServiceId> services;
 
   // if (_are_fib_data_loaded())
   // {
-    services.reserve(mpFibConfigFig1->serviceLabel_To_SId_SCIdS_Map.size());
-    for (const auto & [serviceLabel, SId_SCIdS] : mpFibConfigFig1->serviceLabel_To_SId_SCIdS_Map)
+    services.reserve(pSnapshot->Fig1.serviceLabel_To_SId_SCIdS_Map.size());
+    for (const auto & [serviceLabel, SId_SCIdS] : pSnapshot->Fig1.serviceLabel_To_SId_SCIdS_Map)
     {
       if (SId_SCIdS.SCIdS <= 0) // avoid using listing secondary subservices (negative SCIdS means "not specified")
       {
-        const auto * pFig0s2 = mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(SId_SCIdS.SId, ETMId::StreamModeAudio);
+        const auto * pFig0s2 = pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDef_of_SId_TMId(SId_SCIdS.SId, ETMId::StreamModeAudio);
         SServiceId ed;
         ed.isAudioChannel = pFig0s2 != nullptr; // else is a primary data service
         ed.hasSpiEpgData = false; // TODO: fill out
@@ -489,17 +522,15 @@ std::vector<SServiceId> FibDecoder::get_service_list() const
   return services;
 }
 
-const QString & FibDecoder::get_service_label_from_SId_SCIdS(const u32 iSId, const i32 iSCIdS) const
+QString FibDecoder::get_service_label_from_SId_SCIdS(const u32 iSId, const i32 iSCIdS) const
 {
-  QMutexLocker lock(&mMutex);
-  static const QString emptyString;
-
-  const auto * const pFig1s4 = mpFibConfigFig1->get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(iSId, iSCIdS);
+  const auto pSnapshot = _get_config_snapshot();
+  const auto * const pFig1s4 = pSnapshot->Fig1.get_Fig1s4_ServiceComponentLabel_of_SId_SCIdS(iSId, iSCIdS);
 
   if (pFig1s4 == nullptr)
   {
     qWarning() << "SId" << iSId << "and SCIdS" << iSCIdS << "in FIG 1/4 not found";
-    return emptyString;
+    return {};
   }
 
   return pFig1s4->Name;
@@ -507,8 +538,8 @@ const QString & FibDecoder::get_service_label_from_SId_SCIdS(const u32 iSId, con
 
 void FibDecoder::get_SId_SCIdS_from_service_label(const QString & iServiceLabel, u32 & oSId, i32 & oSCIdS) const
 {
-  QMutexLocker lock(&mMutex);
-  const FibConfigFig1::SSId_SCIdS * pSId_SCIdS = mpFibConfigFig1->get_SId_SCIdS_from_service_label(iServiceLabel);
+  const auto pSnapshot = _get_config_snapshot();
+  const FibConfigFig1::SSId_SCIdS * pSId_SCIdS = pSnapshot->Fig1.get_SId_SCIdS_from_service_label(iServiceLabel);
 
   if (pSId_SCIdS == nullptr || pSId_SCIdS->SId == 0)
   {
@@ -524,10 +555,11 @@ void FibDecoder::get_SId_SCIdS_from_service_label(const QString & iServiceLabel,
 
 i32 FibDecoder::get_EId() const
 {
-  QMutexLocker lock(&mMutex);
-  if (!mpFibConfigFig1->Fig1s0_EnsembleLabelVec.empty())
+  const auto pSnapshot = _get_config_snapshot();
+  if (const auto * const pFig1s0 = pSnapshot->Fig1.get_Fig1s0_EnsembleLabel();
+      pFig1s0 != nullptr)
   {
-    return mpFibConfigFig1->Fig1s0_EnsembleLabelVec[0].EId;
+    return pFig1s0->EId;
   }
 
   return 0;
@@ -535,10 +567,11 @@ i32 FibDecoder::get_EId() const
 
 QString FibDecoder::get_ensemble_name() const
 {
-  QMutexLocker lock(&mMutex);
-  if (!mpFibConfigFig1->Fig1s0_EnsembleLabelVec.empty())
+  const auto pSnapshot = _get_config_snapshot();
+  if (const auto * const pFig1s0 = pSnapshot->Fig1.get_Fig1s0_EnsembleLabel();
+      pFig1s0 != nullptr)
   {
-    return mpFibConfigFig1->Fig1s0_EnsembleLabelVec[0].Name;
+    return pFig1s0->Name;
   }
 
   return " ";
@@ -546,11 +579,13 @@ QString FibDecoder::get_ensemble_name() const
 
 std::vector<i8> FibDecoder::get_sub_channel_id_list() const
 {
-  std::vector<i8> subChannels(mpFibConfigFig0Curr->Fig0s1_BasicSubChannelOrganizationVec.size());
+  const auto pSnapshot = _get_config_snapshot();
+  const auto & fig0s1Vec = pSnapshot->Fig0Curr.get_Fig0s1_BasicSubChannelOrganizationVec();
+  std::vector<i8> subChannels(fig0s1Vec.size());
 
-  for (size_t i = 0; i < mpFibConfigFig0Curr->Fig0s1_BasicSubChannelOrganizationVec.size(); ++i)
+  for (size_t i = 0; i < fig0s1Vec.size(); ++i)
   {
-    subChannels[i] = mpFibConfigFig0Curr->Fig0s1_BasicSubChannelOrganizationVec[i].SubChId;
+    subChannels[i] = fig0s1Vec[i].SubChId;
   }
 
   return subChannels;
@@ -558,21 +593,20 @@ std::vector<i8> FibDecoder::get_sub_channel_id_list() const
 
 i32 FibDecoder::get_cif_count() const
 {
-  QMutexLocker lock(&mMutex);
-  return mCifCount;
+  return mCifCount.load();
 }
 
 void FibDecoder::get_cif_count(i16 * h, i16 * l) const
 {
-  QMutexLocker lock(&mMutex);
-  *h = mCifCount_hi;
-  *l = mCifCount_lo;
+  const i32 cifCount = mCifCount.load(); // both parts have to come from the same FIG 0/0
+  *h = (i16)(cifCount / 250);
+  *l = (i16)(cifCount % 250);
 }
 
 u8 FibDecoder::get_ecc() const
 {
-  QMutexLocker lock(&mMutex);
-  if (const auto * const pFig0s9 = mpFibConfigFig0Curr->get_Fig0s9_CountryLtoInterTab();
+  const auto pSnapshot = _get_config_snapshot();
+  if (const auto * const pFig0s9 = pSnapshot->Fig0Curr.get_Fig0s9_CountryLtoInterTab();
       pFig0s9 != nullptr)
   {
     return pFig0s9->Ensemble_ECC;
@@ -666,17 +700,15 @@ std::vector<SEpgElement> FibDecoder::find_epg_data(u32 SId) const
 
 u32 FibDecoder::get_mod_julian_date() const
 {
-  QMutexLocker lock(&mMutex);
-  return mModJulianDate;
+  return mModJulianDate.load();
 }
 
 void FibDecoder::get_sub_channel_info(SChannelData * d, const i32 iSubChId) const
 {
-  QMutexLocker lock(&mMutex);
-
   static constexpr FibConfigFig0::SFig0s1_BasicSubChannelOrganization emptySubChannel{};
 
-  const auto * const pFig0s1 = mpFibConfigFig0Curr->get_Fig0s1_BasicSubChannelOrganization_of_SubChId(iSubChId);
+  const auto pSnapshot = _get_config_snapshot();
+  const auto * const pFig0s1 = pSnapshot->Fig0Curr.get_Fig0s1_BasicSubChannelOrganization_of_SubChId(iSubChId);
 
   d->in_use = pFig0s1 != nullptr;
 
@@ -779,6 +811,8 @@ bool FibDecoder::_extract_character_set_label(FibConfigFig1::SFig1_DataField & o
 
 void FibDecoder::_retrigger_timer_data_loaded_fast(const char * const iCallerName)
 {
+  mConfigChanged = true; // called for each newly added FIG element
+
   // evaluate maximum time difference between calls to check whether the empiric time cMaxFibLoadingTimeFast_ms is high enough
   const std::chrono::time_point currTimePoint = std::chrono::system_clock::now(); // see issue https://github.com/tomneda/DABstar/issues/99
   const auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(currTimePoint - mLastTimePoint);
@@ -791,7 +825,7 @@ void FibDecoder::_retrigger_timer_data_loaded_fast(const char * const iCallerNam
   {
     qInfo() << "FIB data collection were already finished for" << iCallerName << ", diff time to last [ms]" << diff.count() << ", max needed time [ms]" << mDiffTimeMax.count() << "-> reload data";
     mFibLoadingState = EFibLoadingState::S5_DeferredDataLoaded;
-    emit signal_fib_loaded_state(EFibLoadingState::S5_DeferredDataLoaded);
+    _emit_fib_loaded_state(EFibLoadingState::S5_DeferredDataLoaded);
     return;
   }
 
@@ -820,7 +854,7 @@ void FibDecoder::_process_fast_audio_selection()
       if (mFibLoadingState < EFibLoadingState::S1_FastAudioDataLoaded) // emit only a higher state as before except of the deferred data
       {
         mFibLoadingState = EFibLoadingState::S1_FastAudioDataLoaded;
-        emit signal_fib_loaded_state(EFibLoadingState::S1_FastAudioDataLoaded);
+        _emit_fib_loaded_state(EFibLoadingState::S1_FastAudioDataLoaded);
       }
     }
   }
@@ -828,11 +862,11 @@ void FibDecoder::_process_fast_audio_selection()
 
 bool FibDecoder::_check_audio_data_completeness() const
 {
-  qDebug() << "Check audio data completeness with" << mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec.size() << "FIG0/2 elements";
+  qDebug() << "Check audio data completeness with" << mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDefVec().size() << "FIG0/2 elements";
 
   if (mFibLoadingState != EFibLoadingState::S2_PrimaryBaseDataLoaded)
   {
-    qCritical() << "Wrong expected state for audio data:" << (int)mFibLoadingState;
+    qCritical() << "Wrong expected state for audio data:" << (int)mFibLoadingState.load();
     return false;
   }
 
@@ -840,12 +874,12 @@ bool FibDecoder::_check_audio_data_completeness() const
 
   // In the case, not all FIG0/2 where loaded a wrong decision could be made here.
   // The information form FIG 0/7 would help here but they are seldom transferred.
-  for (const auto & fig0s2 : mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec)
+  for (const auto & fig0s2 : mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDefVec())
   {
     if (fig0s2.ServiceComp_C.TMId == ETMId::StreamModeAudio) // maybe flag also already made positive checks
     {
       audioDataFound = true;
-      if (!_get_data_for_audio_service(fig0s2, nullptr))
+      if (!_get_data_for_audio_service(*mpFibConfigFig0Curr, *mpFibConfigFig1, fig0s2, nullptr))
       {
         qWarning().noquote() << " --> Some audio FIG data for SId" << hex_str(fig0s2.get_SId()) << "missing";
         return false;
@@ -869,19 +903,19 @@ bool FibDecoder::_check_packet_data_completeness() const
 
   if (mFibLoadingState != EFibLoadingState::S3_FullyAudioDataLoaded)
   {
-    qCritical() << "Wrong expected state for packet data:" << (int)mFibLoadingState;
+    qCritical() << "Wrong expected state for packet data:" << (int)mFibLoadingState.load();
     return false;
   }
 
   // In the case, not all FIG0/2 where loaded a wrong decision could be made here.
   // The information form FIG 0/7 would help here but they are seldom transferred.
-  for (const auto & fig0s2 : mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec)
+  for (const auto & fig0s2 : mpFibConfigFig0Curr->get_Fig0s2_BasicService_ServiceCompDefVec())
   {
     if (fig0s2.ServiceComp_C.TMId == ETMId::PacketModeData) // maybe flag also already made positive checks
     {
       for (i16 compIdx = 0; compIdx < fig0s2.NumServiceComp; ++compIdx)
       {
-        if (!_get_data_for_packet_service(fig0s2, compIdx, nullptr))
+        if (!_get_data_for_packet_service(*mpFibConfigFig0Curr, *mpFibConfigFig1, fig0s2, compIdx, nullptr))
         {
           qDebug().noquote() << " --> Some packet FIG data for SId" << hex_str(fig0s2.get_SId()) << "and compIdx" << compIdx << "missing";
           return false;
@@ -908,7 +942,7 @@ void FibDecoder::_slot_timer_data_consistency_check()
     if (_check_audio_data_completeness())
     {
       mFibLoadingState = EFibLoadingState::S3_FullyAudioDataLoaded;
-      emit signal_fib_loaded_state(EFibLoadingState::S3_FullyAudioDataLoaded);
+      _emit_fib_loaded_state(EFibLoadingState::S3_FullyAudioDataLoaded);
     }
   }
 
@@ -925,13 +959,15 @@ void FibDecoder::_slot_timer_data_consistency_check()
         qInfo() << "Printing FIG data overview and statistics in" << cCheckStateAndPrintFigs_ms << "ms";
         mpTimerCheckStateAndPrintFigs->start(); // must be shown deferred because still repetition data are collected
       }
-      emit signal_fib_loaded_state(EFibLoadingState::S4_FullyPacketDataLoaded);
+      _emit_fib_loaded_state(EFibLoadingState::S4_FullyPacketDataLoaded);
     }
   }
 }
 
 void FibDecoder::_slot_timer_check_state_and_print_FIGs()
 {
+  QMutexLocker lock(&mMutex); // reads and publishes the live configuration
+
   if constexpr (cShowFigDataOverview || cShowFigDataStatistics)
   {
     constexpr bool cCollectStatisticsOnly = !cShowFigDataOverview;
@@ -954,7 +990,7 @@ void FibDecoder::_slot_timer_check_state_and_print_FIGs()
     SStatistic statFig1s5(ctp);
 
     qInfo();
-    qInfo() << "----- FIG contents" << (mpFibConfigFig1->Fig1s0_EnsembleLabelVec.empty() ? " (no ensemble label loaded)" : mpFibConfigFig1->Fig1s0_EnsembleLabelVec[0].Name.trimmed()) << "-----";
+    qInfo() << "----- FIG contents" << (mpFibConfigFig1->get_Fig1s0_EnsembleLabel() == nullptr ? " (no ensemble label loaded)" : mpFibConfigFig1->get_Fig1s0_EnsembleLabel()->Name.trimmed()) << "-----";
 
     mpFibConfigFig0Curr->print_Fig0s1_BasicSubChannelOrganization(statFig0s1, cCollectStatisticsOnly);
     mpFibConfigFig0Curr->print_Fig0s2_BasicService_ServiceCompDef(statFig0s2, cCollectStatisticsOnly);
@@ -1009,14 +1045,14 @@ void FibDecoder::_slot_timer_check_state_and_print_FIGs()
   {
     qWarning() << "Audio FIG data seems inconsistent or not complete. Trying to activate at least the remaining audio services...";
     mFibLoadingState = EFibLoadingState::S3_FullyAudioDataLoaded;
-    emit signal_fib_loaded_state(EFibLoadingState::S3_FullyAudioDataLoaded);
+    _emit_fib_loaded_state(EFibLoadingState::S3_FullyAudioDataLoaded);
   }
 
   if (mFibLoadingState < EFibLoadingState::S4_FullyPacketDataLoaded)
   {
     qWarning() << "Packet FIG data seems inconsistent or not complete. Trying to activate the remaining packet services...";
     mFibLoadingState = EFibLoadingState::S4_FullyPacketDataLoaded;
-    emit signal_fib_loaded_state(EFibLoadingState::S4_FullyPacketDataLoaded);
+    _emit_fib_loaded_state(EFibLoadingState::S4_FullyPacketDataLoaded);
   }
 }
 
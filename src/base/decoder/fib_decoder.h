@@ -20,17 +20,19 @@
 #include <QMutex>
 #include <set>
 #include <chrono>
+#include <atomic>
+#include <memory>
 
-class DabRadio;
+class IDabObserver;
 class QTimer;
 
 class FibDecoder final : public IFibDecoder, public FibHelper
 {
 public:
-  explicit FibDecoder(DabRadio *);
+  explicit FibDecoder(IDabObserver * ipObserver);
   ~FibDecoder() override = default;
 
-  void process_FIB(const std::array<std::byte, cFibSizeVitOut> &, u16) override;
+  void process_FIBs(const std::array<std::byte, cFibSizeVitOut> * ipFibs, i32 iNumFibs) override;
 
   void connect_channel() override;
   void disconnect_channel() override;
@@ -42,7 +44,7 @@ public:
   void get_data_for_packet_service(u32 iSId, std::vector<SPacketData> & oPDVec) const override;
   std::vector<SServiceId> get_service_list() const override;
 
-  const QString & get_service_label_from_SId_SCIdS(u32, i32) const override;
+  QString get_service_label_from_SId_SCIdS(u32, i32) const override;
   void get_SId_SCIdS_from_service_label(const QString & iServiceLabel, u32 & oSId, i32 & oSCIdS) const override;
   u8 get_ecc() const override;
   i32 get_EId() const override;
@@ -61,20 +63,18 @@ public:
   // std::vector<SEpgElement> find_epg_data(u32) const override;
 
 private:
-  DabRadio * const mpRadioInterface = nullptr;
+  IDabObserver * const mpDabObserver = nullptr;
   std::unique_ptr<FibConfigFig1> mpFibConfigFig1;
   std::unique_ptr<FibConfigFig0> mpFibConfigFig0Curr;
   std::unique_ptr<FibConfigFig0> mpFibConfigFig0Next;
-  i32 mCifCount = 0;
-  i16 mCifCount_hi = 0;
-  i16 mCifCount_lo = 0;
-  i32 mModJulianDate = 0;
+  std::atomic<i32> mCifCount{0};  // CIFCountHi * 250 + CIFCountLo
+  std::atomic<i32> mModJulianDate{0};
   u32 mSIdForFastAudioSelection = 0;
-  mutable QMutex mMutex;
+  mutable QMutex mMutex;  // serializes the FIB processing with the timer slots and the channel (dis)connection, the getters do not use it
   u8 mPrevChangeFlag = 0;
   QTimer * mpTimerDataConsistencyCheck = nullptr;
   QTimer * mpTimerCheckStateAndPrintFigs = nullptr;
-  EFibLoadingState mFibLoadingState = EFibLoadingState::S0_Init;
+  std::atomic<EFibLoadingState> mFibLoadingState{EFibLoadingState::S0_Init};
   SUtcTimeSet mUtcTimeSet{};
   std::set<u8> mUnhandledFig0Set;
   std::set<u8> mUnhandledFig1Set;
@@ -83,6 +83,17 @@ private:
   FibHelper::TTP mFirstFigTimePoint{};
   bool mRestartFibDecoding = false; // set while the remainder of the currently processed FIB has to be discarded
 
+  // Immutable copy of the current configuration for the getters (RCU-like): the FIB processing republishes a new copy
+  // once per FIC frame if the configuration has changed, the getters only take a reference to the latest copy and work
+  // on it without any lock.
+  struct SConfigSnapshot
+  {
+    FibConfigFig0 Fig0Curr;
+    FibConfigFig1 Fig1;
+  };
+  std::shared_ptr<const SConfigSnapshot> mpConfigSnapshot; // only accessed via std::atomic_load() and std::atomic_store()
+  bool mConfigChanged = false;
+
   struct SFigHeader // plus flags
   {
     u8 Length;   // Length of the FIG in bytes
@@ -91,8 +102,12 @@ private:
     u8 PD_Flag;  // Program or Data service flag
   };
 
+  void _process_FIB(const std::array<std::byte, cFibSizeVitOut> & iFibBits);
   void _reset();
   void _restart_fib_decoding(const QString & iReason);
+  void _publish_config_snapshot();
+  std::shared_ptr<const SConfigSnapshot> _get_config_snapshot() const { return std::atomic_load(&mpConfigSnapshot); }
+  void _emit_fib_loaded_state(EFibLoadingState iState);
 
   FibConfigFig0 * _get_config_ptr(const u8 iCN_Bit) const { return iCN_Bit == 0 ? mpFibConfigFig0Curr.get() : mpFibConfigFig0Next.get(); }
   SFigHeader _get_fig_header(const u8 *) const;
@@ -128,12 +143,13 @@ private:
   void _set_cluster(FibConfigFig0 *, i32, u32 iSId, u16);
   Cluster * _get_cluster(FibConfigFig0 *, i16) const;
 
-  bool _get_data_for_audio_service(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioData * opAD) const;
-  bool _get_data_for_audio_service_addon(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioDataAddOns * opADAO) const;
-  bool _get_data_for_packet_service(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, i16 iCompIdx, SPacketData * opPD) const;
+  // these work on the given configuration, which is either the live one (FIB processing) or a snapshot (getters)
+  bool _get_data_for_audio_service(const FibConfigFig0 & iFig0, const FibConfigFig1 & iFig1, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioData * opAD) const;
+  bool _get_data_for_audio_service_addon(const FibConfigFig0 & iFig0, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, SAudioDataAddOns * opADAO) const;
+  bool _get_data_for_packet_service(const FibConfigFig0 & iFig0, const FibConfigFig1 & iFig1, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2, i16 iCompIdx, SPacketData * opPD) const;
 
-  QString _get_audio_data_str(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const;
-  QString _get_packet_data_str(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const;
+  QString _get_audio_data_str(const SConfigSnapshot & iSnapshot, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const;
+  QString _get_packet_data_str(const SConfigSnapshot & iSnapshot, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const;
 
   bool _extract_character_set_label(FibConfigFig1::SFig1_DataField & oFig1DF, const u8 * d, i16 iLabelOffs) const;
   void _retrigger_timer_data_loaded_fast(const char * iCallerName);
@@ -96,8 +96,6 @@ void FibDecoder::_process_Fig0s0(const u8 * const d)
   fig0s0.CIFCountLo = getBits_8(d, 16 + 24);
   fig0s0.OccurrenceChange = getBits_8(d, 16 + 32);
 
-  mCifCount_hi = fig0s0.CIFCountHi;
-  mCifCount_lo = fig0s0.CIFCountLo;
   mCifCount = fig0s0.CIFCountHi * 250 + fig0s0.CIFCountLo;
 
   if (fig0s0.ChangeFlags == 0 && mPrevChangeFlag == 3)
@@ -106,6 +104,7 @@ void FibDecoder::_process_Fig0s0(const u8 * const d)
     std::swap(mpFibConfigFig0Curr, mpFibConfigFig0Next);
     mpFibConfigFig0Next->reset();
     // _reset(); // TODO: what has to be reset here
+    _publish_config_snapshot(); // the receiver reads the new configuration
     emit signal_change_in_configuration();
   }
 
@@ -207,7 +206,7 @@ i16 FibDecoder::_subprocess_Fig0s1(const u8 * const d, const i16 offset, const S
       return (i16)(bitOffset / 8);
     }
 
-    if (const auto * const pColliding = _find_colliding_Fig0s1(pConfig->Fig0s1_BasicSubChannelOrganizationVec, fig0s1);
+    if (const auto * const pColliding = _find_colliding_Fig0s1(pConfig->get_Fig0s1_BasicSubChannelOrganizationVec(), fig0s1);
         pColliding != nullptr)
     {
       _restart_fib_decoding(_get_cu_range_str(fig0s1) + " overlaps " + _get_cu_range_str(*pColliding));
@@ -215,7 +214,7 @@ i16 FibDecoder::_subprocess_Fig0s1(const u8 * const d, const i16 offset, const S
     }
 
     fig0s1.set_current_time();
-    pConfig->Fig0s1_BasicSubChannelOrganizationVec.emplace_back(fig0s1);
+    pConfig->add_Fig0s1_BasicSubChannelOrganization(fig0s1);
     _retrigger_timer_data_loaded_fast("Fig0s1");
   }
   else
@@ -277,7 +276,7 @@ i16 FibDecoder::_subprocess_Fig0s2(const u8 * const d, const i16 offset, const S
 
       // SId_element.comps.push_back(pConfig->Fig0s2_BasicService_ServiceCompDefVec.size());
       fig0s2.set_current_time();
-      pConfig->Fig0s2_BasicService_ServiceCompDefVec.emplace_back(fig0s2);
+      pConfig->add_Fig0s2_BasicService_ServiceCompDef(fig0s2);
       _retrigger_timer_data_loaded_fast("Fig0s2");
     }
     else
@@ -316,7 +315,7 @@ i16 FibDecoder::_subprocess_Fig0s3(const u8 * const d, const i16 used, const SFi
       bitOffset += 16;
     }
     fig0s3.set_current_time();
-    pConfig->Fig0s3_ServiceComponentPacketModeVec.emplace_back(fig0s3);
+    pConfig->add_Fig0s3_ServiceComponentPacketMode(fig0s3);
     _retrigger_timer_data_loaded_slow("Fig0s3");
   }
   else
@@ -347,7 +346,7 @@ i16 FibDecoder::_subprocess_Fig0s5(const u8 * const d, const i16 offset, const S
         pFig0s5 == nullptr)
     {
       fig0s5.set_current_time();
-      mpFibConfigFig0Curr->Fig0s5_ServiceComponentLanguageVec.emplace_back(fig0s5); // TODO: really only currentConfig? (see 8.1.2)
+      mpFibConfigFig0Curr->add_Fig0s5_ServiceComponentLanguage(fig0s5); // TODO: really only currentConfig? (see 8.1.2)
       _retrigger_timer_data_loaded_slow("Fig0s5a");
     }
     else
@@ -367,7 +366,7 @@ i16 FibDecoder::_subprocess_Fig0s5(const u8 * const d, const i16 offset, const S
         pFig0s5 == nullptr)
     {
       fig0s5.set_current_time();
-      mpFibConfigFig0Curr->Fig0s5_ServiceComponentLanguageVec.emplace_back(fig0s5); // TODO: really only currentConfig? (see 8.1.2)
+      mpFibConfigFig0Curr->add_Fig0s5_ServiceComponentLanguage(fig0s5); // TODO: really only currentConfig? (see 8.1.2)
       _retrigger_timer_data_loaded_slow("Fig0s5b");
     }
     else
@@ -396,7 +395,7 @@ void FibDecoder::_process_Fig0s7(const u8 * const d)
     fig0s7.NumServices = getBits_6(d, used * 8);
     fig0s7.Count = getBits(d, used * 8 + 6, 10);
     fig0s7.set_current_time();
-    pConfig->Fig0s7_ConfigurationInformationVec.emplace_back(fig0s7);
+    pConfig->add_Fig0s7_ConfigurationInformation(fig0s7);
     _retrigger_timer_data_loaded_fast("Fig0s7");
   }
   else
@@ -436,7 +435,7 @@ i16 FibDecoder::_subprocess_Fig0s8(const u8 * const d, const i16 used, const SFi
       pFig0s8 == nullptr)
   {
     fig0s8.set_current_time();
-    pConfig->Fig0s8_ServiceCompGlobalDefVec.emplace_back(fig0s8);
+    pConfig->add_Fig0s8_ServiceCompGlobalDef(fig0s8);
     _retrigger_timer_data_loaded_slow("Fig0s8");
   }
   else
@@ -453,9 +452,10 @@ void FibDecoder::_process_Fig0s9(const u8 * const d)
 {
   constexpr i16 offset = 16;
 
-  if (!mpFibConfigFig0Curr->Fig0s9_CountryLtoInterTabVec.empty()) // TODO: considering some change triggers?
+  if (const auto * const pFig0s9 = mpFibConfigFig0Curr->get_Fig0s9_CountryLtoInterTab();
+      pFig0s9 != nullptr) // TODO: considering some change triggers?
   {
-    mpFibConfigFig0Curr->Fig0s9_CountryLtoInterTabVec[0].set_current_time_2nd_call();
+    const_cast<FibConfigFig0::SFig0s9_CountryLtoInterTab *>(pFig0s9)->set_current_time_2nd_call(); // won't give up the "const" of the get_..-method
     return;
   }
 
@@ -474,7 +474,7 @@ void FibDecoder::_process_Fig0s9(const u8 * const d)
   }
 
   fig0s9.set_current_time();
-  mpFibConfigFig0Curr->Fig0s9_CountryLtoInterTabVec.emplace_back(fig0s9);
+  mpFibConfigFig0Curr->add_Fig0s9_CountryLtoInterTab(fig0s9);
   _retrigger_timer_data_loaded_slow("Fig0s9");
 }
 
@@ -546,7 +546,7 @@ i16 FibDecoder::_subprocess_Fig0s13(const u8 * const d, i16 used, const SFigHead
     fig0s13.SizeBits = bitOffset - used * 8; // only store netto size
     auto * const pConfig = _get_config_ptr(iFH.CN_Flag);
     fig0s13.set_current_time();
-    pConfig->Fig0s13_UserApplicationInformationVec.emplace_back(fig0s13);
+    pConfig->add_Fig0s13_UserApplicationInformation(fig0s13);
     _retrigger_timer_data_loaded_slow("Fig0s13");
   }
   else
@@ -571,7 +571,7 @@ i16 FibDecoder::_subprocess_Fig0s14(const u8 * const d, const i16 used, const SF
   {
     fig0s14.FEC_scheme = getBits_2(d, used * 8 + 6);
     fig0s14.set_current_time();
-    pConfig->Fig0s14_SubChannelOrganizationVec.emplace_back(fig0s14);
+    pConfig->add_Fig0s14_SubChannelOrganization(fig0s14);
     _retrigger_timer_data_loaded_slow("Fig0s14");
   }
   else
@@ -599,7 +599,7 @@ void FibDecoder::_process_Fig0s17(const u8 * const d)
       fig0s17.SD_Flag = getBits_1(d, offset + 16);
       fig0s17.IntCode = getBits_5(d, offset + 16 + 11);
       fig0s17.set_current_time();
-      mpFibConfigFig0Curr->Fig0s17_ProgrammeTypeVec.emplace_back(fig0s17);
+      mpFibConfigFig0Curr->add_Fig0s17_ProgrammeType(fig0s17);
       // qDebug() << "Fig0s17: SId" << fig0s17.SId << "IntCode" << fig0s17.IntCode;
       _retrigger_timer_data_loaded_slow("Fig0s17");
     }
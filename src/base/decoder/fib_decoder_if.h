@@ -20,7 +20,7 @@
 #include <QString>
 #include <QStringList>
 
-class DabRadio;
+class IDabObserver;
 
 class IFibDecoder : public QObject
 {
@@ -78,7 +78,8 @@ public:
 
   ~IFibDecoder() override = default;
 
-  virtual void process_FIB(const std::array<std::byte, cFibSizeVitOut> &, u16) = 0;
+  // processes the FIBs (all with correct CRC) of one FIC frame, so the decoder has to synchronize only once per frame
+  virtual void process_FIBs(const std::array<std::byte, cFibSizeVitOut> * ipFibs, i32 iNumFibs) = 0;
 
   virtual void connect_channel() = 0;
   virtual void disconnect_channel() = 0;
@@ -90,7 +91,7 @@ public:
   virtual void get_data_for_packet_service(u32 iSId, std::vector<SPacketData> & oPDVec) const = 0;
   virtual std::vector<SServiceId> get_service_list() const = 0;
 
-  virtual const QString & get_service_label_from_SId_SCIdS(u32 iSId, i32 iSCIdS) const = 0;
+  virtual QString get_service_label_from_SId_SCIdS(u32 iSId, i32 iSCIdS) const = 0;
   virtual void get_SId_SCIdS_from_service_label(const QString & iServiceLabel, u32 & oSId, i32 & oSCIdS) const = 0;
   virtual u8 get_ecc() const = 0;
   // virtual u16 get_country_name() const = 0;
@@ -121,6 +122,6 @@ signals:
 class FibDecoderFactory
 {
 public:
-  static std::unique_ptr<IFibDecoder> create(DabRadio * radio);
+  static std::unique_ptr<IFibDecoder> create(IDabObserver * ipObserver);
 };
 
@@ -19,22 +19,24 @@ QStringList FibDecoder::get_fib_content_str_list(i32 & oNumCols) const
    * I: Information
    */
   QStringList out;
+  const auto pSnapshot = _get_config_snapshot();
 
   out << QSL("H;EnsembleLabel;ShortEnsLabel;EId");
-  for (const auto & fig1s0 : mpFibConfigFig1->Fig1s0_EnsembleLabelVec) // should only have one element
+  if (const auto * const pFig1s0 = pSnapshot->Fig1.get_Fig1s0_EnsembleLabel();
+      pFig1s0 != nullptr)
   {
-    out << QSL("D;") + fig1s0.Name + ";" + fig1s0.NameShort + ";" + hex_str(fig1s0.EId);
+    out << QSL("D;") + pFig1s0->Name + ";" + pFig1s0->NameShort + ";" + hex_str(pFig1s0->EId);
   }
 
   out << QSL("E"); // empty line
   out << QSL("C;Audio services:");
   out << QSL("H;ServiceLabel;ShortServLabel;ServiceId;SubChannel;StartAddr [CU];Length [CU];Protection;CodeRate;BitRate [kbps];DabType;Language;ProgramType");
 
-  for (const auto & fig0s2 : mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec)
+  for (const auto & fig0s2 : pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDefVec())
   {
     if (fig0s2.ServiceComp_C.TMId == ETMId::StreamModeAudio) // skip non-audio elements
     {
-      out << QSL("D;") + _get_audio_data_str(fig0s2);
+      out << QSL("D;") + _get_audio_data_str(*pSnapshot, fig0s2);
     }
   }
 
@@ -42,11 +44,11 @@ QStringList FibDecoder::get_fib_content_str_list(i32 & oNumCols) const
   out << QSL("C;Primary data services:");
   out << QSL("H;ServiceLabel;ShortServLabel;ServiceId;SubChannel;StartAddr [CU];Length [CU];Protection;CodeRate;FEC_Scheme;AppType;PacketAddr;DSCTy");
 
-  for (const auto & fig0s2 : mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec)
+  for (const auto & fig0s2 : pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDefVec())
   {
     if (fig0s2.ServiceComp_C.TMId == ETMId::PacketModeData && fig0s2.PD_Flag == 1) // choose primary packet data elements
     {
-      out << QSL("D;") + _get_packet_data_str(fig0s2);
+      out << QSL("D;") + _get_packet_data_str(*pSnapshot, fig0s2);
     }
   }
 
@@ -54,22 +56,22 @@ QStringList FibDecoder::get_fib_content_str_list(i32 & oNumCols) const
   out << QSL("C;Secondary data services:");
   out << QSL("H;ServiceLabel;ShortServLabel;ServiceId;SubChannel;StartAddr [CU];Length [CU];Protection;CodeRate;FEC_Scheme;AppType;PacketAddr;DSCTy");
 
-  for (const auto & fig0s2 : mpFibConfigFig0Curr->Fig0s2_BasicService_ServiceCompDefVec)
+  for (const auto & fig0s2 : pSnapshot->Fig0Curr.get_Fig0s2_BasicService_ServiceCompDefVec())
   {
     if (fig0s2.ServiceComp_C.TMId == ETMId::PacketModeData && fig0s2.PD_Flag == 0) // choose secondary packet data elements
     {
-      out << QSL("D;") + _get_packet_data_str(fig0s2);
+      out << QSL("D;") + _get_packet_data_str(*pSnapshot, fig0s2);
     }
   }
 
   return out;
 }
 
-QString FibDecoder::_get_audio_data_str(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const
+QString FibDecoder::_get_audio_data_str(const SConfigSnapshot & iSnapshot, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const
 {
   SAudioData ad;
   SAudioDataAddOns adao;
-  if (!_get_data_for_audio_service(iFig0s2, &ad) || !_get_data_for_audio_service_addon(iFig0s2, &adao))
+  if (!_get_data_for_audio_service(iSnapshot.Fig0Curr, iSnapshot.Fig1, iFig0s2, &ad) || !_get_data_for_audio_service_addon(iSnapshot.Fig0Curr, iFig0s2, &adao))
   {
     return QSL("-;-;-;-;-;-;-;-;-;-;-;-");
   }
@@ -94,10 +96,10 @@ QString FibDecoder::_get_audio_data_str(const FibConfigFig0::SFig0s2_BasicServic
   return str;
 }
 
-QString FibDecoder::_get_packet_data_str(const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const
+QString FibDecoder::_get_packet_data_str(const SConfigSnapshot & iSnapshot, const FibConfigFig0::SFig0s2_BasicService_ServiceCompDef & iFig0s2) const
 {
   SPacketData pd;
-  if (!_get_data_for_packet_service(iFig0s2, 0, &pd))
+  if (!_get_data_for_packet_service(iSnapshot.Fig0Curr, iSnapshot.Fig1, iFig0s2, 0, &pd))
   {
     return QSL("Inconsistent data;-;") + hex_str(iFig0s2.get_SId()) + QSL(";-;-;-;-;-;-;-;-;-;");
     // return "-;-;-;-;-;-;-;-;-;-;-;-;";
@@ -15,6 +15,8 @@
 #include "qt_compat.h"
 #include <QString>
 #include <chrono>
+#include <vector>
+#include <unordered_map>
 
 #include "glob_data_types.h"
 
@@ -44,6 +46,19 @@ public:
     u32 Count = 0;
   };
 
+  // Lookup index of a FIG vector: key -> position of the first element with this key.
+  // Positions are stored instead of pointers, so the index stays valid if the whole configuration is copied.
+  using TIndexMap = std::unordered_map<u64, i32>;
+
+  static constexpr u64 get_index_key(const i64 iId) { return (u64)iId; }
+  static constexpr u64 get_index_key(const u32 iSId, const i32 iSubId) { return ((u64)iSId << 32) | (u32)iSubId; }
+
+  template<typename T> static const T * find_in_index(const TIndexMap & iIndexMap, const std::vector<T> & iVec, const u64 iKey)
+  {
+    const auto it = iIndexMap.find(iKey);
+    return it != iIndexMap.end() ? &iVec[it->second] : nullptr;
+  }
+
   void get_statistics(const SFigBase & iFigBase, SStatistic & ioStatistic, std::chrono::milliseconds * opDuration1 = nullptr, std::chrono::milliseconds * opDuration2 = nullptr) const;
   QString print_duration_and_get_statistics(const SFigBase & iFigBase, SStatistic & ioStatistic) const;
   QString print_statistic_header() const;
@@ -30,7 +30,7 @@
  */
 
 #include "fic_decoder.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "protTables.h"
 #include "crc.h"
 #include <cassert>
@@ -53,8 +53,8 @@
   *	The data is sent through to the fib processor
   */
 
-FicDecoder::FicDecoder(DabRadio * const iMr)
-  : mpFibDecoder(FibDecoderFactory::create(iMr))
+FicDecoder::FicDecoder(IDabObserver * const ipObserver)
+  : mpFibDecoder(FibDecoderFactory::create(ipObserver))
 {
   std::array<std::byte, 9> shiftRegister;
   std::fill(shiftRegister.begin(), shiftRegister.end(), static_cast<std::byte>(1));
@@ -123,7 +123,10 @@ FicDecoder::FicDecoder(DabRadio * const iMr)
     local++;
   }
 
-  connect(this, &FicDecoder::signal_fic_status, iMr, &DabRadio::slot_show_fic_status);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &FicDecoder::signal_fic_status, this, [ipObserver](i32 iSuccessPercent, f32 iBER) { ipObserver->show_fic_status(iSuccessPercent, iBER); }, Qt::DirectConnection);
+  }
 }
 
 /**
@@ -181,9 +184,17 @@ void FicDecoder::_process_fic_input(const i16 iFicIdx, bool & oFicValid)
 
   if (!mIsRunning.load())
   {
+    mNumValidFibsOfFrame = 0; // drop FIBs of a stopped channel
     return;
   }
 
+  if (iFicIdx == 0)
+  {
+    _pass_valid_fibs_of_frame(); // FIBs of a frame that was interrupted before its last FIC
+    mCurFrameStatistics = {};
+    mCurFrameStatistics.frameCnt = mFrameCnt++;
+  }
+
   // do de-puncturing
   i16 ficReadIdx = 0;
   for (i16 * const addr : mViterbiBlockAddresses)
@@ -196,7 +207,15 @@ void FicDecoder::_process_fic_input(const i16 iFicIdx, bool & oFicValid)
 
   mViterbi.deconvolve(mViterbiBlock.data(), reinterpret_cast<u8 *>(fibBitsOf3Fibs.data()));
 
-  mViterbi.calculate_BER(mViterbiBlock.data(), mPunctureTable.data(), reinterpret_cast<u8 *>(fibBitsOf3Fibs.data()), mFicBits, mFicErrors);
+  i32 ficBits = 0;
+  i32 ficErrors = 0;
+  u32 ficPathMetric = 0;
+  mViterbi.calculate_BER(mViterbiBlock.data(), mPunctureTable.data(), reinterpret_cast<u8 *>(fibBitsOf3Fibs.data()), ficBits, ficErrors, &ficPathMetric);
+  mFicBits += ficBits;
+  mFicErrors += ficErrors;
+  mCurFrameStatistics.codedBits += ficBits;
+  mCurFrameStatistics.bitErrors += ficErrors;
+  mCurFrameStatistics.pathMetric += ficPathMetric;
 
   mFicBlock++;
 
@@ -234,15 +253,22 @@ void FicDecoder::_process_fic_input(const i16 iFicIdx, bool & oFicValid)
   for (i16 fibIdx = 0; fibIdx < cFibPerFic; fibIdx++)
   {
     const auto & oneFib = *reinterpret_cast<std::array<std::byte, cFibSizeVitOut> *>(&fibBitsOf3Fibs[fibIdx * cFibSizeVitOut]);
+    mCurFrameStatistics.numFibs++;
 
     if (check_CRC_bits(reinterpret_cast<const u8 *>(oneFib.data()), cFibSizeVitOut))
     {
+      mCurFrameStatistics.fibCrcOkMask |= (u16)(1 << (iFicIdx * cFibPerFic + fibIdx));
+
       if (mpFicDump != nullptr)
       {
         _dump_fib_to_file(oneFib.data());
       }
 
-      mpFibDecoder->process_FIB(oneFib, iFicIdx);
+      if (mNumValidFibsOfFrame == (i32)mValidFibsOfFrame.size())
+      {
+        _pass_valid_fibs_of_frame(); // only possible with an irregular FIC index sequence
+      }
+      mValidFibsOfFrame[mNumValidFibsOfFrame++] = oneFib;
 
       if (mFicDecodeSuccessRatio < 10)
       {
@@ -259,6 +285,23 @@ void FicDecoder::_process_fic_input(const i16 iFicIdx, bool & oFicValid)
       }
     }
   }
+
+  if (iFicIdx == cFicPerFrame - 1)
+  {
+    _pass_valid_fibs_of_frame();
+    mFrameStatisticsBuffer.put_data_into_ring_buffer(&mCurFrameStatistics, 1);
+  }
+}
+
+// The FIB decoder gets all FIBs of a frame with one call, so it locks its state and publishes a changed
+// configuration only once per frame (about 10 times per second) instead of once per FIB.
+void FicDecoder::_pass_valid_fibs_of_frame()
+{
+  if (mNumValidFibsOfFrame > 0)
+  {
+    mpFibDecoder->process_FIBs(mValidFibsOfFrame.data(), mNumValidFibsOfFrame);
+    mNumValidFibsOfFrame = 0;
+  }
 }
 
 void FicDecoder::stop()
@@ -320,6 +363,12 @@ void FicDecoder::get_fib_bits(u8 * v, bool * b)
   }
 }
 
+i32 FicDecoder::get_fic_frame_statistics(std::vector<SFicFrameStatistics> & oStatistics)
+{
+  oStatistics.resize(mFrameStatisticsBuffer.get_ring_buffer_read_available());
+  return mFrameStatisticsBuffer.get_data_from_ring_buffer(oStatistics.data(), (i32)oStatistics.size());
+}
+
 i32 FicDecoder::get_fic_decode_ratio_percent() const
 {
   return mFicDecodeSuccessRatio * 10;
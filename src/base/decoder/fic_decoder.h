@@ -32,18 +32,30 @@
 
 #include "viterbi_spiral.h"
 #include "fib_decoder_if.h"
+#include "ringbuffer.h"
 #include <QObject>
 #include <vector>
 #include <atomic>
 
-class DabRadio;
+class IDabObserver;
 class DabParams;
 
 class FicDecoder : public QObject
 {
   Q_OBJECT
 public:
-  explicit FicDecoder(DabRadio * iMr);
+  // decoding quality of the FIC of one DAB frame, as time series see get_fic_frame_statistics()
+  struct SFicFrameStatistics
+  {
+    u32 frameCnt;       // running number of the frame
+    i32 codedBits;      // compared (non-punctured) coded bits of all FICs of the frame
+    i32 bitErrors;      // number of coded bits where the hard decision differs to the re-encoded Viterbi output
+    u32 pathMetric;     // sum of the Viterbi path metrics of all FICs (soft distance, 0 is perfect, max. 255 per coded bit)
+    u16 fibCrcOkMask;   // bit n is set if FIB n of the frame (n = cFibPerFic * FIC index + FIB index) passed the CRC check
+    u8 numFibs;         // number of checked FIBs of the frame
+  };
+
+  explicit FicDecoder(IDabObserver * ipObserver);
   ~FicDecoder() override = default;
 
   void process_block(const std::vector<i16> & iOfdmSoftBits, const i32 iOfdmSymbIdx);
@@ -54,6 +66,8 @@ public:
   void reset_fic_decode_success_ratio() { mFicDecodeSuccessRatio = 0; };
   void start_fic_dump(FILE *);
   void stop_fic_dump();
+  // fetches the statistics of all frames since the last call (oldest first), returns the number of frames
+  i32 get_fic_frame_statistics(std::vector<SFicFrameStatistics> & oStatistics);
 
   IFibDecoder * get_fib_decoder() { return mpFibDecoder.get(); };
 
@@ -62,6 +76,8 @@ private:
   static constexpr i32 cViterbiBlockSize = 3072 + 24; // with punctation data
   ViterbiSpiral mViterbi{ cFicSizeVitOut, true };
   std::array<std::byte, cFicPerFrame * cFicSizeVitOut> mFibBitsEntireFrame;
+  std::array<std::array<std::byte, cFibSizeVitOut>, cFicPerFrame * cFibPerFic> mValidFibsOfFrame; // FIBs with correct CRC, passed to the FIB decoder at once
+  i32 mNumValidFibsOfFrame = 0;
   std::array<std::byte, cFicSizeVitOut> mPRBS;
   std::array<i16, cFicSizeVitIn> mFicViterbiSoftInput;
   std::array<u8, cViterbiBlockSize> mPunctureTable{false}; // TODO: mViterbiBlockAddresses would be a substitute for this but still needed for BER measurement
@@ -74,11 +90,15 @@ private:
   i32 mFicErrors = 0;
   i32 mFicBits = 0;
   i32 mFicDecodeSuccessRatio = 0;   // Saturating up/down-counter in range [0, 10] corresponding to the number of FICs with correct CRC
+  SFicFrameStatistics mCurFrameStatistics{};
+  u32 mFrameCnt = 0;
+  RingBuffer<SFicFrameStatistics> mFrameStatisticsBuffer{256}; // about 25 s, if nobody reads it the newer frames are dropped
   std::atomic<bool> mIsRunning{false};
   std::atomic<FILE *> mpFicDump{nullptr};
 
   void _process_fic_input(i16 iFicIdx, bool & oFicValid);
   void _dump_fib_to_file(const std::byte * ipOneFibBits) const;
+  void _pass_valid_fibs_of_frame();
 
 signals:
   void signal_fic_status(i32, f32);
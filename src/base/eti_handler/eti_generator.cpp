@@ -67,7 +67,7 @@ void EtiGenerator::reset()
   {
     if (descrambler[i] != nullptr)
     {
-      delete descrambler[i];
+      delete[] descrambler[i];
     }
     if (protTable[i] != nullptr)
     {
@@ -360,8 +360,9 @@ i32 EtiGenerator::_process_cif(const i16 * input, u8 * output, i32 offset)
         protTable[subChId] = new EepProtection(t->bitRate, t->protLevel);
       }
 
+      // the PRBS of the energy dispersal is packed like the Viterbi output (MSB first)
       memset(shiftRegister, 1, 9);
-      descrambler[subChId] = new u8[24 * t->bitRate];
+      descrambler[subChId] = new u8[24 * t->bitRate / 8]();
 
       for (i32 j = 0; j < 24 * t->bitRate; j++)
       {
@@ -371,7 +372,7 @@ i32 EtiGenerator::_process_cif(const i16 * input, u8 * output, i32 offset)
           shiftRegister[k] = shiftRegister[k - 1];
         }
         shiftRegister[0] = b;
-        descrambler[subChId][j] = b;
+        descrambler[subChId][j >> 3] |= b << (7 - (j & 7));
       }
     }
     //	we need to save a reference to the parameters
@@ -383,32 +384,9 @@ i32 EtiGenerator::_process_cif(const i16 * input, u8 * output, i32 offset)
 
 void EtiGenerator::_process_sub_channel(i32 /*nr*/, parameter * p, Protection * prot, u8 * desc)
 {
-  std::unique_ptr<u8[]> outVector{ new u8[24 * p->bitRate] };
-  if (!outVector)
-  {
-    std::cerr << "process_subCh - alloc fail";
-    return;
-  }
-
-  memset(outVector.get(), 0, sizeof(u8) * 24 * p->bitRate);
-
-  prot->deconvolve(&p->input[p->start_cu * cCuSizeBytes], p->size * cCuSizeBytes, outVector.get());
-  //
-  for (i32 j = 0; j < 24 * p->bitRate; j++)
-  {
-    outVector[j] ^= desc[j];
-  }
-  //
-  //	and the storage:
-  for (i32 j = 0; j < 24 * p->bitRate / 8; j++)
-  {
-    i32 temp = 0;
-    for (i32 k = 0; k < 8; k++)
-    {
-      temp = (temp << 1) | (outVector[j * 8 + k] & 01);
-    }
-    p->output[j] = temp;
-  }
+  // the Viterbi output is packed (24 * bitRate / 8 bytes) and gets the energy dispersal reversed on the way,
+  // so it is written directly into the ETI frame
+  prot->deconvolve(&p->input[p->start_cu * cCuSizeBytes], p->size * cCuSizeBytes, p->output, desc);
 }
 
 bool EtiGenerator::start_eti_generator(const QString & f)
@@ -57,7 +57,6 @@
 #include "fic_decoder.h"
 #include "protection.h"
 
-class DabRadio;
 class parameter;
 
 //	to build a simple cache for the protection handlers
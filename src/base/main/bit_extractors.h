@@ -186,3 +186,17 @@ static inline u32 extract_bits_from_byte_stream(const u8 * const ipData, const i
   return static_cast<u32>((accum >> shift) & ((1ULL << iNumBits) - 1));
 }
 
+// Extracts a single bit from a big-endian byte stream ipData (iBitOffset counting from the MSB of ipData[0]).
+static inline u8 extract_bit_from_byte_stream(const u8 * const ipData, const i32 iBitOffset)
+{
+  return (ipData[iBitOffset >> 3] >> (7 - (iBitOffset & 7))) & 0x1;
+}
+
+// Extracts 8 bits from a big-endian byte stream ipData at any bit offset (reads only the bytes containing these bits).
+static inline u8 extract_byte_from_byte_stream(const u8 * const ipData, const i32 iBitOffset)
+{
+  const u8 * const p = ipData + (iBitOffset >> 3);
+  const i32 shift = iBitOffset & 7;
+  return shift == 0 ? p[0] : (u8)((p[0] << shift) | (p[1] >> (8 - shift)));
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "glob_data_types.h"
+#include "tii_detector.h"
+#include "fib_decoder_if.h"
+#include "journaline_data.h"
+#include <memory>
+#include <vector>
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+#ifdef HAVE_SSE_OR_AVX
+  #include "ofdm_decoder_simd.h"
+#else
+  #include "ofdm_decoder.h"
+#endif
+
+// Receives all results and status information of the DAB decoder chain (dabstar_core library).
+// The methods are called directly from the decoder threads (DabProcessor thread, CIF decode pool workers),
+// so an implementation has to do its own thread hand-over (the GUI uses queued calls, see dabradio_observer.cpp).
+// The core classes forward their signals with the sending object as context and Qt::DirectConnection, so the forwarding
+// ends with the sender and does not depend on the thread affinity of the sender.
+// All methods have an empty default implementation, so a client only overrides what it is interested in.
+class IDabObserver
+{
+public:
+  virtual ~IDabObserver() = default;
+
+  enum EAudioFlags : u32
+  {
+    AFL_NONE     = 0x0,
+    AFL_SBR_USED = 0x1,
+    AFL_PS_USED  = 0x2
+  };
+
+  // synchronization and OFDM (DabProcessor, SampleReader, PhaseReference, OfdmDecoder)
+  virtual void no_dip_sync_found() {}
+  virtual void dip_sync_found() {}
+  virtual void show_spectrum(i32 /*iAmount*/) {}
+  virtual void show_cir() {}
+  virtual void show_correlation(f32 /*iThreshold*/, const QVector<i32> & /*iV*/) {}
+  virtual void show_iq(i32 /*iAmount*/, f32 /*iAvg*/) {}
+  virtual void show_lcd_data(const OfdmDecoder::SLcdData & /*iLcdData*/) {}
+  virtual void show_tii(const std::vector<STiiResult> & /*iTr*/) {}
+  virtual void show_clock_error(f32 /*iClockErrHz*/) {}
+  virtual void set_and_show_freq_corr_rf_Hz(i32 /*iFreqCorrRF*/) {}
+  virtual void show_freq_corr_bb_Hz(i32 /*iFreqCorrBB*/) {}
+  virtual void show_digital_peak_and_rms_level(f32 /*iLevelPeak*/, f32 /*iLevelRms*/) {}
+
+  // FIC (FicDecoder, FibDecoder)
+  virtual void show_fic_status(i32 /*iSuccessPercent*/, f32 /*iBER*/) {}
+  virtual void fib_loaded_state(IFibDecoder::EFibLoadingState /*iFibLoadingState*/) {}
+  virtual void name_of_ensemble(i32 /*iEId*/, const QString & /*iEnsName*/, const QString & /*iEnsNameShort*/) {}
+  virtual void fib_time(const IFibDecoder::SUtcTimeSet & /*iFibTimeInfo*/) {}
+  virtual void change_in_configuration() {}
+  virtual void start_announcement(const QString & /*iName*/, i32 /*iSubChId*/) {}
+  virtual void stop_announcement(const QString & /*iName*/, i32 /*iSubChId*/) {}
+
+  // audio services (Mp2Processor, Mp4Processor, AAC decoder), the PCM data goes through the audio ring buffer
+  virtual void new_audio(i32 /*iNumSamples*/, u32 /*iAudioSampleRate*/, u32 /*iAudioFlags*/) {}
+  virtual void new_aac_mp2_frame() {}
+  virtual void show_frame_errors(i32 /*iFrameErrors*/) {}
+  virtual void show_rs_errors(i32 /*iRsErrors*/) {}
+  virtual void show_aac_errors(i32 /*iAacErrors*/) {}
+  virtual void show_rs_corrections(i32 /*iRsError*/, i32 /*iCrcError*/) {}
+  virtual void set_stereo(bool /*iStereo*/) {}
+
+  // PAD and data services (PadHandler, MOT, TDC, IP, Journaline)
+  virtual void show_label(const QString & /*iLabel*/) {}
+  virtual void trigger_mot_indicator() {}
+  virtual void pad_mot_progress(i32 /*iPercent*/) {}
+  virtual void handle_mot_object(const QByteArray & /*iResult*/, const QString & /*iObjectName*/, i32 /*iContentType*/, bool /*iDirElement*/) {}
+  virtual void send_datagram(i32 /*iLength*/) {}
+  virtual void handle_tdc_data(i32 /*iFrameType*/, i32 /*iLength*/) {}
+  // the Journaline database is shared with the data handler, it is filled as long as the service runs
+  virtual void journaline_started(i32 /*iSubChannel*/, const std::shared_ptr<TJournalineMap> & /*ipDataMap*/) {}
+  virtual void journaline_new_data(i32 /*iSubChannel*/) {}
+  virtual void journaline_stopped(i32 /*iSubChannel*/) {}
+};
@@ -30,9 +30,14 @@
  */
 #include "dab_processor.h"
 #include "msc_handler.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "process_params.h"
 #include "eti_generator.h"
+#include "mp4processor.h"
+
+#ifdef HAVE_SSE_OR_AVX
+  #include <volk/volk.h>
+#endif
 
 /**
   * \brief DabProcessor
@@ -47,14 +52,14 @@
 // which read their samples there (rtl_tcp) deliver nothing at all during the settle time.
 static constexpr i32 cSettleSampleCnt = INPUT_RATE / 4; // 250 ms
 
-DabProcessor::DabProcessor(DabRadio * const mr, IDeviceHandler * const inputDevice, ProcessParams * const p)
-  : mpRadioInterface(mr)
-  , mSampleReader(mr, inputDevice, p->spectrumBuffer)
-  , mFicHandler(mr)
+DabProcessor::DabProcessor(IDabObserver * const ipObserver, IDeviceHandler * const inputDevice, ProcessParams * const p)
+  : mpDabObserver(ipObserver)
+  , mSampleReader(ipObserver, inputDevice, p->spectrumBuffer)
+  , mFicHandler(ipObserver)
   , mpFibDecoder(mFicHandler.get_fib_decoder())
-  , mMscHandler(mr, p->frameBuffer)
-  , mPhaseReference(mr, p)
-  , mOfdmDecoder(mr, p->iqBuffer, p->carrBuffer)
+  , mMscHandler(ipObserver, p->frameBuffer)
+  , mPhaseReference(ipObserver, p)
+  , mOfdmDecoder(ipObserver, p->iqBuffer, p->carrBuffer)
   , mTimeSyncer(&mSampleReader)
   , mcThreshold(p->threshold)
   , mcTiiFramesToCount(p->tiiFramesToCount)
@@ -62,12 +67,19 @@ DabProcessor::DabProcessor(DabRadio * const mr, IDeviceHandler * const inputDevi
 {
   mFftPlan = fftwf_plan_dft_1d(cTu, (fftwf_complex*)mFftInBuffer.data(), (fftwf_complex*)mFftOutBuffer.data(), FFTW_FORWARD, FFTW_ESTIMATE);
 
-  connect(this, &DabProcessor::signal_show_spectrum, mpRadioInterface, &DabRadio::slot_show_spectrum);
-  connect(this, &DabProcessor::signal_show_tii, mpRadioInterface, &DabRadio::slot_show_tii);
-  connect(this, &DabProcessor::signal_show_clock_err, mpRadioInterface, &DabRadio::slot_show_clock_error);
-  connect(this, &DabProcessor::signal_set_and_show_freq_corr_rf_Hz, mpRadioInterface, &DabRadio::slot_set_and_show_freq_corr_rf_Hz);
-  connect(this, &DabProcessor::signal_show_freq_corr_bb_Hz, mpRadioInterface, &DabRadio::slot_show_freq_corr_bb_Hz);
-  connect(this, &DabProcessor::signal_linear_peak_and_rms_level, mpRadioInterface, &DabRadio::slot_show_digital_peak_and_rms_level);
+  if (mpDabObserver != nullptr)
+  {
+    // the signals are forwarded directly (in the DabProcessor thread) to the observer
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &DabProcessor::signal_no_dip_sync_found, this, [pObs]() { pObs->no_dip_sync_found(); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_dip_sync_found, this, [pObs]() { pObs->dip_sync_found(); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_show_spectrum, this, [pObs](i32 iAmount) { pObs->show_spectrum(iAmount); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_show_tii, this, [pObs](const std::vector<STiiResult> & iTr) { pObs->show_tii(iTr); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_show_clock_err, this, [pObs](f32 iClockErr) { pObs->show_clock_error(iClockErr); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_set_and_show_freq_corr_rf_Hz, this, [pObs](i32 iFreqCorr) { pObs->set_and_show_freq_corr_rf_Hz(iFreqCorr); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_show_freq_corr_bb_Hz, this, [pObs](i32 iFreqCorr) { pObs->show_freq_corr_bb_Hz(iFreqCorr); }, Qt::DirectConnection);
+    connect(this, &DabProcessor::signal_linear_peak_and_rms_level, this, [pObs](f32 iPeak, f32 iRms) { pObs->show_digital_peak_and_rms_level(iPeak, iRms); }, Qt::DirectConnection);
+  }
 
   mBits.resize(c2K);
   mTiiDetector.reset();
@@ -582,6 +594,16 @@ void DabProcessor::slot_soft_bit_gen_type(ESoftBitType iSoftBitType)
   mOfdmDecoder.set_soft_bit_gen_type(iSoftBitType);
 }
 
+void DabProcessor::set_fused_ofdm_kernel(bool iUseFusedKernel)
+{
+  mOfdmDecoder.set_use_fused_kernel(iUseFusedKernel);
+}
+
+void DabProcessor::set_audio_concealment(bool iConcealDropouts)
+{
+  Mp4Processor::set_concealment(iConcealDropouts); // valid for all DAB+ services, also the ones of the full multiplex
+}
+
 void DabProcessor::set_dc_avoidance_algorithm(bool iUseDcAvoidanceAlgorithm)
 {
   if (!iUseDcAvoidanceAlgorithm)
@@ -63,7 +63,7 @@
   #include "time_meas.h"
 #endif
 
-class DabRadio;
+class IDabObserver;
 class DabParams;
 class ProcessParams;
 class EtiGenerator;
@@ -72,7 +72,7 @@ class DabProcessor : public QThread
 {
 Q_OBJECT
 public:
-  DabProcessor(DabRadio * mr, IDeviceHandler * inputDevice, ProcessParams * p);
+  DabProcessor(IDabObserver * ipObserver, IDeviceHandler * inputDevice, ProcessParams * p);
   ~DabProcessor() override;
 
   inline IFibDecoder * get_fib_decoder() const { return mpFibDecoder; };
@@ -99,9 +99,18 @@ public:
   void stop_all_services();
   bool set_audio_channel(const SAudioData & iAD, RingBuffer<i16> * ipoAudioBuffer, EProcessFlag iProcessFlag);
   bool set_data_channel(const SPacketData & iPD, RingBuffer<u8> *, EProcessFlag iProcessFlag);
+  CifDecodePool::SStatistics get_cif_decode_pool_statistics() { return mMscHandler.get_decode_pool_statistics(); }
+  i32 get_fic_frame_statistics(std::vector<FicDecoder::SFicFrameStatistics> & oStatistics) { return mFicHandler.get_fic_frame_statistics(oStatistics); }
+  i32 start_full_multiplex() { return mMscHandler.start_full_multiplex(mpFibDecoder); }
+  void stop_full_multiplex() { mMscHandler.stop_full_multiplex(); }
+  bool is_full_multiplex_running() const { return mMscHandler.is_full_multiplex_running(); }
+  std::vector<std::shared_ptr<MscHandler::SMuxSubChannel>> get_full_multiplex_sub_channels() const { return mMscHandler.get_full_multiplex_sub_channels(); }
+  std::vector<MscHandler::SMuxLoad> get_full_multiplex_load() { return mMscHandler.get_full_multiplex_load(); }
 
   void set_sync_on_strongest_peak(bool);
   void set_dc_avoidance_algorithm(bool iUseDcAvoidanceAlgorithm);
+  void set_fused_ofdm_kernel(bool iUseFusedKernel);
+  void set_audio_concealment(bool iConcealDropouts);
   void set_dc_and_iq_correction(bool iDoDcCorr, bool iDoIqCorr);
   void set_tii_processing(bool);
   void set_tii_threshold(u8);
@@ -109,7 +118,7 @@ public:
   void set_tii_collisions(bool);
 
 private:
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   SampleReader mSampleReader;
   FicDecoder mFicHandler;
   IFibDecoder * const mpFibDecoder;
@@ -50,6 +50,7 @@
 #include "audio_pipeline.h"
 #include "mot_slide_progress.h"
 #include "window_visibility_watcher.h"
+#include "journaline_viewer.h"
 #include <QMessageBox>
 #include <QDesktopServices>
 
@@ -428,12 +429,12 @@ void DabRadio::_connect_dab_processor_signals()
   mSignalSlotConn =
   {
     // DAB processor related connections
-    connect(mpDabProcessor->get_fib_decoder(), &IFibDecoder::signal_fib_loaded_state, this, &DabRadio::_slot_fib_loaded_state, Qt::QueuedConnection),
-    connect(mpDabProcessor.get(), &DabProcessor::signal_no_dip_sync_found, this, &DabRadio::_slot_no_dip_sync_found),
-    connect(mpDabProcessor.get(), &DabProcessor::signal_dip_sync_found, this, &DabRadio::_slot_dip_sync_found),
     connect(mpSpectrumViewer.get(), &SpectrumViewer::signal_cmb_carrier_changed, mpDabProcessor.get(), &DabProcessor::slot_select_carrier_plot_type),
     connect(mpSpectrumViewer.get(), &SpectrumViewer::signal_cmb_iq_scope_changed, mpDabProcessor.get(), &DabProcessor::slot_select_iq_plot_type),
-    connect(mpConfig->cmbSoftBitGen, qOverload<i32>(&QComboBox::currentIndexChanged), mpDabProcessor.get(), [this](i32 idx) { mpDabProcessor->slot_soft_bit_gen_type((ESoftBitType)idx); })
+    connect(mpConfig->cmbSoftBitGen, qOverload<i32>(&QComboBox::currentIndexChanged), mpDabProcessor.get(), [this](i32 idx) { mpDabProcessor->slot_soft_bit_gen_type((ESoftBitType)idx); }),
+    connect(mpConfig->cbUseFusedOfdmKernel, &QCheckBox::clicked, mpDabProcessor.get(), [this](bool iChecked) { mpDabProcessor->set_fused_ofdm_kernel(iChecked); }),
+    connect(mpConfig->cbAudioConcealment, &QCheckBox::clicked, mpDabProcessor.get(), [this](bool iChecked) { mpDabProcessor->set_audio_concealment(iChecked); }),
+    connect(mpConfig->cbDecodeFullMultiplex, &QCheckBox::clicked, mpDabProcessor.get(), [this](bool iChecked) { _set_full_multiplex(iChecked); })
   };
 }
 
@@ -902,6 +903,11 @@ void DabRadio::_slot_fib_loaded_state(IFibDecoder::EFibLoadingState iFibLoadingS
   {
     if (!mIsScanning) // ioChannelDesc.SId_next is invalid while scanning
     {
+      if (Settings::Config::cbDecodeFullMultiplex.read().toBool())
+      {
+        _set_full_multiplex(true);
+      }
+
       // u32 sId = mChannelDesc.get_sId_next();
       //
       // // If no SID is given, look in the service list for the first audio service
@@ -944,6 +950,40 @@ void DabRadio::_slot_fib_loaded_state(IFibDecoder::EFibLoadingState iFibLoadingS
   }
 }
 
+// Full multiplex decoding is (re)started with the complete FIB data of a new channel, a channel stop resets it
+void DabRadio::_set_full_multiplex(const bool iDecode)
+{
+  if (!iDecode)
+  {
+    mpDabProcessor->stop_full_multiplex();
+    return;
+  }
+
+  if (mIsChannelRunning && !mIsScanning)
+  {
+    mpDabProcessor->start_full_multiplex();
+    mMuxLoadLogCnt = 0;
+  }
+}
+
+void DabRadio::_log_full_multiplex_load() const
+{
+  const std::vector<MscHandler::SMuxLoad> loadList = mpDabProcessor->get_full_multiplex_load();
+  const CifDecodePool::SStatistics ps = mpDabProcessor->get_cif_decode_pool_statistics();
+  f32 loadSum = 0.0f;
+
+  for (const auto & l : loadList)
+  {
+    qCInfo(sLogDabRadio, "Mux SubCh %2d SId %8X %-16s %3d kbit/s: CPU load %5.2f%%, decode avr %7.1f us max %7.1f us, segments %llu dropped %llu",
+           l.SubChId, l.SId, l.serviceLabel.toUtf8().constData(), l.bitRate, l.cpuLoadPercent, l.decodeAvrUs, l.decodeMaxUs,
+           (unsigned long long)l.segmentsDone, (unsigned long long)l.segmentsDropped);
+    loadSum += l.cpuLoadPercent;
+  }
+
+  qCInfo(sLogDabRadio, "Mux %d sub-channels: CPU load sum %.1f%% of %d workers, queue depth max %d, segments dropped overall %llu",
+         (i32)loadList.size(), loadSum, ps.numWorkers, ps.queueDepthMax, (unsigned long long)ps.segmentsDropped);
+}
+
 void DabRadio::_write_warning_message(const QString & iMsg) const
 {
   ui->lblDynLabel->setStyleSheet("color: #ff9100");
@@ -32,6 +32,7 @@
 
 #include "dab_constants.h"
 #include "dab_processor.h"
+#include "dab_observer_if.h"
 #include "ringbuffer.h"
 #include "band_handler.h"
 #include "process_params.h"
@@ -47,6 +48,7 @@
 #ifdef  DATA_STREAMER
   #include "tcp_server.h"
 #endif
+#include <map>
 #include <memory>
 #include <QStringList>
 #include <QVector>
@@ -71,6 +73,7 @@ class AudioManager;
 class AudioPipeline;
 class MotSlideProgress;
 class WindowVisibilityWatcher;
+class JournalineViewer;
 struct SIdentInfoEL;
 struct SScanResultEL;
 
@@ -95,7 +98,7 @@ struct STheTime
   i32 second; // == -1: no seconds known
 };
 
-class DabRadio : public QWidget
+class DabRadio : public QWidget, public IDabObserver
 {
 Q_OBJECT
 public:
@@ -106,12 +109,42 @@ public:
 
   AudioPipeline * get_audio_pipeline() const;
 
-  enum EAudioFlags : u32
-  {
-    AFL_NONE     = 0x0,
-    AFL_SBR_USED = 0x1,
-    AFL_PS_USED  = 0x2
-  };
+  // IDabObserver, called from the decoder threads, everything is forwarded queued to the GUI thread (see dabradio_observer.cpp)
+  void no_dip_sync_found() override;
+  void dip_sync_found() override;
+  void show_spectrum(i32 iAmount) override;
+  void show_cir() override;
+  void show_correlation(f32 iThreshold, const QVector<i32> & iV) override;
+  void show_iq(i32 iAmount, f32 iAvg) override;
+  void show_lcd_data(const OfdmDecoder::SLcdData & iLcdData) override;
+  void show_tii(const std::vector<STiiResult> & iTr) override;
+  void show_clock_error(f32 iClockErrHz) override;
+  void set_and_show_freq_corr_rf_Hz(i32 iFreqCorrRF) override;
+  void show_freq_corr_bb_Hz(i32 iFreqCorrBB) override;
+  void show_digital_peak_and_rms_level(f32 iLevelPeak, f32 iLevelRms) override;
+  void show_fic_status(i32 iSuccessPercent, f32 iBER) override;
+  void fib_loaded_state(IFibDecoder::EFibLoadingState iFibLoadingState) override;
+  void name_of_ensemble(i32 iEId, const QString & iEnsName, const QString & iEnsNameShort) override;
+  void fib_time(const IFibDecoder::SUtcTimeSet & iFibTimeInfo) override;
+  void change_in_configuration() override;
+  void start_announcement(const QString & iName, i32 iSubChId) override;
+  void stop_announcement(const QString & iName, i32 iSubChId) override;
+  void new_audio(i32 iNumSamples, u32 iAudioSampleRate, u32 iAudioFlags) override;
+  void new_aac_mp2_frame() override;
+  void show_frame_errors(i32 iFrameErrors) override;
+  void show_rs_errors(i32 iRsErrors) override;
+  void show_aac_errors(i32 iAacErrors) override;
+  void show_rs_corrections(i32 iRsError, i32 iCrcError) override;
+  void set_stereo(bool iStereo) override;
+  void show_label(const QString & iLabel) override;
+  void trigger_mot_indicator() override;
+  void pad_mot_progress(i32 iPercent) override;
+  void handle_mot_object(const QByteArray & iResult, const QString & iObjectName, i32 iContentType, bool iDirElement) override;
+  void send_datagram(i32 iLength) override;
+  void handle_tdc_data(i32 iFrameType, i32 iLength) override;
+  void journaline_started(i32 iSubChannel, const std::shared_ptr<TJournalineMap> & ipDataMap) override;
+  void journaline_new_data(i32 iSubChannel) override;
+  void journaline_stopped(i32 iSubChannel) override;
 
 private:
   static constexpr i32 cDisplayTimeoutMs     = 1000;
@@ -190,6 +223,7 @@ private:
   QScopedPointer<TiiManager> mpTiiManager;
   QScopedPointer<MotSlideProgress> mpMotSlideProgress;
   std::unique_ptr<IDeviceHandler> mpInputDevice;
+  std::map<i32, std::unique_ptr<JournalineViewer>> mJournalineViewerMap; // key is the sub-channel
   WindowVisibilityWatcher * mpDeviceWindowWatcher = nullptr;
   WindowVisibilityWatcher * mpFibWindowWatcher = nullptr;
 
@@ -197,6 +231,7 @@ private:
   i32 mMaxDistance = -1;
   u32 mResetRingBufferCnt = 0;
   i32 mEnsListRetriggerCnt = 0;
+  i32 mMuxLoadLogCnt = 0;
   usize mPreviousIdleTime = 0;
   usize mPreviousTotalTime = 0;
 
@@ -275,6 +310,8 @@ private:
   bool _create_secondary_backend_packet_service(const SPacketData & iPD) const;
   bool _start_primary_and_secondary_service(u32 iSId, bool iStartPrimaryAudioOnly);
   void _stop_services(bool iStopAlsoGlobServices);
+  void _set_full_multiplex(bool iDecode);
+  void _log_full_multiplex_load() const;
 
   // Channel and Playback Control
   void _start_channel(const QString & iFIdOrCh, u32 iSId);
@@ -28,6 +28,8 @@ void DabRadio::_create_and_init_dab_processor()
 
   mpDabProcessor->set_scan_mode(mIsScanning);
   mpDabProcessor->set_sync_on_strongest_peak(Settings::Config::cbUseStrongestPeak.read().toBool());
+  mpDabProcessor->set_fused_ofdm_kernel(Settings::Config::cbUseFusedOfdmKernel.read().toBool());
+  mpDabProcessor->set_audio_concealment(Settings::Config::cbAudioConcealment.read().toBool());
   mpDabProcessor->set_dc_avoidance_algorithm(!mIsFileMode && Settings::Config::cbUseDcAvoidance.read().toBool());
   mpDabProcessor->set_dc_and_iq_correction(Settings::Config::cbDoDcCorrOnly.read().toBool() || Settings::Config::cbDoDcAndIqCorr.read().toBool(),
                                            Settings::Config::cbDoDcAndIqCorr.read().toBool());
@@ -40,6 +40,11 @@ void DabRadio::_slot_update_time_display()
     ++mResetRingBufferCnt;
   }
 #endif
+  if (mpDabProcessor->is_full_multiplex_running() && ++mMuxLoadLogCnt >= 10)
+  {
+    mMuxLoadLogCnt = 0;
+    _log_full_multiplex_load();
+  }
   if (mDumpStatus.rawDumpActive)
   {
     mpConfig->dumpButton->setText(_seconds_to_timestring(mRawDumpTimer++));
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// DabRadio as IDabObserver of the decoder chain. The observer methods are called from the decoder threads,
+// so each call is forwarded as queued call into the GUI thread (or the audio thread for the AudioPipeline).
+// The arguments are captured by value, like a queued signal/slot connection would copy them.
+
+#include "dabradio.h"
+#include "audio_pipeline.h"
+#include "journaline_viewer.h"
+
+void DabRadio::no_dip_sync_found()
+{
+  QMetaObject::invokeMethod(this, [this]()
+  {
+    if (mpDabProcessor != nullptr) // ignore late calls of an already deleted DabProcessor
+    {
+      _slot_no_dip_sync_found();
+    }
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::dip_sync_found()
+{
+  QMetaObject::invokeMethod(this, [this]()
+  {
+    if (mpDabProcessor != nullptr)
+    {
+      _slot_dip_sync_found();
+    }
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_spectrum(const i32 iAmount)
+{
+  QMetaObject::invokeMethod(this, [this, iAmount]() { slot_show_spectrum(iAmount); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_cir()
+{
+  QMetaObject::invokeMethod(this, [this]() { slot_show_cir(); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_correlation(const f32 iThreshold, const QVector<i32> & iV)
+{
+  QMetaObject::invokeMethod(this, [this, iThreshold, iV]() { slot_show_correlation(iThreshold, iV); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_iq(const i32 iAmount, const f32 iAvg)
+{
+  QMetaObject::invokeMethod(this, [this, iAmount, iAvg]() { slot_show_iq(iAmount, iAvg); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_lcd_data(const OfdmDecoder::SLcdData & iLcdData)
+{
+  QMetaObject::invokeMethod(this, [this, iLcdData]() { slot_show_lcd_data(iLcdData); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_tii(const std::vector<STiiResult> & iTr)
+{
+  QMetaObject::invokeMethod(this, [this, iTr]() { slot_show_tii(iTr); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_clock_error(const f32 iClockErrHz)
+{
+  QMetaObject::invokeMethod(this, [this, iClockErrHz]() { slot_show_clock_error(iClockErrHz); }, Qt::QueuedConnection);
+}
+
+void DabRadio::set_and_show_freq_corr_rf_Hz(const i32 iFreqCorrRF)
+{
+  QMetaObject::invokeMethod(this, [this, iFreqCorrRF]() { slot_set_and_show_freq_corr_rf_Hz(iFreqCorrRF); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_freq_corr_bb_Hz(const i32 iFreqCorrBB)
+{
+  QMetaObject::invokeMethod(this, [this, iFreqCorrBB]() { slot_show_freq_corr_bb_Hz(iFreqCorrBB); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_digital_peak_and_rms_level(const f32 iLevelPeak, const f32 iLevelRms)
+{
+  QMetaObject::invokeMethod(this, [this, iLevelPeak, iLevelRms]() { slot_show_digital_peak_and_rms_level(iLevelPeak, iLevelRms); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_fic_status(const i32 iSuccessPercent, const f32 iBER)
+{
+  QMetaObject::invokeMethod(this, [this, iSuccessPercent, iBER]() { slot_show_fic_status(iSuccessPercent, iBER); }, Qt::QueuedConnection);
+}
+
+void DabRadio::fib_loaded_state(const IFibDecoder::EFibLoadingState iFibLoadingState)
+{
+  QMetaObject::invokeMethod(this, [this, iFibLoadingState]()
+  {
+    if (mpDabProcessor != nullptr)
+    {
+      _slot_fib_loaded_state(iFibLoadingState);
+    }
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::name_of_ensemble(const i32 iEId, const QString & iEnsName, const QString & iEnsNameShort)
+{
+  QMetaObject::invokeMethod(this, [this, iEId, iEnsName, iEnsNameShort]() { slot_name_of_ensemble(iEId, iEnsName, iEnsNameShort); }, Qt::QueuedConnection);
+}
+
+void DabRadio::fib_time(const IFibDecoder::SUtcTimeSet & iFibTimeInfo)
+{
+  QMetaObject::invokeMethod(this, [this, iFibTimeInfo]() { slot_fib_time(iFibTimeInfo); }, Qt::QueuedConnection);
+}
+
+void DabRadio::change_in_configuration()
+{
+  QMetaObject::invokeMethod(this, [this]() { slot_change_in_configuration(); }, Qt::QueuedConnection);
+}
+
+void DabRadio::start_announcement(const QString & iName, const i32 iSubChId)
+{
+  QMetaObject::invokeMethod(this, [this, iName, iSubChId]() { slot_start_announcement(iName, iSubChId); }, Qt::QueuedConnection);
+}
+
+void DabRadio::stop_announcement(const QString & iName, const i32 iSubChId)
+{
+  QMetaObject::invokeMethod(this, [this, iName, iSubChId]() { slot_stop_announcement(iName, iSubChId); }, Qt::QueuedConnection);
+}
+
+void DabRadio::new_audio(const i32 iNumSamples, const u32 iAudioSampleRate, const u32 iAudioFlags)
+{
+  AudioPipeline * const pAudioPipeline = get_audio_pipeline();
+
+  if (pAudioPipeline != nullptr)
+  {
+    QMetaObject::invokeMethod(pAudioPipeline, [pAudioPipeline, iNumSamples, iAudioSampleRate, iAudioFlags]()
+    {
+      pAudioPipeline->slot_new_audio(iNumSamples, iAudioSampleRate, iAudioFlags);
+    }, Qt::QueuedConnection);
+  }
+}
+
+void DabRadio::new_aac_mp2_frame()
+{
+  AudioPipeline * const pAudioPipeline = get_audio_pipeline();
+
+  if (pAudioPipeline != nullptr)
+  {
+    QMetaObject::invokeMethod(pAudioPipeline, [pAudioPipeline]() { pAudioPipeline->slot_new_aac_mp2_frame(); }, Qt::QueuedConnection);
+  }
+}
+
+void DabRadio::show_frame_errors(const i32 iFrameErrors)
+{
+  QMetaObject::invokeMethod(this, [this, iFrameErrors]() { slot_show_frame_errors(iFrameErrors); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_rs_errors(const i32 iRsErrors)
+{
+  QMetaObject::invokeMethod(this, [this, iRsErrors]() { slot_show_rs_errors(iRsErrors); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_aac_errors(const i32 iAacErrors)
+{
+  QMetaObject::invokeMethod(this, [this, iAacErrors]() { slot_show_aac_errors(iAacErrors); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_rs_corrections(const i32 iRsError, const i32 iCrcError)
+{
+  QMetaObject::invokeMethod(this, [this, iRsError, iCrcError]() { slot_show_rs_corrections(iRsError, iCrcError); }, Qt::QueuedConnection);
+}
+
+void DabRadio::set_stereo(const bool iStereo)
+{
+  QMetaObject::invokeMethod(this, [this, iStereo]() { slot_set_stereo(iStereo); }, Qt::QueuedConnection);
+}
+
+void DabRadio::show_label(const QString & iLabel)
+{
+  QMetaObject::invokeMethod(this, [this, iLabel]() { slot_show_label(iLabel); }, Qt::QueuedConnection);
+}
+
+void DabRadio::trigger_mot_indicator()
+{
+  QMetaObject::invokeMethod(this, [this]() { slot_trigger_mot_indicator(); }, Qt::QueuedConnection);
+}
+
+void DabRadio::pad_mot_progress(const i32 iPercent)
+{
+  QMetaObject::invokeMethod(this, [this, iPercent]() { slot_pad_mot_progress(iPercent); }, Qt::QueuedConnection);
+}
+
+void DabRadio::handle_mot_object(const QByteArray & iResult, const QString & iObjectName, const i32 iContentType, const bool iDirElement)
+{
+  QMetaObject::invokeMethod(this, [this, iResult, iObjectName, iContentType, iDirElement]()
+  {
+    slot_handle_mot_object(iResult, iObjectName, iContentType, iDirElement);
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::send_datagram(const i32 iLength)
+{
+  QMetaObject::invokeMethod(this, [this, iLength]() { slot_send_datagram(iLength); }, Qt::QueuedConnection);
+}
+
+void DabRadio::handle_tdc_data(const i32 iFrameType, const i32 iLength)
+{
+  QMetaObject::invokeMethod(this, [this, iFrameType, iLength]() { slot_handle_tdc_data(iFrameType, iLength); }, Qt::QueuedConnection);
+}
+
+// The Journaline viewer windows are part of the GUI, the data handler of the decoder chain only shares its database
+void DabRadio::journaline_started(const i32 iSubChannel, const std::shared_ptr<TJournalineMap> & ipDataMap)
+{
+  QMetaObject::invokeMethod(this, [this, iSubChannel, ipDataMap]()
+  {
+    auto pViewer = std::make_unique<JournalineViewer>(ipDataMap, iSubChannel);
+    connect(pViewer.get(), &JournalineViewer::signal_window_closed, this, &DabRadio::slot_handle_journaline_viewer_closed, Qt::QueuedConnection);
+    mJournalineViewerMap[iSubChannel] = std::move(pViewer);
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::journaline_new_data(const i32 iSubChannel)
+{
+  QMetaObject::invokeMethod(this, [this, iSubChannel]()
+  {
+    const auto it = mJournalineViewerMap.find(iSubChannel);
+
+    if (it != mJournalineViewerMap.end())
+    {
+      it->second->slot_new_data();
+    }
+  }, Qt::QueuedConnection);
+}
+
+void DabRadio::journaline_stopped(const i32 iSubChannel)
+{
+  QMetaObject::invokeMethod(this, [this, iSubChannel]() { mJournalineViewerMap.erase(iSubChannel); }, Qt::QueuedConnection);
+}
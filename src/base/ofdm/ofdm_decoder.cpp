@@ -35,14 +35,14 @@
  *    its invocation results in 2 * Tu bits
  */
 #include "ofdm_decoder.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 
 constexpr f32 cMinNoiseLevel = 1.0f / 32767.0f; // assuming 16 bit sample
 constexpr f32 cMinNoisePower = cMinNoiseLevel * cMinNoiseLevel;
 
-OfdmDecoder::OfdmDecoder(DabRadio * ipMr, RingBuffer<cf32> * ipIqBuffer, RingBuffer<f32> * ipCarrBuffer)
+OfdmDecoder::OfdmDecoder(IDabObserver * ipObserver, RingBuffer<cf32> * ipIqBuffer, RingBuffer<f32> * ipCarrBuffer)
   : PhaseTable()
-  , mpRadioInterface(ipMr)
+  , mpDabObserver(ipObserver)
   , mpIqBuffer(ipIqBuffer)
   , mpCarrBuffer(ipCarrBuffer)
 {
@@ -57,8 +57,12 @@ OfdmDecoder::OfdmDecoder(DabRadio * ipMr, RingBuffer<cf32> * ipIqBuffer, RingBuf
   mMeanPowerVector.resize(cK);
   mMeanSigmaSqVector.resize(cK);
 
-  connect(this, &OfdmDecoder::signal_slot_show_iq, mpRadioInterface, &DabRadio::slot_show_iq);
-  connect(this, &OfdmDecoder::signal_show_lcd_data, mpRadioInterface, &DabRadio::slot_show_lcd_data);
+  if (mpDabObserver != nullptr)
+  {
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &OfdmDecoder::signal_slot_show_iq, this, [pObs](i32 iAmount, f32 iAvg) { pObs->show_iq(iAmount, iAvg); }, Qt::DirectConnection);
+    connect(this, &OfdmDecoder::signal_show_lcd_data, this, [pObs](const SLcdData & iLcdData) { pObs->show_lcd_data(iLcdData); }, Qt::DirectConnection);
+  }
 
   reset();
 }
@@ -41,13 +41,13 @@
 #include <vector>
 #include <atomic>
 
-class DabRadio;
+class IDabObserver;
 
 class OfdmDecoder : public QObject, private PhaseTable
 {
 Q_OBJECT
 public:
-  OfdmDecoder(DabRadio *, RingBuffer<cf32> * iqBuffer, RingBuffer<f32> * ipCarrBuffer);
+  OfdmDecoder(IDabObserver *, RingBuffer<cf32> * iqBuffer, RingBuffer<f32> * ipCarrBuffer);
   ~OfdmDecoder() override;
 
   struct SLcdData
@@ -71,9 +71,10 @@ public:
   void set_soft_bit_gen_type(ESoftBitType iSoftBitType);
 
   inline void set_dc_offset(cf32 iDcOffset) { mDcAdc = iDcOffset; };
+  inline void set_use_fused_kernel(bool) {}; // this variant processes all carriers in one loop anyway
 
 private:
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   FreqInterleaver mFreqInterleaver{};
 
   RingBuffer<cf32> * const mpIqBuffer;
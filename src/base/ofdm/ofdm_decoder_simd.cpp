@@ -10,7 +10,7 @@
  * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
  * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include "ofdm_decoder_simd.h"
 #include <volk/volk.h>
 
@@ -20,16 +20,18 @@
 constexpr f32 cMinNoiseLevel = 1.0f / 32767.0f; // assuming 16 bit sample
 constexpr f32 cMinNoisePower = cMinNoiseLevel * cMinNoiseLevel;
 
-OfdmDecoder::OfdmDecoder(DabRadio * ipMr, RingBuffer<cf32> * ipIqBuffer, RingBuffer<f32> * ipCarrBuffer)
+OfdmDecoder::OfdmDecoder(IDabObserver * ipObserver, RingBuffer<cf32> * ipIqBuffer, RingBuffer<f32> * ipCarrBuffer)
   : PhaseTable()
-  , mpRadioInterface(ipMr)
+  , mpDabObserver(ipObserver)
   , mpIqBuffer(ipIqBuffer)
   , mpCarrBuffer(ipCarrBuffer)
+  , mSoftBitKernel(get_ofdm_soft_bit_kernel())
 {
   mIqVector.resize(cK);
   mCarrVector.resize(cK);
 
   qInfo() << "Using VOLK machine" << volk_get_machine() << "with alignment" << volk_get_alignment();
+  qInfo("Using %s kernel for fused OFDM soft-bit generation", mSoftBitKernel.pName);
 
   for (i16 nomCarrIdx = 0; nomCarrIdx < cK; ++nomCarrIdx)
   {
@@ -55,8 +57,12 @@ OfdmDecoder::OfdmDecoder(DabRadio * ipMr, RingBuffer<cf32> * ipIqBuffer, RingBuf
     mSimdVecPhaseConst[nomCarrIdx] = F_M_PI / 1024.0f * (f32)(cK / 2 - realCarrRelIdx) / (f32)(cK / 2);
   }
 
-  connect(this, &OfdmDecoder::signal_slot_show_iq, mpRadioInterface, &DabRadio::slot_show_iq);
-  connect(this, &OfdmDecoder::signal_show_lcd_data, mpRadioInterface, &DabRadio::slot_show_lcd_data);
+  if (mpDabObserver != nullptr)
+  {
+    IDabObserver * const pObs = mpDabObserver;
+    connect(this, &OfdmDecoder::signal_slot_show_iq, this, [pObs](i32 iAmount, f32 iAvg) { pObs->show_iq(iAmount, iAvg); }, Qt::DirectConnection);
+    connect(this, &OfdmDecoder::signal_show_lcd_data, this, [pObs](const SLcdData & iLcdData) { pObs->show_lcd_data(iLcdData); }, Qt::DirectConnection);
+  }
 
   reset();
 }
@@ -123,12 +129,74 @@ void OfdmDecoder::store_reference_symbol_0(const TArrayTu & iFftBuffer)
 
 void OfdmDecoder::decode_symbol(const TArrayTu & iFftBuffer, const u16 iCurOfdmSymbIdx, const f32 iPhaseCorr, const f32 iClockErr, std::vector<i16> & oBits)
 {
-  // current runtime on i7-6700K: avr: 57us, min: 19us
+  // current runtime on i7-6700K: avr: 57us, min: 19us (SimdVec chain)
   // mTimeMeas.trigger_begin();
 
   mDcFftLast = mDcFft;
   mDcFft = iFftBuffer[0];
 
+  if (mUseFusedKernel.load(std::memory_order_relaxed))
+  {
+    _decode_carriers_fused(iFftBuffer, iClockErr, oBits);
+  }
+  else
+  {
+    _decode_carriers_simd_vec(iFftBuffer, iClockErr, oBits);
+  }
+
+  // mTimeMeas.trigger_end();
+  // if (iCurOfdmSymbIdx == 1) mTimeMeas.print_time_per_round();
+
+  if (iCurOfdmSymbIdx == 1)
+  {
+    const f32 FreqCorr = iPhaseCorr / F_2_M_PI * (f32)cCarrDiff;
+    mean_filter(mMeanSigmaSqFreqCorr, FreqCorr * FreqCorr, 0.2f);
+  }
+
+  // displaying IQ scope and carrier scope
+  ++mShowCntIqScope;
+  ++mShowCntStatistics;
+  const bool showScopeData = (mShowCntIqScope > cL && iCurOfdmSymbIdx == mNextShownOfdmSymbIdx);
+  const bool showStatisticData = (mShowCntStatistics > 5 * cL && iCurOfdmSymbIdx == mNextShownOfdmSymbIdx);
+
+  if (showScopeData || showStatisticData)
+  {
+    mMeanPowerOvrAll = mSimdVecMeanPower.get_sum_of_elements() / cK;
+  }
+
+  if (showScopeData)
+  {
+    _display_iq_and_carr_vectors();
+
+    // From time to time we show the constellation of the current symbol
+    mpIqBuffer->put_data_into_ring_buffer(mIqVector.data(), cK);
+    mpCarrBuffer->put_data_into_ring_buffer(mCarrVector.data(), cK);
+    emit signal_slot_show_iq(cK, 1.0f /*mGain / TOP_VAL*/);
+    mShowCntIqScope = 0;
+  }
+
+  if (showStatisticData)
+  {
+    const f32 noisePow = mSimdVecMeanNullPowerWithoutTII.get_sum_of_elements() / (f32)cK + cMinNoisePower;
+    f32 snr = (mMeanPowerOvrAll - noisePow) / noisePow;
+    if (snr <= 0.0f) snr = 0.1f;
+    mLcdData.CurOfdmSymbolNo = iCurOfdmSymbIdx + 1; // as "idx" goes from 0...(L-1)
+    mLcdData.MER = 10.0f * std::log10(F_M_PI_4 * F_M_PI_4 * cK / mSimdVecStdDevSqPhaseVec.get_sum_of_elements());
+    mLcdData.MeanSigmaSqFreqCorr = std::sqrt(mMeanSigmaSqFreqCorr);
+    mLcdData.SNR = 10.0f * std::log10(snr);
+    mLcdData.TestData1 = mMeanValue;
+    mLcdData.TestData2 = iPhaseCorr / F_2_M_PI * (f32)cK;
+
+    emit signal_show_lcd_data(mLcdData);
+
+    mShowCntStatistics = 0;
+    mNextShownOfdmSymbIdx = (mNextShownOfdmSymbIdx + 1) % cL;
+    if (mNextShownOfdmSymbIdx == 0) mNextShownOfdmSymbIdx = 1; // as iCurSymbolNo can never be zero here
+  }
+}
+
+void OfdmDecoder::_decode_carriers_simd_vec(const TArrayTu & iFftBuffer, const f32 iClockErr, std::vector<i16> & oBits)
+{
   // do frequency de-interleaving and transform FFT vector to contiguous field
   LOOP_OVER_K
   {
@@ -227,60 +295,40 @@ void OfdmDecoder::decode_symbol(const TArrayTu & iFftBuffer, const u16 iCurOfdmS
     oBits[cK + nomCarrIdx] = (i16)(mSimdVecDecodingImag[nomCarrIdx]);
   }
 
-  // mTimeMeas.trigger_end();
-  // if (iCurOfdmSymbIdx == 1) mTimeMeas.print_time_per_round();
-
-  if (iCurOfdmSymbIdx == 1)
-  {
-    const f32 FreqCorr = iPhaseCorr / F_2_M_PI * (f32)cCarrDiff;
-    mean_filter(mMeanSigmaSqFreqCorr, FreqCorr * FreqCorr, 0.2f);
-  }
-
-  // displaying IQ scope and carrier scope
-  ++mShowCntIqScope;
-  ++mShowCntStatistics;
-  const bool showScopeData = (mShowCntIqScope > cL && iCurOfdmSymbIdx == mNextShownOfdmSymbIdx);
-  const bool showStatisticData = (mShowCntStatistics > 5 * cL && iCurOfdmSymbIdx == mNextShownOfdmSymbIdx);
-
-  if (showScopeData || showStatisticData)
-  {
-    mMeanPowerOvrAll = mSimdVecMeanPower.get_sum_of_elements() / cK;
-  }
-
-  if (showScopeData)
-  {
-    _display_iq_and_carr_vectors();
-
-    // From time to time we show the constellation of the current symbol
-    mpIqBuffer->put_data_into_ring_buffer(mIqVector.data(), cK);
-    mpCarrBuffer->put_data_into_ring_buffer(mCarrVector.data(), cK);
-    emit signal_slot_show_iq(cK, 1.0f /*mGain / TOP_VAL*/);
-    mShowCntIqScope = 0;
-  }
-
-  if (showStatisticData)
-  {
-    const f32 noisePow = mSimdVecMeanNullPowerWithoutTII.get_sum_of_elements() / (f32)cK + cMinNoisePower;
-    f32 snr = (mMeanPowerOvrAll - noisePow) / noisePow;
-    if (snr <= 0.0f) snr = 0.1f;
-    mLcdData.CurOfdmSymbolNo = iCurOfdmSymbIdx + 1; // as "idx" goes from 0...(L-1)
-    mLcdData.MER = 10.0f * std::log10(F_M_PI_4 * F_M_PI_4 * cK / mSimdVecStdDevSqPhaseVec.get_sum_of_elements());
-    mLcdData.MeanSigmaSqFreqCorr = std::sqrt(mMeanSigmaSqFreqCorr);
-    mLcdData.SNR = 10.0f * std::log10(snr);
-    mLcdData.TestData1 = mMeanValue;
-    mLcdData.TestData2 = iPhaseCorr / F_2_M_PI * (f32)cK;
-
-    emit signal_show_lcd_data(mLcdData);
-
-    mShowCntStatistics = 0;
-    mNextShownOfdmSymbIdx = (mNextShownOfdmSymbIdx + 1) % cL;
-    if (mNextShownOfdmSymbIdx == 0) mNextShownOfdmSymbIdx = 1; // as iCurSymbolNo can never be zero here
-  }
-
   // copy current FFT values as next OFDM reference
   memcpy(mSimdVecPhaseReference, mSimdVecNomCarrier, cK * sizeof(cf32));
 }
 
+void OfdmDecoder::_decode_carriers_fused(const TArrayTu & iFftBuffer, const f32 iClockErr, std::vector<i16> & oBits)
+{
+  assert(oBits.size() >= 2 * cK);
+  constexpr f32 cAlpha = 0.005f;
+
+  SOfdmSoftBitArgs args;
+  args.pFftBuffer = iFftBuffer.data();
+  args.pMapNomToFftIdx = mMapNomToFftIdx.data();
+  args.pPhaseConst = mSimdVecPhaseConst;
+  args.pMeanNullPower = mSimdVecMeanNullPowerWithoutTII;
+  args.clockErr = iClockErr;
+  args.alpha = cAlpha;
+  args.integPhaseLimit = F_RAD_PER_DEG * cPhaseShiftLimit;
+  args.softBitType = mSoftBitType.load(std::memory_order_relaxed);
+  args.pPhaseReference = mSimdVecPhaseReference; // is updated in place with the current carriers
+  args.pIntegAbsPhase = mSimdVecIntegAbsPhase;
+  args.pStdDevSqPhase = mSimdVecStdDevSqPhaseVec;
+  args.pMeanLevel = mSimdVecMeanLevel;
+  args.pMeanPower = mSimdVecMeanPower;
+  args.pMeanSigmaSq = mSimdVecMeanSigmaSq;
+  args.pFftBinRaw = mSimdVecFftBinRaw;
+  args.pFftBinPhaseCorr = mSimdVecFftBinPhaseCorr;
+  args.pPhaseErr = mSimdVecPhaseErr;
+  args.pDecodingReal = mSimdVecDecodingReal;
+  args.pDecodingImag = mSimdVecDecodingImag;
+  args.pBits = oBits.data();
+
+  mMeanValue = mSoftBitKernel.pFunc(args);
+}
+
 void OfdmDecoder::_eval_null_symbol_statistics(const TArrayTu & iFftBuffer)
 {
   f32 max = -1e38f;
@@ -361,6 +409,16 @@ void OfdmDecoder::set_soft_bit_gen_type(ESoftBitType iSoftBitType)
   mSoftBitType = iSoftBitType;
 }
 
+void OfdmDecoder::set_use_fused_kernel(bool iUseFusedKernel)
+{
+  mUseFusedKernel = iUseFusedKernel;
+}
+
+void OfdmDecoder::set_soft_bit_kernel(const SOfdmSoftBitKernel & iKernel)
+{
+  mSoftBitKernel = iKernel;
+}
+
 cf32 OfdmDecoder::_interpolate_2d_plane(const cf32 & iStart, const cf32 & iEnd, f32 iPar)
 {
   assert(iPar >= 0.0f && iPar <= 1.0f);
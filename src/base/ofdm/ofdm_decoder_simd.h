@@ -20,17 +20,18 @@
 #include "ringbuffer.h"
 #include "phasetable.h"
 #include "simd_extensions.h"
+#include "ofdm_soft_bit_kernels.h"
 #include <QObject>
 #include <vector>
 #include <atomic>
 
-class DabRadio;
+class IDabObserver;
 
 class OfdmDecoder : public QObject, private PhaseTable
 {
 Q_OBJECT
 public:
-  OfdmDecoder(DabRadio *, RingBuffer<cf32> * iqBuffer, RingBuffer<f32> * ipCarrBuffer);
+  OfdmDecoder(IDabObserver *, RingBuffer<cf32> * iqBuffer, RingBuffer<f32> * ipCarrBuffer);
   ~OfdmDecoder() override = default;
 
   struct SLcdData
@@ -52,11 +53,13 @@ public:
   void set_select_carrier_plot_type(ECarrierPlotType iPlotType);
   void set_select_iq_plot_type(EIqPlotType iPlotType);
   void set_soft_bit_gen_type(ESoftBitType iSoftBitType);
+  void set_use_fused_kernel(bool iUseFusedKernel);
+  void set_soft_bit_kernel(const SOfdmSoftBitKernel & iKernel); // default is the best one for the CPU, not to be changed while decoding
 
   inline void set_dc_offset(cf32 iDcOffset) { mDcAdc = iDcOffset; };
 private:
 
-  DabRadio * const mpRadioInterface;
+  IDabObserver * const mpDabObserver;
   FreqInterleaver mFreqInterleaver{};
 
   RingBuffer<cf32> * const mpIqBuffer;
@@ -65,6 +68,8 @@ private:
   std::atomic<ECarrierPlotType> mCarrierPlotType{ ECarrierPlotType::DEFAULT };
   std::atomic<EIqPlotType> mIqPlotType{ EIqPlotType::DEFAULT };
   std::atomic<ESoftBitType> mSoftBitType{ ESoftBitType::DEFAULT };
+  std::atomic<bool> mUseFusedKernel{ true };
+  SOfdmSoftBitKernel mSoftBitKernel;
 
   i32 mShowCntStatistics = 0;
   i32 mShowCntIqScope = 0;
@@ -118,6 +123,8 @@ private:
   // It isn't even thread safe but due to slow access this shouldn't be any matter
   SLcdData mLcdData{};
 
+  void _decode_carriers_simd_vec(const TArrayTu & iFftBuffer, f32 iClockErr, std::vector<i16> & oBits);
+  void _decode_carriers_fused(const TArrayTu & iFftBuffer, f32 iClockErr, std::vector<i16> & oBits);
   void _eval_null_symbol_statistics(const TArrayTu & iV);
   void _reset_null_symbol_statistics();
   void _display_iq_and_carr_vectors();
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ofdm_soft_bit_kernels.h"
+#include "dab_constants.h"
+#include "cpu_features.h"
+#include <cfloat>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_AVX2  __attribute__((target("avx2")))
+#else
+  #define TARGET_AVX2
+#endif
+
+/*
+ * Notes to the math (same for all variants):
+ * - The phase correction needs sin() and cos() of the phase error. This is done with a range reduction to +/-pi/4 and
+ *   the Cephes polynomials (in the scalar version with std::sin() and std::cos()).
+ * - The phase of a carrier wrapped to the nearest QPSK constellation point (-pi/4..pi/4) is calculated without a
+ *   full atan2(): the carrier is mirrored to the 1st quadrant (which changes only the sign of the result) and then
+ *   turned by -pi/4, so only atan((b - a) / (a + b)) is left (a, b are the absolute real and imaginary parts).
+ *   With the usual range reduction of atan() for arguments above tan(pi/8) the argument becomes -min(a, b) / max(a, b),
+ *   so only one division is needed.
+ */
+
+// Cephes coefficients of sinf(), cosf() (within +/-pi/4) and atanf() (within +/-tan(pi/8))
+constexpr f32 cSin0 = -1.9515295891e-4f;
+constexpr f32 cSin1 =  8.3321608736e-3f;
+constexpr f32 cSin2 = -1.6666654611e-1f;
+constexpr f32 cCos0 =  2.443315711809948e-5f;
+constexpr f32 cCos1 = -1.388731625493765e-3f;
+constexpr f32 cCos2 =  4.166664568298827e-2f;
+constexpr f32 cAtan0 =  8.05374449538e-2f;
+constexpr f32 cAtan1 = -1.38776856032e-1f;
+constexpr f32 cAtan2 =  1.99777106478e-1f;
+constexpr f32 cAtan3 = -3.33329491539e-1f;
+constexpr f32 cTanPi8 = 0.4142135623730950f;
+constexpr f32 cPiO2Hi = 1.5707963705062866f;      // pi/2 = cPiO2Hi + cPiO2Lo
+constexpr f32 cPiO2Lo = -4.3711388286737929e-08f;
+constexpr f32 c2OPi = 0.6366197723675814f;
+
+static f32 get_soft_bit_factor(const ESoftBitType iSoftBitType)
+{
+  return (iSoftBitType == ESoftBitType::SOFTDEC1 ? -100.0f : -140.0f);
+}
+
+f32 ofdm_soft_bit_kernel_scalar(const SOfdmSoftBitArgs & iArgs)
+{
+  const f32 alpha = iArgs.alpha;
+  f32 sum = 0.0f;
+
+  for (i16 nomCarrIdx = 0; nomCarrIdx < cK; ++nomCarrIdx)
+  {
+    // frequency de-interleaving and DQPSK demodulation, the current carrier is the reference for the next symbol
+    const cf32 nomCarrier = iArgs.pFftBuffer[iArgs.pMapNomToFftIdx[nomCarrIdx]];
+    const cf32 phaseRef = iArgs.pPhaseReference[nomCarrIdx];
+    iArgs.pPhaseReference[nomCarrIdx] = nomCarrier;
+    const f32 phaseRefAbs = std::abs(phaseRef);
+    const cf32 fftBinRaw = nomCarrier * std::conj(phaseRef / phaseRefAbs);
+
+    // phase correction
+    f32 & integAbsPhase = iArgs.pIntegAbsPhase[nomCarrIdx];
+    const f32 phaseErr = iArgs.pPhaseConst[nomCarrIdx] * iArgs.clockErr + integAbsPhase;
+    const cf32 fftBin = fftBinRaw * cf32(std::cos(phaseErr), -std::sin(phaseErr));
+    const f32 absReal = std::abs(real(fftBin));
+    const f32 absImag = std::abs(imag(fftBin));
+
+    // phase distance to the nearest QPSK constellation point
+    f32 phaseWrapped = std::atan2(absImag - absReal, absReal + absImag);
+    if ((real(fftBin) < 0.0f) != (imag(fftBin) < 0.0f)) phaseWrapped = -phaseWrapped;
+
+    // integrate phase error to perform the phase correction in the next OFDM symbol
+    integAbsPhase += 0.2f * alpha * phaseWrapped;
+    limit_symmetrically(integAbsPhase, iArgs.integPhaseLimit);
+    mean_filter(iArgs.pStdDevSqPhase[nomCarrIdx], phaseWrapped * phaseWrapped, alpha);
+
+    const f32 fftBinPower = std::norm(fftBin);
+    const f32 fftBinLevel = std::sqrt(fftBinPower);
+    f32 & meanLevel = iArgs.pMeanLevel[nomCarrIdx];
+    f32 & meanPower = iArgs.pMeanPower[nomCarrIdx];
+    mean_filter(meanLevel, fftBinLevel, alpha);
+    mean_filter(meanPower, fftBinPower, alpha);
+
+    // squared distance to the constellation point in the 1st quadrant
+    const f32 meanLevelAtAxis = meanLevel * F_SQRT1_2;
+    const f32 realDist = absReal - meanLevelAtAxis;
+    const f32 imagDist = absImag - meanLevelAtAxis;
+    f32 & meanSigmaSq = iArgs.pMeanSigmaSq[nomCarrIdx];
+    mean_filter(meanSigmaSq, realDist * realDist + imagDist * imagDist, alpha);
+
+    // soft-bit weight
+    const f32 meanNullPower = iArgs.pMeanNullPower[nomCarrIdx];
+    const f32 meanNettoPower = std::min(std::max(meanPower - meanNullPower, 0.1f), 1e6f);
+    const f32 invSnr = meanNullPower / meanNettoPower + 0.7f;
+    f32 weight = phaseRefAbs;
+
+    if (iArgs.softBitType == ESoftBitType::SOFTDEC1)
+    {
+      weight = std::sqrt(weight / fftBinLevel) * (meanLevel / (invSnr * meanSigmaSq));
+    }
+    else if (iArgs.softBitType == ESoftBitType::SOFTDEC2)
+    {
+      weight = weight / invSnr / meanSigmaSq;
+    }
+
+    const f32 decReal = real(fftBin) * weight;
+    const f32 decImag = imag(fftBin) * weight;
+    sum += std::sqrt(decReal * decReal + decImag * decImag);
+
+    iArgs.pFftBinRaw[nomCarrIdx] = fftBinRaw;
+    iArgs.pFftBinPhaseCorr[nomCarrIdx] = fftBin;
+    iArgs.pPhaseErr[nomCarrIdx] = phaseErr;
+    iArgs.pDecodingReal[nomCarrIdx] = decReal;
+    iArgs.pDecodingImag[nomCarrIdx] = decImag;
+  }
+
+  // 2nd pass: apply weight to be conform to the Viterbi input range
+  const f32 meanValue = sum / (f32)cK;
+  const f32 w2 = get_soft_bit_factor(iArgs.softBitType) / meanValue;
+
+  for (i16 nomCarrIdx = 0; nomCarrIdx < cK; ++nomCarrIdx)
+  {
+    f32 & decReal = iArgs.pDecodingReal[nomCarrIdx];
+    f32 & decImag = iArgs.pDecodingImag[nomCarrIdx];
+    decReal *= w2;
+    decImag *= w2;
+    iArgs.pBits[0  + nomCarrIdx] = (i16)decReal;
+    iArgs.pBits[cK + nomCarrIdx] = (i16)decImag;
+  }
+
+  return meanValue;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+// brings the real and imaginary parts of 8 complex values in two separate vectors (with ascending order)
+TARGET_AVX2 static inline void avx2_deinterleave(const __m256 iA, const __m256 iB, __m256 & oRe, __m256 & oIm)
+{
+  oRe = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(iA, iB, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0)));
+  oIm = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(iA, iB, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+TARGET_AVX2 static inline void avx2_load_cplx(const cf32 * const ipV, __m256 & oRe, __m256 & oIm)
+{
+  const f32 * const p = reinterpret_cast<const f32 *>(ipV);
+  avx2_deinterleave(_mm256_loadu_ps(p), _mm256_loadu_ps(p + 8), oRe, oIm);
+}
+
+TARGET_AVX2 static inline void avx2_store_cplx(cf32 * const opV, const __m256 iRe, const __m256 iIm)
+{
+  f32 * const p = reinterpret_cast<f32 *>(opV);
+  const __m256 lo = _mm256_unpacklo_ps(iRe, iIm);
+  const __m256 hi = _mm256_unpackhi_ps(iRe, iIm);
+  _mm256_storeu_ps(p + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+  _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+// collects 8 carriers from the FFT buffer (a complex value is gathered as one double)
+TARGET_AVX2 static inline void avx2_gather_cplx(const cf32 * const ipFft, const i16 * const ipIdx, __m256 & oRe, __m256 & oIm)
+{
+  const __m256i idx = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ipIdx)));
+  const f64 * const p = reinterpret_cast<const f64 *>(ipFft);
+  const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  const __m256d a = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), p, _mm256_castsi256_si128(idx), all, 8);
+  const __m256d b = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), p, _mm256_extracti128_si256(idx, 1), all, 8);
+  avx2_deinterleave(_mm256_castpd_ps(a), _mm256_castpd_ps(b), oRe, oIm);
+}
+
+TARGET_AVX2 static inline __m256 avx2_abs(const __m256 iV)
+{
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), iV);
+}
+
+TARGET_AVX2 static inline __m256 avx2_fmadd(const __m256 iA, const __m256 iB, const __m256 iC) // without FMA instruction
+{
+  return _mm256_add_ps(_mm256_mul_ps(iA, iB), iC);
+}
+
+TARGET_AVX2 static inline void avx2_sincos(const __m256 iX, __m256 & oSin, __m256 & oCos)
+{
+  const __m256 j = _mm256_round_ps(_mm256_mul_ps(iX, _mm256_set1_ps(c2OPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  const __m256i q = _mm256_cvtps_epi32(j);
+  __m256 r = _mm256_sub_ps(iX, _mm256_mul_ps(j, _mm256_set1_ps(cPiO2Hi)));
+  r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(cPiO2Lo)));
+  const __m256 z = _mm256_mul_ps(r, r);
+
+  __m256 s = avx2_fmadd(_mm256_set1_ps(cSin0), z, _mm256_set1_ps(cSin1));
+  s = avx2_fmadd(s, z, _mm256_set1_ps(cSin2));
+  s = avx2_fmadd(_mm256_mul_ps(s, z), r, r);
+
+  __m256 c = avx2_fmadd(_mm256_set1_ps(cCos0), z, _mm256_set1_ps(cCos1));
+  c = avx2_fmadd(c, z, _mm256_set1_ps(cCos2));
+  c = _mm256_mul_ps(_mm256_mul_ps(c, z), z);
+  c = _mm256_add_ps(_mm256_sub_ps(c, _mm256_mul_ps(_mm256_set1_ps(0.5f), z)), _mm256_set1_ps(1.0f));
+
+  // select and sign the results according to the quadrant
+  const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+  const __m256 signSin = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+  const __m256 signCos = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+  oSin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), signSin);
+  oCos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), signCos);
+}
+
+// phase of (iAbsRe, iAbsIm) (both >= 0) minus pi/4
+TARGET_AVX2 static inline __m256 avx2_phase_to_diagonal(const __m256 iAbsRe, const __m256 iAbsIm)
+{
+  const __m256 mx = _mm256_max_ps(iAbsRe, iAbsIm);
+  const __m256 mn = _mm256_min_ps(iAbsRe, iAbsIm);
+  const __m256 diff = _mm256_sub_ps(mx, mn);
+  const __m256 sum = _mm256_add_ps(mx, mn);
+  const __m256 big = _mm256_cmp_ps(diff, _mm256_mul_ps(sum, _mm256_set1_ps(cTanPi8)), _CMP_GT_OQ);
+  const __m256 num = _mm256_blendv_ps(diff, _mm256_sub_ps(_mm256_setzero_ps(), mn), big);
+  const __m256 den = _mm256_max_ps(_mm256_blendv_ps(sum, mx, big), _mm256_set1_ps(FLT_MIN));
+  const __m256 x = _mm256_div_ps(num, den);
+  const __m256 y0 = _mm256_and_ps(big, _mm256_set1_ps(F_M_PI_4));
+  const __m256 z = _mm256_mul_ps(x, x);
+
+  __m256 p = avx2_fmadd(_mm256_set1_ps(cAtan0), z, _mm256_set1_ps(cAtan1));
+  p = avx2_fmadd(p, z, _mm256_set1_ps(cAtan2));
+  p = avx2_fmadd(p, z, _mm256_set1_ps(cAtan3));
+  p = avx2_fmadd(_mm256_mul_ps(p, z), x, x);
+
+  const __m256 sign = _mm256_and_ps(_mm256_sub_ps(iAbsIm, iAbsRe), _mm256_set1_ps(-0.0f));
+  return _mm256_xor_ps(_mm256_add_ps(y0, p), sign);
+}
+
+TARGET_AVX2 static inline __m256 avx2_mean_filter(const __m256 iMean, const __m256 iVal, const __m256 iAlpha)
+{
+  return avx2_fmadd(iAlpha, _mm256_sub_ps(iVal, iMean), iMean);
+}
+
+// converts 16 floats to 16 i16 (with truncation like a C cast)
+TARGET_AVX2 static inline void avx2_store_i16(i16 * const opV, const __m256 iA, const __m256 iB)
+{
+  const __m256i packed = _mm256_packs_epi32(_mm256_cvttps_epi32(iA), _mm256_cvttps_epi32(iB));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(opV), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+TARGET_AVX2
+f32 ofdm_soft_bit_kernel_avx2(const SOfdmSoftBitArgs & iArgs)
+{
+  static_assert(cK % 16 == 0);
+
+  const __m256 alpha = _mm256_set1_ps(iArgs.alpha);
+  const __m256 integAlpha = _mm256_set1_ps(0.2f * iArgs.alpha);
+  const __m256 integLimit = _mm256_set1_ps(iArgs.integPhaseLimit);
+  const __m256 clockErr = _mm256_set1_ps(iArgs.clockErr);
+  const __m256 sqrt1_2 = _mm256_set1_ps(F_SQRT1_2);
+  __m256 sum = _mm256_setzero_ps();
+
+  for (i32 nomCarrIdx = 0; nomCarrIdx < cK; nomCarrIdx += 8)
+  {
+    // frequency de-interleaving and DQPSK demodulation, the current carrier is the reference for the next symbol
+    __m256 nomRe, nomIm, refRe, refIm;
+    avx2_gather_cplx(iArgs.pFftBuffer, iArgs.pMapNomToFftIdx + nomCarrIdx, nomRe, nomIm);
+    avx2_load_cplx(iArgs.pPhaseReference + nomCarrIdx, refRe, refIm);
+    avx2_store_cplx(iArgs.pPhaseReference + nomCarrIdx, nomRe, nomIm);
+
+    const __m256 phaseRefAbs = _mm256_sqrt_ps(avx2_fmadd(refRe, refRe, _mm256_mul_ps(refIm, refIm)));
+    const __m256 invPhaseRefAbs = _mm256_div_ps(_mm256_set1_ps(1.0f), phaseRefAbs);
+    refRe = _mm256_mul_ps(refRe, invPhaseRefAbs);
+    refIm = _mm256_mul_ps(refIm, invPhaseRefAbs);
+    const __m256 rawRe = avx2_fmadd(nomRe, refRe, _mm256_mul_ps(nomIm, refIm));
+    const __m256 rawIm = _mm256_sub_ps(_mm256_mul_ps(nomIm, refRe), _mm256_mul_ps(nomRe, refIm));
+
+    // phase correction
+    __m256 integAbsPhase = _mm256_loadu_ps(iArgs.pIntegAbsPhase + nomCarrIdx);
+    const __m256 phaseErr = avx2_fmadd(_mm256_loadu_ps(iArgs.pPhaseConst + nomCarrIdx), clockErr, integAbsPhase);
+    __m256 sinPhase, cosPhase;
+    avx2_sincos(phaseErr, sinPhase, cosPhase);
+    const __m256 binRe = avx2_fmadd(rawRe, cosPhase, _mm256_mul_ps(rawIm, sinPhase));
+    const __m256 binIm = _mm256_sub_ps(_mm256_mul_ps(rawIm, cosPhase), _mm256_mul_ps(rawRe, sinPhase));
+    const __m256 absRe = avx2_abs(binRe);
+    const __m256 absIm = avx2_abs(binIm);
+
+    // phase distance to the nearest QPSK constellation point
+    const __m256 quadSign = _mm256_and_ps(_mm256_xor_ps(binRe, binIm), _mm256_set1_ps(-0.0f));
+    const __m256 phaseWrapped = _mm256_xor_ps(avx2_phase_to_diagonal(absRe, absIm), quadSign);
+
+    // integrate phase error to perform the phase correction in the next OFDM symbol
+    integAbsPhase = avx2_fmadd(integAlpha, phaseWrapped, integAbsPhase);
+    integAbsPhase = _mm256_max_ps(_mm256_min_ps(integAbsPhase, integLimit), _mm256_sub_ps(_mm256_setzero_ps(), integLimit));
+    _mm256_storeu_ps(iArgs.pIntegAbsPhase + nomCarrIdx, integAbsPhase);
+    const __m256 stdDevSq = avx2_mean_filter(_mm256_loadu_ps(iArgs.pStdDevSqPhase + nomCarrIdx), _mm256_mul_ps(phaseWrapped, phaseWrapped), alpha);
+    _mm256_storeu_ps(iArgs.pStdDevSqPhase + nomCarrIdx, stdDevSq);
+
+    const __m256 binPower = avx2_fmadd(binRe, binRe, _mm256_mul_ps(binIm, binIm));
+    const __m256 binLevel = _mm256_sqrt_ps(binPower);
+    const __m256 meanLevel = avx2_mean_filter(_mm256_loadu_ps(iArgs.pMeanLevel + nomCarrIdx), binLevel, alpha);
+    const __m256 meanPower = avx2_mean_filter(_mm256_loadu_ps(iArgs.pMeanPower + nomCarrIdx), binPower, alpha);
+    _mm256_storeu_ps(iArgs.pMeanLevel + nomCarrIdx, meanLevel);
+    _mm256_storeu_ps(iArgs.pMeanPower + nomCarrIdx, meanPower);
+
+    // squared distance to the constellation point in the 1st quadrant
+    const __m256 meanLevelAtAxis = _mm256_mul_ps(meanLevel, sqrt1_2);
+    const __m256 realDist = _mm256_sub_ps(absRe, meanLevelAtAxis);
+    const __m256 imagDist = _mm256_sub_ps(absIm, meanLevelAtAxis);
+    const __m256 sigmaSq = avx2_fmadd(realDist, realDist, _mm256_mul_ps(imagDist, imagDist));
+    const __m256 meanSigmaSq = avx2_mean_filter(_mm256_loadu_ps(iArgs.pMeanSigmaSq + nomCarrIdx), sigmaSq, alpha);
+    _mm256_storeu_ps(iArgs.pMeanSigmaSq + nomCarrIdx, meanSigmaSq);
+
+    // soft-bit weight
+    const __m256 meanNullPower = _mm256_loadu_ps(iArgs.pMeanNullPower + nomCarrIdx);
+    const __m256 meanNettoPower = _mm256_min_ps(_mm256_max_ps(_mm256_sub_ps(meanPower, meanNullPower), _mm256_set1_ps(0.1f)), _mm256_set1_ps(1e6f));
+    const __m256 invSnr = _mm256_add_ps(_mm256_div_ps(meanNullPower, meanNettoPower), _mm256_set1_ps(0.7f));
+    __m256 weight = phaseRefAbs;
+
+    if (iArgs.softBitType == ESoftBitType::SOFTDEC1)
+    {
+      weight = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_div_ps(weight, binLevel)), _mm256_div_ps(meanLevel, _mm256_mul_ps(invSnr, meanSigmaSq)));
+    }
+    else if (iArgs.softBitType == ESoftBitType::SOFTDEC2)
+    {
+      weight = _mm256_div_ps(_mm256_div_ps(weight, invSnr), meanSigmaSq);
+    }
+
+    const __m256 decRe = _mm256_mul_ps(binRe, weight);
+    const __m256 decIm = _mm256_mul_ps(binIm, weight);
+    sum = avx2_fmadd(binLevel, avx2_abs(weight), sum); // = abs(dec)
+
+    avx2_store_cplx(iArgs.pFftBinRaw + nomCarrIdx, rawRe, rawIm);
+    avx2_store_cplx(iArgs.pFftBinPhaseCorr + nomCarrIdx, binRe, binIm);
+    _mm256_storeu_ps(iArgs.pPhaseErr + nomCarrIdx, phaseErr);
+    _mm256_storeu_ps(iArgs.pDecodingReal + nomCarrIdx, decRe);
+    _mm256_storeu_ps(iArgs.pDecodingImag + nomCarrIdx, decIm);
+  }
+
+  __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+  sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+  sum4 = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 1));
+
+  // 2nd pass: apply weight to be conform to the Viterbi input range
+  const f32 meanValue = _mm_cvtss_f32(sum4) / (f32)cK;
+  const __m256 w2 = _mm256_set1_ps(get_soft_bit_factor(iArgs.softBitType) / meanValue);
+
+  for (i32 nomCarrIdx = 0; nomCarrIdx < cK; nomCarrIdx += 16)
+  {
+    f32 * const pRe = iArgs.pDecodingReal + nomCarrIdx;
+    f32 * const pIm = iArgs.pDecodingImag + nomCarrIdx;
+    const __m256 re0 = _mm256_mul_ps(_mm256_loadu_ps(pRe + 0), w2);
+    const __m256 re1 = _mm256_mul_ps(_mm256_loadu_ps(pRe + 8), w2);
+    const __m256 im0 = _mm256_mul_ps(_mm256_loadu_ps(pIm + 0), w2);
+    const __m256 im1 = _mm256_mul_ps(_mm256_loadu_ps(pIm + 8), w2);
+    _mm256_storeu_ps(pRe + 0, re0);
+    _mm256_storeu_ps(pRe + 8, re1);
+    _mm256_storeu_ps(pIm + 0, im0);
+    _mm256_storeu_ps(pIm + 8, im1);
+    avx2_store_i16(iArgs.pBits + 0  + nomCarrIdx, re0, re1);
+    avx2_store_i16(iArgs.pBits + cK + nomCarrIdx, im0, im1);
+  }
+
+  return meanValue;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static inline void neon_sincos(const float32x4_t iX, float32x4_t & oSin, float32x4_t & oCos)
+{
+  const float32x4_t j = vrndnq_f32(vmulq_n_f32(iX, c2OPi));
+  const int32x4_t q = vcvtq_s32_f32(j);
+  float32x4_t r = vmlsq_n_f32(iX, j, cPiO2Hi);
+  r = vmlsq_n_f32(r, j, cPiO2Lo);
+  const float32x4_t z = vmulq_f32(r, r);
+
+  float32x4_t s = vmlaq_f32(vdupq_n_f32(cSin1), vdupq_n_f32(cSin0), z);
+  s = vmlaq_f32(vdupq_n_f32(cSin2), s, z);
+  s = vmlaq_f32(r, vmulq_f32(s, z), r);
+
+  float32x4_t c = vmlaq_f32(vdupq_n_f32(cCos1), vdupq_n_f32(cCos0), z);
+  c = vmlaq_f32(vdupq_n_f32(cCos2), c, z);
+  c = vmulq_f32(vmulq_f32(c, z), z);
+  c = vaddq_f32(vmlsq_n_f32(c, z, 0.5f), vdupq_n_f32(1.0f));
+
+  // select and sign the results according to the quadrant
+  const uint32x4_t swap = vtstq_s32(q, vdupq_n_s32(1));
+  const uint32x4_t signSin = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(q, vdupq_n_s32(2))), 30);
+  const uint32x4_t signCos = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(vaddq_s32(q, vdupq_n_s32(1)), vdupq_n_s32(2))), 30);
+  oSin = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, c, s)), signSin));
+  oCos = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, s, c)), signCos));
+}
+
+// phase of (iAbsRe, iAbsIm) (both >= 0) minus pi/4
+static inline float32x4_t neon_phase_to_diagonal(const float32x4_t iAbsRe, const float32x4_t iAbsIm)
+{
+  const float32x4_t mx = vmaxq_f32(iAbsRe, iAbsIm);
+  const float32x4_t mn = vminq_f32(iAbsRe, iAbsIm);
+  const float32x4_t diff = vsubq_f32(mx, mn);
+  const float32x4_t sum = vaddq_f32(mx, mn);
+  const uint32x4_t big = vcgtq_f32(diff, vmulq_n_f32(sum, cTanPi8));
+  const float32x4_t num = vbslq_f32(big, vnegq_f32(mn), diff);
+  const float32x4_t den = vmaxq_f32(vbslq_f32(big, mx, sum), vdupq_n_f32(FLT_MIN));
+  const float32x4_t x = vdivq_f32(num, den);
+  const float32x4_t y0 = vreinterpretq_f32_u32(vandq_u32(big, vreinterpretq_u32_f32(vdupq_n_f32(F_M_PI_4))));
+  const float32x4_t z = vmulq_f32(x, x);
+
+  float32x4_t p = vmlaq_f32(vdupq_n_f32(cAtan1), vdupq_n_f32(cAtan0), z);
+  p = vmlaq_f32(vdupq_n_f32(cAtan2), p, z);
+  p = vmlaq_f32(vdupq_n_f32(cAtan3), p, z);
+  p = vmlaq_f32(x, vmulq_f32(p, z), x);
+
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(vsubq_f32(iAbsIm, iAbsRe)), vdupq_n_u32(0x80000000));
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vaddq_f32(y0, p)), sign));
+}
+
+static inline float32x4_t neon_mean_filter(const float32x4_t iMean, const float32x4_t iVal, const f32 iAlpha)
+{
+  return vmlaq_n_f32(iMean, vsubq_f32(iVal, iMean), iAlpha);
+}
+
+f32 ofdm_soft_bit_kernel_neon(const SOfdmSoftBitArgs & iArgs)
+{
+  static_assert(cK % 8 == 0);
+
+  const f32 alpha = iArgs.alpha;
+  const float32x4_t integLimit = vdupq_n_f32(iArgs.integPhaseLimit);
+  float32x4_t sum = vdupq_n_f32(0.0f);
+
+  for (i32 nomCarrIdx = 0; nomCarrIdx < cK; nomCarrIdx += 4)
+  {
+    // frequency de-interleaving and DQPSK demodulation, the current carrier is the reference for the next symbol
+    alignas(16) cf32 nomCarrier[4];
+    for (i32 i = 0; i < 4; ++i)
+    {
+      nomCarrier[i] = iArgs.pFftBuffer[iArgs.pMapNomToFftIdx[nomCarrIdx + i]];
+    }
+    const float32x4x2_t nom = vld2q_f32(reinterpret_cast<const f32 *>(nomCarrier));
+    float32x4x2_t ref = vld2q_f32(reinterpret_cast<const f32 *>(iArgs.pPhaseReference + nomCarrIdx));
+    vst2q_f32(reinterpret_cast<f32 *>(iArgs.pPhaseReference + nomCarrIdx), nom);
+
+    const float32x4_t phaseRefAbs = vsqrtq_f32(vmlaq_f32(vmulq_f32(ref.val[1], ref.val[1]), ref.val[0], ref.val[0]));
+    const float32x4_t invPhaseRefAbs = vdivq_f32(vdupq_n_f32(1.0f), phaseRefAbs);
+    ref.val[0] = vmulq_f32(ref.val[0], invPhaseRefAbs);
+    ref.val[1] = vmulq_f32(ref.val[1], invPhaseRefAbs);
+    float32x4x2_t raw;
+    raw.val[0] = vmlaq_f32(vmulq_f32(nom.val[1], ref.val[1]), nom.val[0], ref.val[0]);
+    raw.val[1] = vmlsq_f32(vmulq_f32(nom.val[1], ref.val[0]), nom.val[0], ref.val[1]);
+
+    // phase correction
+    float32x4_t integAbsPhase = vld1q_f32(iArgs.pIntegAbsPhase + nomCarrIdx);
+    const float32x4_t phaseErr = vmlaq_n_f32(integAbsPhase, vld1q_f32(iArgs.pPhaseConst + nomCarrIdx), iArgs.clockErr);
+    float32x4_t sinPhase, cosPhase;
+    neon_sincos(phaseErr, sinPhase, cosPhase);
+    float32x4x2_t bin;
+    bin.val[0] = vmlaq_f32(vmulq_f32(raw.val[1], sinPhase), raw.val[0], cosPhase);
+    bin.val[1] = vmlsq_f32(vmulq_f32(raw.val[1], cosPhase), raw.val[0], sinPhase);
+    const float32x4_t absRe = vabsq_f32(bin.val[0]);
+    const float32x4_t absIm = vabsq_f32(bin.val[1]);
+
+    // phase distance to the nearest QPSK constellation point
+    const uint32x4_t quadSign = vandq_u32(veorq_u32(vreinterpretq_u32_f32(bin.val[0]), vreinterpretq_u32_f32(bin.val[1])), vdupq_n_u32(0x80000000));
+    const float32x4_t phaseWrapped = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(neon_phase_to_diagonal(absRe, absIm)), quadSign));
+
+    // integrate phase error to perform the phase correction in the next OFDM symbol
+    integAbsPhase = vmlaq_n_f32(integAbsPhase, phaseWrapped, 0.2f * alpha);
+    integAbsPhase = vmaxq_f32(vminq_f32(integAbsPhase, integLimit), vnegq_f32(integLimit));
+    vst1q_f32(iArgs.pIntegAbsPhase + nomCarrIdx, integAbsPhase);
+    vst1q_f32(iArgs.pStdDevSqPhase + nomCarrIdx, neon_mean_filter(vld1q_f32(iArgs.pStdDevSqPhase + nomCarrIdx), vmulq_f32(phaseWrapped, phaseWrapped), alpha));
+
+    const float32x4_t binPower = vmlaq_f32(vmulq_f32(bin.val[1], bin.val[1]), bin.val[0], bin.val[0]);
+    const float32x4_t binLevel = vsqrtq_f32(binPower);
+    const float32x4_t meanLevel = neon_mean_filter(vld1q_f32(iArgs.pMeanLevel + nomCarrIdx), binLevel, alpha);
+    const float32x4_t meanPower = neon_mean_filter(vld1q_f32(iArgs.pMeanPower + nomCarrIdx), binPower, alpha);
+    vst1q_f32(iArgs.pMeanLevel + nomCarrIdx, meanLevel);
+    vst1q_f32(iArgs.pMeanPower + nomCarrIdx, meanPower);
+
+    // squared distance to the constellation point in the 1st quadrant
+    const float32x4_t meanLevelAtAxis = vmulq_n_f32(meanLevel, F_SQRT1_2);
+    const float32x4_t realDist = vsubq_f32(absRe, meanLevelAtAxis);
+    const float32x4_t imagDist = vsubq_f32(absIm, meanLevelAtAxis);
+    const float32x4_t sigmaSq = vmlaq_f32(vmulq_f32(imagDist, imagDist), realDist, realDist);
+    const float32x4_t meanSigmaSq = neon_mean_filter(vld1q_f32(iArgs.pMeanSigmaSq + nomCarrIdx), sigmaSq, alpha);
+    vst1q_f32(iArgs.pMeanSigmaSq + nomCarrIdx, meanSigmaSq);
+
+    // soft-bit weight
+    const float32x4_t meanNullPower = vld1q_f32(iArgs.pMeanNullPower + nomCarrIdx);
+    const float32x4_t meanNettoPower = vminq_f32(vmaxq_f32(vsubq_f32(meanPower, meanNullPower), vdupq_n_f32(0.1f)), vdupq_n_f32(1e6f));
+    const float32x4_t invSnr = vaddq_f32(vdivq_f32(meanNullPower, meanNettoPower), vdupq_n_f32(0.7f));
+    float32x4_t weight = phaseRefAbs;
+
+    if (iArgs.softBitType == ESoftBitType::SOFTDEC1)
+    {
+      weight = vmulq_f32(vsqrtq_f32(vdivq_f32(weight, binLevel)), vdivq_f32(meanLevel, vmulq_f32(invSnr, meanSigmaSq)));
+    }
+    else if (iArgs.softBitType == ESoftBitType::SOFTDEC2)
+    {
+      weight = vdivq_f32(vdivq_f32(weight, invSnr), meanSigmaSq);
+    }
+
+    const float32x4_t decRe = vmulq_f32(bin.val[0], weight);
+    const float32x4_t decIm = vmulq_f32(bin.val[1], weight);
+    sum = vmlaq_f32(sum, binLevel, vabsq_f32(weight)); // = abs(dec)
+
+    vst2q_f32(reinterpret_cast<f32 *>(iArgs.pFftBinRaw + nomCarrIdx), raw);
+    vst2q_f32(reinterpret_cast<f32 *>(iArgs.pFftBinPhaseCorr + nomCarrIdx), bin);
+    vst1q_f32(iArgs.pPhaseErr + nomCarrIdx, phaseErr);
+    vst1q_f32(iArgs.pDecodingReal + nomCarrIdx, decRe);
+    vst1q_f32(iArgs.pDecodingImag + nomCarrIdx, decIm);
+  }
+
+  // 2nd pass: apply weight to be conform to the Viterbi input range
+  const f32 meanValue = vaddvq_f32(sum) / (f32)cK;
+  const f32 w2 = get_soft_bit_factor(iArgs.softBitType) / meanValue;
+
+  for (i32 nomCarrIdx = 0; nomCarrIdx < cK; nomCarrIdx += 8)
+  {
+    f32 * const pRe = iArgs.pDecodingReal + nomCarrIdx;
+    f32 * const pIm = iArgs.pDecodingImag + nomCarrIdx;
+    const float32x4_t re0 = vmulq_n_f32(vld1q_f32(pRe + 0), w2);
+    const float32x4_t re1 = vmulq_n_f32(vld1q_f32(pRe + 4), w2);
+    const float32x4_t im0 = vmulq_n_f32(vld1q_f32(pIm + 0), w2);
+    const float32x4_t im1 = vmulq_n_f32(vld1q_f32(pIm + 4), w2);
+    vst1q_f32(pRe + 0, re0);
+    vst1q_f32(pRe + 4, re1);
+    vst1q_f32(pIm + 0, im0);
+    vst1q_f32(pIm + 4, im1);
+    vst1q_s16(iArgs.pBits + 0  + nomCarrIdx, vcombine_s16(vqmovn_s32(vcvtq_s32_f32(re0)), vqmovn_s32(vcvtq_s32_f32(re1))));
+    vst1q_s16(iArgs.pBits + cK + nomCarrIdx, vcombine_s16(vqmovn_s32(vcvtq_s32_f32(im0)), vqmovn_s32(vcvtq_s32_f32(im1))));
+  }
+
+  return meanValue;
+}
+
+#endif
+
+const SOfdmSoftBitKernel & get_ofdm_soft_bit_kernel()
+{
+  static const SOfdmSoftBitKernel kernel = []() -> SOfdmSoftBitKernel
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (CpuFeatures::has_avx2()) return { ofdm_soft_bit_kernel_avx2, "AVX2" };
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (CpuFeatures::has_neon()) return { ofdm_soft_bit_kernel_neon, "NEON" };
+#endif
+    return { ofdm_soft_bit_kernel_scalar, "Scalar" };
+  }();
+  return kernel;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+/*
+ * Fused soft-bit generation of one OFDM symbol. It does the same calculation as the chain of SimdVec calls in
+ * OfdmDecoder::decode_symbol() (de-interleaving, DQPSK demodulation, phase correction, statistics update and soft-bit
+ * scaling), but with only two passes over the carriers, so all data stays in the cache.
+ * The scalar, AVX2 and NEON (AArch64) variants are compiled in, the best one is chosen at runtime.
+ */
+#include "glob_defs.h"
+#include "glob_enums.h"
+
+struct SOfdmSoftBitArgs
+{
+  // all vectors have cK elements
+  const cf32 * pFftBuffer;          // FFT output (cTu elements)
+  const i16 * pMapNomToFftIdx;      // frequency de-interleaving table
+  const f32 * pPhaseConst;          // clock error to phase error factor per carrier
+  const f32 * pMeanNullPower;       // mean null symbol power (without TII)
+  f32 clockErr;
+  f32 alpha;                        // coefficient of the mean filters
+  f32 integPhaseLimit;              // limit of the integrated phase error in rad
+  ESoftBitType softBitType;
+
+  // state, updated with each call
+  cf32 * pPhaseReference;           // in: carriers of the last symbol, out: carriers of this symbol
+  f32 * pIntegAbsPhase;
+  f32 * pStdDevSqPhase;
+  f32 * pMeanLevel;
+  f32 * pMeanPower;
+  f32 * pMeanSigmaSq;
+
+  // outputs (beside the soft bits also kept for the scopes)
+  cf32 * pFftBinRaw;
+  cf32 * pFftBinPhaseCorr;
+  f32 * pPhaseErr;
+  f32 * pDecodingReal;
+  f32 * pDecodingImag;
+  i16 * pBits;                      // 2 * cK soft bits
+};
+
+// returns the mean magnitude of the (unscaled) soft-bit vectors
+using TOfdmSoftBitKernel = f32 (*)(const SOfdmSoftBitArgs & iArgs);
+
+f32 ofdm_soft_bit_kernel_scalar(const SOfdmSoftBitArgs & iArgs);
+#if defined(__x86_64__) || defined(_M_X64)
+f32 ofdm_soft_bit_kernel_avx2(const SOfdmSoftBitArgs & iArgs);
+#elif defined(__aarch64__) || defined(_M_ARM64)
+f32 ofdm_soft_bit_kernel_neon(const SOfdmSoftBitArgs & iArgs);
+#endif
+
+struct SOfdmSoftBitKernel
+{
+  TOfdmSoftBitKernel pFunc;
+  const char * pName;
+};
+
+const SOfdmSoftBitKernel & get_ofdm_soft_bit_kernel();
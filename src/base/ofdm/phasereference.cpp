@@ -30,7 +30,7 @@
  */
 #include "phasereference.h"
 #include <QVector>
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include <vector>
 #ifdef HAVE_SSE_OR_AVX
   #include <volk/volk.h>
@@ -44,7 +44,7 @@
   * The class inherits from the phaseTable.
   */
 
-PhaseReference::PhaseReference(const DabRadio * const ipRadio, const ProcessParams * const ipParam)
+PhaseReference::PhaseReference(IDabObserver * const ipObserver, const ProcessParams * const ipParam)
   : PhaseTable()
   , mpResponse(ipParam->responseBuffer)
 {
@@ -65,7 +65,10 @@ PhaseReference::PhaseReference(const DabRadio * const ipRadio, const ProcessPara
     mRefArgConj[i] = std::conj(mFftOutBuffer[i]);
   }
 
-  connect(this, &PhaseReference::signal_show_correlation, ipRadio, &DabRadio::slot_show_correlation);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &PhaseReference::signal_show_correlation, this, [ipObserver](f32 iThreshold, const QVector<i32> & iV) { ipObserver->show_correlation(iThreshold, iV); }, Qt::DirectConnection);
+  }
 }
 
 PhaseReference::~PhaseReference()
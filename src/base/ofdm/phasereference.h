@@ -40,14 +40,14 @@
 #include <vector>
 #include <fftw3.h>
 
-class DabRadio;
+class IDabObserver;
 
 
 class PhaseReference : public QObject, public PhaseTable
 {
 Q_OBJECT
 public:
-  PhaseReference(const DabRadio * const ipRadio, const ProcessParams * const ipParam);
+  PhaseReference(IDabObserver * const ipObserver, const ProcessParams * const ipParam);
   ~PhaseReference() override;
 
   [[nodiscard]] i32 correlate_with_phase_ref_and_find_max_peak(const TArrayTn & iV, const f32 iThreshold);
@@ -29,19 +29,131 @@
  *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 #include "sample_reader.h"
-#include "dabradio.h"
+#include "dab_observer_if.h"
 #include <algorithm>
 #include <ctime>
 
-SampleReader::SampleReader(const DabRadio * mr, IDeviceHandler * iTheRig, RingBuffer<cf32> * iSpectrumBuffer)
-  : myRadioInterface(mr)
-  , theRig(iTheRig)
+#ifdef HAVE_SSE_OR_AVX
+struct SCondCoeffs
+{
+  f32 dcI;   // DC offset to remove
+  f32 dcQ;
+  f32 phi;   // IQ phase correction factor
+  f32 gainQ; // IQ gain correction factor
+};
+
+struct SCondSums
+{
+  f32 sumI = 0.0f;  // sum of the uncorrected values
+  f32 sumQ = 0.0f;
+  f32 sumII = 0.0f; // sum of x_i * x_i (DC corrected values)
+  f32 sumIQ = 0.0f; // sum of x_i * x_q
+  f32 sumQQ = 0.0f; // sum of x_q_corr * x_q_corr
+  f32 sumAbs = 0.0f;
+  f32 maxAbs = 0.0f;
+};
+
+// DC removal, IQ balance, level metering and mixing in one pass over the interleaved samples.
+// The NCO is split into lanes, each lane rotates with NoLanes times the phase increment. So the complex multiplications
+// of neighboring samples do not depend on each other and the loop can be vectorized.
+// With WithPreMix the corrected but not yet mixed samples are also written to opPreMix.
+template<i32 NoLanes, bool WithPreMix>
+static void condition_samples(cf32 * const ioV, const i32 iNoSamples, const SCondCoeffs & iCoeffs, cf32 * const opPreMix,
+                              const std::array<cf32, NoLanes + 1> & iPhaseIncPow, cf32 & ioPhase, SCondSums & ioSums)
+{
+  f32 * const v = reinterpret_cast<f32 *>(ioV);
+  f32 * const pm = reinterpret_cast<f32 *>(opPreMix);
+  f32 ncoRe[NoLanes];
+  f32 ncoIm[NoLanes];
+
+  for (i32 l = 0; l < NoLanes; l++)
+  {
+    const cf32 p = ioPhase * iPhaseIncPow[l];
+    ncoRe[l] = real(p);
+    ncoIm[l] = imag(p);
+  }
+
+  const f32 incRe = real(iPhaseIncPow[NoLanes]);
+  const f32 incIm = imag(iPhaseIncPow[NoLanes]);
+  f32 sumI = ioSums.sumI, sumQ = ioSums.sumQ, sumII = ioSums.sumII, sumIQ = ioSums.sumIQ, sumQQ = ioSums.sumQQ;
+  f32 sumAbs = ioSums.sumAbs, maxAbs = ioSums.maxAbs;
+
+  const auto process = [&](const i32 iIdx, const i32 iLane)
+  {
+    const f32 v_i = v[2 * iIdx + 0];
+    const f32 v_q = v[2 * iIdx + 1];
+    sumI += v_i;
+    sumQ += v_q;
+    const f32 x_i = v_i - iCoeffs.dcI;
+    const f32 x_q = v_q - iCoeffs.dcQ;
+    sumII += x_i * x_i;
+    sumIQ += x_i * x_q;
+    const f32 x_q_corr = x_q - iCoeffs.phi * x_i;
+    sumQQ += x_q_corr * x_q_corr;
+    const f32 y_q = x_q_corr * iCoeffs.gainQ;
+
+    // the mixing has no effect on the absolute level detection, so do it beforehand
+    const f32 v_abs = std::sqrt(x_i * x_i + y_q * y_q);
+    sumAbs += v_abs;
+    maxAbs = std::max(maxAbs, v_abs);
+
+    if constexpr (WithPreMix)
+    {
+      pm[2 * iIdx + 0] = x_i;
+      pm[2 * iIdx + 1] = y_q;
+    }
+
+    // we mix after the IQ/DC compensation as these effects are only related to the ADC properties
+    v[2 * iIdx + 0] = x_i * ncoRe[iLane] - y_q * ncoIm[iLane];
+    v[2 * iIdx + 1] = x_i * ncoIm[iLane] + y_q * ncoRe[iLane];
+  };
+
+  i32 i = 0;
+  for (; i + NoLanes <= iNoSamples; i += NoLanes)
+  {
+    for (i32 l = 0; l < NoLanes; l++)
+    {
+      process(i + l, l);
+    }
+
+    for (i32 l = 0; l < NoLanes; l++)
+    {
+      const f32 re = ncoRe[l] * incRe - ncoIm[l] * incIm;
+      ncoIm[l] = ncoRe[l] * incIm + ncoIm[l] * incRe;
+      ncoRe[l] = re;
+    }
+  }
+
+  i32 lane = 0;
+  for (; i < iNoSamples; i++, lane++)
+  {
+    process(i, lane);
+  }
+
+  // the lane of the next sample holds the next phase, keep the phase on the unit circle
+  ioPhase = norm_to_length_one(cf32(ncoRe[lane], ncoIm[lane]));
+
+  ioSums.sumI = sumI;
+  ioSums.sumQ = sumQ;
+  ioSums.sumII = sumII;
+  ioSums.sumIQ = sumIQ;
+  ioSums.sumQQ = sumQQ;
+  ioSums.sumAbs = sumAbs;
+  ioSums.maxAbs = maxAbs;
+}
+#endif
+
+SampleReader::SampleReader(IDabObserver * ipObserver, IDeviceHandler * iTheRig, RingBuffer<cf32> * iSpectrumBuffer)
+  : theRig(iTheRig)
   , spectrumBuffer(iSpectrumBuffer)
 {
   dumpfilePointer.store(nullptr);
   running.store(true);
 
-#ifndef HAVE_SSE_OR_AVX
+#ifdef HAVE_SSE_OR_AVX
+  mNcoPhaseIncPow.fill(cf32(1.0f, 0.0f)); // fits to mNcoPhaseInc == 0
+  mNoMixPhaseIncPow.fill(cf32(1.0f, 0.0f));
+#else
   for (i32 i = 0; i < INPUT_RATE; i++)
   {
     oscillatorTable[i] = cf32((f32)std::cos(2.0 * M_PI * i / INPUT_RATE),
@@ -49,14 +161,24 @@ SampleReader::SampleReader(const DabRadio * mr, IDeviceHandler * iTheRig, RingBu
   }
 #endif
 
-  connect(this, &SampleReader::signal_show_spectrum, mr, &DabRadio::slot_show_spectrum);
-  connect(this, &SampleReader::signal_show_cir     , mr, &DabRadio::slot_show_cir);
+  if (ipObserver != nullptr)
+  {
+    connect(this, &SampleReader::signal_show_spectrum, this, [ipObserver](i32 iAmount) { ipObserver->show_spectrum(iAmount); }, Qt::DirectConnection);
+    connect(this, &SampleReader::signal_show_cir     , this, [ipObserver]() { ipObserver->show_cir(); }, Qt::DirectConnection);
+  }
 }
 
 void SampleReader::set_running(bool b)
 {
   running.store(b);
 
+  // the handed back samples belong to the reader thread, set_running(true) is called from there at the start of
+  // DabProcessor::run(), set_running(false) comes from the GUI thread and must not touch them
+  if (b)
+  {
+    mUnreadCnt = 0;
+  }
+
   // with (looped) file input the while loop will hang, so skip this, deleting the buffer does not make sense here either
   if (!theRig->isFileInput())
   {
@@ -93,21 +215,100 @@ void SampleReader::discard_samples(const i32 iSampleCnt)
   }
 }
 
-cf32 SampleReader::get_sample(const f32 iPhaseOffset)
+void SampleReader::get_samples(TArrayTn & oV, const i32 iStartIdx, i32 iNoSamples, const f32 iFreqOffsetBBHz, const bool iShowSpec)
 {
-  get_samples(mSampleBuffer, 0, 1, iPhaseOffset, true); // show spectrum while scanning
-  return mSampleBuffer[0];
+  assert((signed)oV.size() >= iStartIdx + iNoSamples);
+
+  cf32 * buffer = oV.data() + iStartIdx;
+
+  // the samples handed back by the time synchronization are already corrected, they only need the mixing
+  if (mUnreadCnt > 0)
+  {
+    const i32 count = std::min(mUnreadCnt, iNoSamples);
+    memcpy(buffer, &mEnvSampleBuffer[mUnreadIdx], count * sizeof(cf32));
+    _mix_samples(buffer, count, iFreqOffsetBBHz);
+    mUnreadIdx += count;
+    mUnreadCnt -= count;
+    buffer += count;
+    iNoSamples -= count;
+
+    if (iNoSamples == 0)
+    {
+      return;
+    }
+  }
+
+  _read_samples(buffer, iNoSamples, iFreqOffsetBBHz, iShowSpec, true);
 }
 
-void SampleReader::get_samples(TArrayTn & oV, const i32 iStartIdx, i32 iNoSamples, const f32 iFreqOffsetBBHz, const bool iShowSpec)
+void SampleReader::get_envelope(f32 * const opEnv, const i32 iNoSamples)
 {
-  assert((signed)oV.size() >= iStartIdx + iNoSamples);
+  assert(iNoSamples <= cTn);
+  assert(mUnreadCnt <= iNoSamples);
+
+  // samples handed back from the last block come first
+  const i32 unreadCnt = mUnreadCnt;
+  memmove(mEnvSampleBuffer.data(), &mEnvSampleBuffer[mUnreadIdx], unreadCnt * sizeof(cf32));
+  mUnreadCnt = 0;
+
+  if (unreadCnt < iNoSamples)
+  {
+    _read_samples(&mEnvSampleBuffer[unreadCnt], iNoSamples - unreadCnt, 0.0f, true, false); // show spectrum while scanning
+  }
+
+  for (i32 i = 0; i < iNoSamples; i++)
+  {
+    opEnv[i] = std::sqrt(real(mEnvSampleBuffer[i]) * real(mEnvSampleBuffer[i]) + imag(mEnvSampleBuffer[i]) * imag(mEnvSampleBuffer[i]));
+  }
+
+  mEnvSampleCnt = iNoSamples;
+}
+
+void SampleReader::unread_envelope_samples(const i32 iIdx)
+{
+  assert(iIdx >= 0 && iIdx <= mEnvSampleCnt);
+  mUnreadIdx = iIdx;
+  mUnreadCnt = mEnvSampleCnt - iIdx;
+}
 
-  cf32 * const buffer = oV.data() + iStartIdx;
+#ifdef HAVE_SSE_OR_AVX
+void SampleReader::_update_nco_table(const f32 iFreqOffsetBBHz)
+{
+  // adjust frequency. We need Hz accuracy
+  if (const f32 phaseInc = F_2_M_PI * -iFreqOffsetBBHz / INPUT_RATE;
+      phaseInc != mNcoPhaseInc) // the table is kept as the frequency offset changes seldom
+  {
+    mNcoPhaseInc = phaseInc;
+    for (i32 l = 0; l <= NCO_LANES; l++)
+    {
+      mNcoPhaseIncPow[l] = cmplx_from_phase(phaseInc * (f32)l);
+    }
+  }
+}
+#endif
+
+void SampleReader::_mix_samples(cf32 * const ioV, const i32 iNoSamples, const f32 iFreqOffsetBBHz)
+{
+#ifdef HAVE_SSE_OR_AVX
+  _update_nco_table(iFreqOffsetBBHz);
+  SCondSums sums; // not used
+  condition_samples<NCO_LANES, false>(ioV, iNoSamples, SCondCoeffs{ 0.0f, 0.0f, 0.0f, 1.0f }, nullptr, mNcoPhaseIncPow, phase, sums);
+#else
+  const i32 FreqOffsetBBHz = std::round(iFreqOffsetBBHz);
+  for (i32 i = 0; i < iNoSamples; i++)
+  {
+    currentPhase -= FreqOffsetBBHz;
+    currentPhase = (currentPhase + INPUT_RATE) % INPUT_RATE;
+    ioV[i] *= oscillatorTable[currentPhase];
+  }
+#endif
+}
 
-  while (running.load() && theRig->Samples() < iNoSamples)
+void SampleReader::_read_samples(cf32 * const buffer, i32 iNoSamples, const f32 iFreqOffsetBBHz, const bool iShowSpec, const bool iDoMixing)
+{
+  while (running.load() && theRig->wait_for_samples(iNoSamples, WAIT_TIMEOUT_MS) < iNoSamples)
   {
-    usleep(1000);
+    // the timeout is only needed to look for the running flag
   }
 
   if (!running.load()) throw 20; // stops the DAB processor
@@ -130,84 +331,84 @@ void SampleReader::get_samples(TArrayTn & oV, const i32 iStartIdx, i32 iNoSample
   assert(iNoSamples <= cTn);
 
 #ifdef HAVE_SSE_OR_AVX
-  f32 singleFloat; // no special alignment and no initialization necessary
-  u32 index;       // --"--
+  // The correction values of the former calls are applied, so all can be done in one pass over the data.
+  // As the mean filters have a time constant of about one second, the delay of one block makes no difference.
+  SCondCoeffs coeffs{ 0.0f, 0.0f, 0.0f, 1.0f };
+
+  if (mDoDcOrIqCorr)
+  {
+    coeffs.dcI = meanI;
+    coeffs.dcQ = meanQ;
+
+    if (mDoIqCorr)
+    {
+      coeffs.phi = meanIQ / meanII;
+      coeffs.gainQ = std::sqrt(meanII / meanQQ);
+    }
+  }
+
+  // without mixing the NCO is replaced by a constant phase of zero
+  cf32 noMixPhase(1.0f, 0.0f);
+  if (iDoMixing)
+  {
+    _update_nco_table(iFreqOffsetBBHz);
+  }
+  const std::array<cf32, NCO_LANES + 1> & phaseIncPow = (iDoMixing ? mNcoPhaseIncPow : mNoMixPhaseIncPow);
+  cf32 & ncoPhase = (iDoMixing ? phase : noMixPhase);
+
+  // use the non-frequency corrected sample data for the spectrum and the CIR analyzer
+  // (the spectrum could jump widely with +/-35 kHz with weak signals)
+  const i32 specCnt = std::max(std::min(SPEC_BUFF_SIZE - specBuffIdx, iNoSamples), 0);
+  const i32 cirCnt = (cirBuffer != nullptr ? std::max(std::min(CIR_BUFF_SIZE - mWholeFrameIndex, iNoSamples), 0) : 0);
+  const i32 preMixCnt = std::max(specCnt, cirCnt);
+
+  SCondSums sums;
+  if (preMixCnt > 0)
+  {
+    condition_samples<NCO_LANES, true>(buffer, preMixCnt, coeffs, mPreMixBuffer.data(), phaseIncPow, ncoPhase, sums);
+  }
+  condition_samples<NCO_LANES, false>(buffer + preMixCnt, iNoSamples - preMixCnt, coeffs, nullptr, phaseIncPow, ncoPhase, sums);
 
-  // Perform DC removal if wanted
   if (mDoDcOrIqCorr)
   {
     constexpr f32 ALPHA = 1.0f / INPUT_RATE;
     const f32 alphaN = ALPHA * iNoSamples;
-    volk_32fc_deinterleave_32f_x2_u(mVolkFloat1, mVolkFloat2, buffer, iNoSamples);
-    volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat1, iNoSamples);
-    mean_filter(meanI, singleFloat / iNoSamples, alphaN);
-    volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat2, iNoSamples);
-    mean_filter(meanQ, singleFloat / iNoSamples, alphaN);
-    volk_32f_s32f_add_32f_a(mVolkFloat1, mVolkFloat1, -meanI, iNoSamples); // v_i - meanI
-    volk_32f_s32f_add_32f_a(mVolkFloat2, mVolkFloat2, -meanQ, iNoSamples); // v_q - meanQ
+    mean_filter(meanI, sums.sumI / iNoSamples, alphaN);
+    mean_filter(meanQ, sums.sumQ / iNoSamples, alphaN);
 
     if (mDoIqCorr)
     {
-      volk_32f_x2_multiply_32f_a(mVolkFloat3, mVolkFloat1, mVolkFloat1, iNoSamples); // x_i * x_i
-      volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat3, iNoSamples);
-      mean_filter(meanII, singleFloat / iNoSamples, alphaN);
-      volk_32f_x2_multiply_32f_a(mVolkFloat3, mVolkFloat1, mVolkFloat2, iNoSamples); // x_i * x_q
-      volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat3, iNoSamples);
-      mean_filter(meanIQ, singleFloat / iNoSamples, alphaN);
-      const f32 phi = meanIQ / meanII;
-      volk_32f_s32f_multiply_32f_a(mVolkFloat3, mVolkFloat1, -phi, iNoSamples); // -phi * x_i
-      volk_32f_x2_add_32f_a(mVolkFloat3, mVolkFloat3, mVolkFloat2, iNoSamples); // x_q_corr
-      volk_32f_x2_multiply_32f_a(mVolkFloat4, mVolkFloat3, mVolkFloat3, iNoSamples); // x_q_corr * x_q_corr
-      volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat4, iNoSamples);
-      mean_filter(meanQQ, singleFloat / iNoSamples, alphaN);
-      const f32 gainQ = std::sqrt(meanII / meanQQ);
-      volk_32f_s32f_multiply_32f_a(mVolkFloat2, mVolkFloat3, gainQ, iNoSamples); // x_q_corr * gainQ
-      // qDebug() << "PhiFact" << phi << "gainQ" << gainQ; // << "meanII" << meanII << "meanQQ" << meanQQ << "meanIQ" << meanIQ << "iNoSamples" << iNoSamples;
+      mean_filter(meanII, sums.sumII / iNoSamples, alphaN);
+      mean_filter(meanIQ, sums.sumIQ / iNoSamples, alphaN);
+      mean_filter(meanQQ, sums.sumQQ / iNoSamples, alphaN);
+      // qDebug() << "PhiFact" << coeffs.phi << "gainQ" << coeffs.gainQ; // << "meanII" << meanII << "meanQQ" << meanQQ << "meanIQ" << meanIQ << "iNoSamples" << iNoSamples;
     }
-
-    volk_32f_x2_interleave_32fc_u(buffer, mVolkFloat1, mVolkFloat2, iNoSamples);
   }
 
-  // The mixing has no effect on the absolute level detection, so do it beforehand
-  volk_32fc_magnitude_32f_u(mVolkFloat1, buffer, iNoSamples); // v_abs = std::abs(v);
-  volk_32f_index_max_32u_a(&index, mVolkFloat1, iNoSamples); // index of peak
-  if (mVolkFloat1[index] > peakLevel) peakLevel = mVolkFloat1[index]; // if (v_abs > peakLevel) peakLevel = v_abs;
-  volk_32f_accumulator_s32f_a(&singleFloat, mVolkFloat1, iNoSamples);
-  mean_filter(sLevel, singleFloat / iNoSamples, 0.00001f * iNoSamples);
+  if (sums.maxAbs > peakLevel) peakLevel = sums.maxAbs;
+  mean_filter(sLevel, sums.sumAbs / iNoSamples, 0.00001f * iNoSamples);
 
-  // use the non-frequency corrected sample data for CIR analyzer
   if (cirBuffer != nullptr)
   {
-    for (i32 i = 0; i < iNoSamples; i++)
+    memcpy(&mWholeFrameBuff[mWholeFrameIndex], mPreMixBuffer.data(), cirCnt * sizeof(cf32));
+    mWholeFrameIndex += cirCnt;
+    mWholeFrameCount += iNoSamples;
+
+    if ((mWholeFrameCount >= (2048*96*6)) && (mWholeFrameIndex >= CIR_BUFF_SIZE)) // 6 frames
     {
-      if(mWholeFrameIndex < CIR_BUFF_SIZE)
-      {
-        mWholeFrameBuff[mWholeFrameIndex++] = buffer[i];
-      }
-      mWholeFrameCount += 1;
-      if ((mWholeFrameCount >= (2048*96*6)) && (mWholeFrameIndex >= CIR_BUFF_SIZE)) // 6 frames
-      {
-        cirBuffer->put_data_into_ring_buffer(mWholeFrameBuff, CIR_BUFF_SIZE);
-        emit signal_show_cir(CIR_BUFF_SIZE);
-        mWholeFrameIndex = 0;
-        mWholeFrameCount = 0;
-      }
+      cirBuffer->put_data_into_ring_buffer(mWholeFrameBuff, CIR_BUFF_SIZE);
+      emit signal_show_cir(CIR_BUFF_SIZE);
+      mWholeFrameIndex = 0;
+      mWholeFrameCount = 0;
     }
   }
 
-  // use the non-frequency corrected sample data for the spectrum as it could jump widely with +/-35 kHz with weak signals
-  if (specBuffIdx < SPEC_BUFF_SIZE)
+  if (specCnt > 0)
   {
-    i32 count = SPEC_BUFF_SIZE - specBuffIdx;
-    if (count > iNoSamples) count = iNoSamples;
-    memcpy(&specBuff[specBuffIdx], buffer, count * sizeof(cf32));
-    specBuffIdx += count;
+    memcpy(&specBuff[specBuffIdx], mPreMixBuffer.data(), specCnt * sizeof(cf32));
+    specBuffIdx += specCnt;
   }
 
-  // adjust frequency. We need Hz accuracy
-  const cf32 phase_inc = cmplx_from_phase(F_2_M_PI * -iFreqOffsetBBHz / INPUT_RATE);
-  volk_32fc_s32fc_x2_rotator2_32fc_u(buffer, buffer, &phase_inc, &phase, iNoSamples);
-
 #else
   const i32 FreqOffsetBBHz = std::round(iFreqOffsetBBHz);
   for (i32 i = 0; i < iNoSamples; i++)
@@ -271,6 +472,12 @@ void SampleReader::get_samples(TArrayTn & oV, const i32 iStartIdx, i32 iNoSample
       ++specBuffIdx;
     }
 
+    if (!iDoMixing)
+    {
+      buffer[i] = v;
+      continue;
+    }
+
     // adjust frequency. We need Hz accuracy
     // Note that "phase" itself might be negative
     currentPhase -= FreqOffsetBBHz;
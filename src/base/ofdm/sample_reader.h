@@ -42,25 +42,25 @@
 #include "ringbuffer.h"
 #include <random>
 
-#ifdef HAVE_SSE_OR_AVX
-  #include <volk/volk.h>
-#endif
-
-class DabRadio;
+class IDabObserver;
 
 class SampleReader : public QObject
 {
 Q_OBJECT
 public:
-  SampleReader(const DabRadio * mr, IDeviceHandler * iTheRig, RingBuffer<cf32> * iSpectrumBuffer = nullptr);
+  SampleReader(IDabObserver * ipObserver, IDeviceHandler * iTheRig, RingBuffer<cf32> * iSpectrumBuffer = nullptr);
   ~SampleReader() override = default;
 
   void set_running(bool b);
   bool is_running() const { return running.load(); }
   void discard_samples(i32 iSampleCnt);
   void get_linear_peak_level_and_clear(f32 & oLevelPeak, f32 & oLevelMean);
-  cf32 get_sample(f32);
   void get_samples(TArrayTn & oV, const i32 iStartIdx, i32 iNoSamples, const f32 iFreqOffsetBBHz, bool iShowSpec);
+  // Block-wise reading for the time synchronization: returns the magnitudes of the next iNoSamples (<= cTn) samples
+  // (DC/IQ corrected, not mixed). With unread_envelope_samples() the samples from iIdx on of the last block are
+  // handed back, they are delivered again with the next get_envelope() or get_samples() call.
+  void get_envelope(f32 * opEnv, i32 iNoSamples);
+  void unread_envelope_samples(i32 iIdx);
   void start_dumping(SNDFILE *);
   void stop_dumping();
   void set_dc_and_iq_correction(bool iDoDcCorr, bool iDoIqCorr);
@@ -73,19 +73,24 @@ private:
   static constexpr u16 DUMP_SIZE = 4096;
   static constexpr i32 SPEC_BUFF_SIZE = 2048;
   static constexpr i32 CIR_BUFF_SIZE = 2048*97;
+  static constexpr i32 WAIT_TIMEOUT_MS = 50; // only limits the reaction time to set_running(false)
 
-  const DabRadio * const myRadioInterface;
   IDeviceHandler * const theRig;
   RingBuffer<cf32> * const spectrumBuffer;
   RingBuffer<cf32> * cirBuffer = nullptr;
   std::array<cf32, SPEC_BUFF_SIZE> specBuff;
   TArrayTn mSampleBuffer;
+  TArrayTn mEnvSampleBuffer; // samples of the last get_envelope() call
+  i32 mEnvSampleCnt = 0;
+  i32 mUnreadIdx = 0;        // first sample in mEnvSampleBuffer handed back by unread_envelope_samples()
+  i32 mUnreadCnt = 0;
 #ifdef HAVE_SSE_OR_AVX
-  alignas(64) f32 mVolkFloat1[cTn];
-  alignas(64) f32 mVolkFloat2[cTn];
-  alignas(64) f32 mVolkFloat3[cTn];
-  alignas(64) f32 mVolkFloat4[cTn];
+  static constexpr i32 NCO_LANES = 8;
+  TArrayTn mPreMixBuffer; // DC/IQ corrected but not frequency corrected samples for the spectrum and CIR display
   cf32 phase = {1.0f, 0.0f};
+  f32 mNcoPhaseInc = 0.0f;
+  std::array<cf32, NCO_LANES + 1> mNcoPhaseIncPow; // phase increment to the power of 0 .. NCO_LANES
+  std::array<cf32, NCO_LANES + 1> mNoMixPhaseIncPow; // all ones, used without mixing
 #else
   std::array<cf32, INPUT_RATE> oscillatorTable{};
   i32 currentPhase = 0;
@@ -110,6 +115,11 @@ private:
   i32 mWholeFrameCount = 0;
   cf32  mWholeFrameBuff[CIR_BUFF_SIZE];
 
+  void _read_samples(cf32 * buffer, i32 iNoSamples, f32 iFreqOffsetBBHz, bool iShowSpec, bool iDoMixing);
+  void _mix_samples(cf32 * ioV, i32 iNoSamples, f32 iFreqOffsetBBHz);
+#ifdef HAVE_SSE_OR_AVX
+  void _update_nco_table(f32 iFreqOffsetBBHz);
+#endif
   void _dump_samples_to_file(const cf32 * const ipV, const i32 iNoSamples);
 
 signals:
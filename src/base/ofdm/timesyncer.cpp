@@ -37,6 +37,25 @@ TimeSyncer::TimeSyncer(SampleReader * mr)
 {
 }
 
+// The samples are fetched block-wise from the SampleReader, the samples behind the detected end of the null symbol
+// are handed back to the SampleReader, so the following OFDM symbols are read from the exactly same sample position.
+inline f32 TimeSyncer::_get_envelope_sample()
+{
+  if (mEnvBlockIdx >= cEnvBlockSize)
+  {
+    mpSampleReader->get_envelope(mEnvBlock.data(), cEnvBlockSize);
+    mEnvBlockIdx = 0;
+  }
+  return mEnvBlock[mEnvBlockIdx++];
+}
+
+TimeSyncer::EState TimeSyncer::_hand_back_unused_samples(const EState iState)
+{
+  mpSampleReader->unread_envelope_samples(mEnvBlockIdx);
+  mEnvBlockIdx = cEnvBlockSize;
+  return iState;
+}
+
 TimeSyncer::EState TimeSyncer::read_samples_until_end_of_level_drop()
 {
   f32 cLevel = 0;
@@ -48,8 +67,7 @@ TimeSyncer::EState TimeSyncer::read_samples_until_end_of_level_drop()
   // collect level information for the first cLevelSearchSize in a buffer
   for (i32 i = 0; i < cLevelSearchSize; i++)
   {
-    const cf32 sample = mpSampleReader->get_sample(0);
-    envBuffer[mSyncBufferIndex] = std::abs(sample);
+    envBuffer[mSyncBufferIndex] = _get_envelope_sample();
     cLevel += envBuffer[mSyncBufferIndex];
     ++mSyncBufferIndex;
   }
@@ -58,15 +76,14 @@ TimeSyncer::EState TimeSyncer::read_samples_until_end_of_level_drop()
   i32 counter = 0;
   while (cLevel / cLevelSearchSize > 0.55f * mpSampleReader->get_sLevel())
   {
-    const cf32 sample = mpSampleReader->get_sample(0);
-    envBuffer[mSyncBufferIndex] = std::abs(sample);
+    envBuffer[mSyncBufferIndex] = _get_envelope_sample();
     cLevel += envBuffer[mSyncBufferIndex] - envBuffer[(u32)(mSyncBufferIndex - cLevelSearchSize) & syncBufferMask];
     mSyncBufferIndex = (mSyncBufferIndex + 1) & syncBufferMask;
     ++counter;
 
     if (counter > cTF) // no DIP found within one frame?
     {
-      return EState::NO_DIP_FOUND;
+      return _hand_back_unused_samples(EState::NO_DIP_FOUND);
     }
   }
 
@@ -74,17 +91,16 @@ TimeSyncer::EState TimeSyncer::read_samples_until_end_of_level_drop()
   counter = 0;
   while (cLevel / cLevelSearchSize < 0.75f * mpSampleReader->get_sLevel())
   {
-    const cf32 sample = mpSampleReader->get_sample(0);
-    envBuffer[mSyncBufferIndex] = std::abs(sample);
+    envBuffer[mSyncBufferIndex] = _get_envelope_sample();
     cLevel += envBuffer[mSyncBufferIndex] - envBuffer[(u32)(mSyncBufferIndex - cLevelSearchSize) & syncBufferMask];
     mSyncBufferIndex = (mSyncBufferIndex + 1) & syncBufferMask;
     ++counter;
 
     if (counter > cTn + cLevelSearchSize + 20) // no rising edge found within null period? Add an empirical value to make sync more reliable in some cases
     {
-      return EState::NO_END_OF_DIP_FOUND;
+      return _hand_back_unused_samples(EState::NO_END_OF_DIP_FOUND);
     }
   }
 
-  return EState::TIMESYNC_ESTABLISHED;
+  return _hand_back_unused_samples(EState::TIMESYNC_ESTABLISHED);
 }
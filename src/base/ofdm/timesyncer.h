@@ -31,6 +31,7 @@
 #pragma once
 
 #include "dab_constants.h"
+#include <array>
 
 class SampleReader;
 
@@ -50,9 +51,15 @@ public:
 private:
   static constexpr i32 cSyncBufferSize = 4096;
   static constexpr i32 cLevelSearchSize = 50;
+  static constexpr i32 cEnvBlockSize = 1024;
 
   SampleReader * const mpSampleReader;
   i32 mSyncBufferIndex = 0;
+  std::array<f32, cEnvBlockSize> mEnvBlock;
+  i32 mEnvBlockIdx = cEnvBlockSize;
+
+  f32 _get_envelope_sample();
+  EState _hand_back_unused_samples(EState iState);
 };
 
 
@@ -43,7 +43,13 @@
 EepProtection::EepProtection(const i16 iBitRate, const i16 iProtLevel)
   : Protection(iBitRate)
 {
-  i16 viterbiCounter = 0;
+  mpDepunctureTable = get_depuncture_table(false, iBitRate, iProtLevel, &EepProtection::_build_positions);
+}
+
+void EepProtection::_build_positions(const i16 iBitRate, const i16 iProtLevel, std::vector<u32> & oPositions)
+{
+  const i32 viterbiBlockSize = 4 * 24 * iBitRate + 24;
+  i32 viterbiCounter = 0;
   i16 L1 = 0, L2 = 0;
   const i8 * PI1 = nullptr;
   const i8 * PI2 = nullptr;
@@ -52,8 +58,8 @@ EepProtection::EepProtection(const i16 iBitRate, const i16 iProtLevel)
 
   if (option == 0) // A profiles, see 11.3.2 table 18
   {
-    const i16 n = bitRate / 8;
-    assert(bitRate % 8 == 0);
+    const i16 n = iBitRate / 8;
+    assert(iBitRate % 8 == 0);
 
     switch (protLevel)
     {
@@ -99,8 +105,8 @@ EepProtection::EepProtection(const i16 iBitRate, const i16 iProtLevel)
   }
   else if (option == 1) // B profiles, see 11.3.2 table 19
   {
-    const i16 n = bitRate / 32;
-    assert(bitRate % 32 == 0);
+    const i16 n = iBitRate / 32;
+    assert(iBitRate % 32 == 0);
 
     L1 = 24 * n - 3; // common for all B protection levels
     L2 = 3;
@@ -134,8 +140,9 @@ EepProtection::EepProtection(const i16 iBitRate, const i16 iProtLevel)
   const i8 * PI_X = get_PI_codes(8);
 
   // According to the standard we process the logical frame with a pair of tuples (L1, PI1), (L2, PI2)
-  _extract_viterbi_block_addresses(viterbiCounter, L1, PI1);
-  _extract_viterbi_block_addresses(viterbiCounter, L2, PI2);
+  oPositions.reserve(viterbiBlockSize);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, L1, PI1);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, L2, PI2);
 
   // We had a final block of 24 bits with puncturing, according to PI_X
   // This block constitutes the 6 * 4 bits of the register itself.
@@ -143,14 +150,15 @@ EepProtection::EepProtection(const i16 iBitRate, const i16 iProtLevel)
   {
     if (PI_X[i] != 0)
     {
-      assert(viterbiCounter < (signed)viterbiBlock.size());
-      viterbiBlockAddresses.emplace_back(&viterbiBlock[viterbiCounter]);
+      assert(viterbiCounter < viterbiBlockSize);
+      oPositions.emplace_back(viterbiCounter);
     }
     viterbiCounter++;
   }
+  assert(viterbiCounter == viterbiBlockSize);
 }
 
-void EepProtection::_extract_viterbi_block_addresses(i16 & ioViterbiCounter, const i16 iLx, const i8 * const ipPIx)
+void EepProtection::_extract_viterbi_block_positions(std::vector<u32> & oPositions, i32 & ioViterbiCounter, const i16 iLx, const i8 * const ipPIx)
 {
   for (i32 i = 0; i < iLx; i++)
   {
@@ -158,8 +166,7 @@ void EepProtection::_extract_viterbi_block_addresses(i16 & ioViterbiCounter, con
     {
       if (ipPIx[j % 32] != 0)
       {
-        assert(ioViterbiCounter < (signed)viterbiBlock.size());
-        viterbiBlockAddresses.emplace_back(&viterbiBlock[ioViterbiCounter]);
+        oPositions.emplace_back(ioViterbiCounter);
       }
       ioViterbiCounter++;
     }
@@ -32,6 +32,11 @@
  * Simple base class for combining uep and eep deconvolvers
  */
 #include "protection.h"
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 Protection::Protection(const i16 iBitRate) :
   ViterbiSpiral(24 * iBitRate, true),
@@ -39,21 +44,64 @@ Protection::Protection(const i16 iBitRate) :
   outSize(24 * iBitRate),
   viterbiBlock(outSize * 4 + 24, 0) // important, initializes all elements to zero
 {
-  // the target addresses within viterbiBlock of the non-punctured bits are contained in vector viterbiBlockAddresses and stay the same for each block
-  viterbiBlockAddresses.reserve(outSize * 4 + 24);
 }
 
-bool Protection::deconvolve(const i16 * iV, i32 /*iSize*/, u8 * oOutBuffer)
+std::shared_ptr<const SDepunctureTable> Protection::get_depuncture_table(const bool iShortForm, const i16 iBitRate, const i16 iProtLevel, const TPositionBuilder iBuilder)
 {
-  i16 inputCounter = 0;
+  using TKey = std::tuple<bool, i16, i16>;
+  static std::mutex mutex; // backends and the ETI generator are created from different threads
+  static std::map<TKey, std::shared_ptr<const SDepunctureTable>> cache;
 
-  // do de-puncturing
-  for (i16 * const addr : viterbiBlockAddresses)
+  std::lock_guard<std::mutex> lock(mutex);
+  const TKey key(iShortForm, iBitRate, iProtLevel);
+  const auto it = cache.find(key);
+
+  if (it != cache.end())
+  {
+    return it->second;
+  }
+
+  std::vector<u32> positions;
+  iBuilder(iBitRate, iProtLevel, positions);
+
+  auto pTable = std::make_shared<SDepunctureTable>();
+  pTable->index.resize(positions.size());
+  pTable->chunkBase.resize((positions.size() + SDepunctureTable::cChunkSize - 1) / SDepunctureTable::cChunkSize);
+
+  for (u32 k = 0; k < positions.size(); k++)
+  {
+    const u32 chunk = k / SDepunctureTable::cChunkSize;
+    if (k % SDepunctureTable::cChunkSize == 0)
+    {
+      pTable->chunkBase[chunk] = positions[k];
+    }
+    assert(positions[k] - pTable->chunkBase[chunk] <= 0xFFFF); // at least one of four positions is not punctured
+    pTable->index[k] = (u16)(positions[k] - pTable->chunkBase[chunk]);
+  }
+
+  cache[key] = pTable;
+  return pTable;
+}
+
+bool Protection::deconvolve(const i16 * iV, i32 /*iSize*/, u8 * oOutBuffer, const u8 * ipXorMask)
+{
+  // do de-puncturing, the punctured positions in viterbiBlock keep their zero value
+  const SDepunctureTable & table = *mpDepunctureTable;
+  const i32 numBits = (i32)table.index.size();
+  const u16 * const pIndex = table.index.data();
+
+  for (i32 chunk = 0, k = 0; k < numBits; chunk++)
   {
-    *addr = iV[inputCounter++];  // the addresses map to the viterbiBlock vector
+    i16 * const pBase = viterbiBlock.data() + table.chunkBase[chunk];
+    const i32 end = std::min(k + SDepunctureTable::cChunkSize, numBits);
+
+    for (; k < end; k++)
+    {
+      pBase[pIndex[k]] = iV[k];
+    }
   }
 
-  ViterbiSpiral::deconvolve(viterbiBlock.data(), oOutBuffer);
+  ViterbiSpiral::deconvolve_packed(viterbiBlock.data(), oOutBuffer, ipXorMask);
 
   return true;
 }
@@ -33,20 +33,37 @@
 
 #include "viterbi_spiral.h"
 #include "glob_data_types.h"
+#include <memory>
 #include <vector>
 
+// The input soft bit k is placed to viterbiBlock[chunkBase[k / cChunkSize] + index[k]] while depuncturing.
+// Splitting the positions into chunks keeps the indices in u16 also for the largest sub-channels.
+struct SDepunctureTable
+{
+  static constexpr i32 cChunkSize = 4096;
+  std::vector<u16> index;
+  std::vector<u32> chunkBase;
+};
+
 class Protection : public ViterbiSpiral
 {
 public:
   explicit Protection(i16);
   ~Protection() override = default;
 
-  virtual bool deconvolve(const i16 *, i32, u8 *);
+  // the output is packed into bytes (MSB first)
+  virtual bool deconvolve(const i16 *, i32, u8 *, const u8 * ipXorMask = nullptr);
   
 protected:
+  // fills the positions of the non-punctured bits within viterbiBlock in ascending order
+  using TPositionBuilder = void (*)(i16 iBitRate, i16 iProtLevel, std::vector<u32> & oPositions);
+
   i16 bitRate;
   i32 outSize;
   std::vector<i16> viterbiBlock;
-  std::vector<i16 *> viterbiBlockAddresses; // addresses of non-punctured bits
+  std::shared_ptr<const SDepunctureTable> mpDepunctureTable; // shared by all instances with the same profile
+
+  // the tables are immutable and cached process-wide, iBuilder is only called if the profile is not yet known
+  static std::shared_ptr<const SDepunctureTable> get_depuncture_table(bool iShortForm, i16 iBitRate, i16 iProtLevel, TPositionBuilder iBuilder);
 };
 
@@ -155,7 +155,13 @@ static i16 find_index(const i16 bitRate, const i16 protLevel)
 UepProtection::UepProtection(const i16 bitRate, const i16 protLevel)
   : Protection(bitRate)
 {
-  i16 viterbiCounter = 0;
+  mpDepunctureTable = get_depuncture_table(true, bitRate, protLevel, &UepProtection::_build_positions);
+}
+
+void UepProtection::_build_positions(const i16 bitRate, const i16 protLevel, std::vector<u32> & oPositions)
+{
+  const i32 viterbiBlockSize = 4 * 24 * bitRate + 24;
+  i32 viterbiCounter = 0;
 
   i16 index = find_index(bitRate, protLevel);
 
@@ -175,10 +181,11 @@ UepProtection::UepProtection(const i16 bitRate, const i16 protLevel)
   const i8 * const PI_X = get_PI_codes(8);
 
   // We prepare a mapping table with the given punctures
-  _extract_viterbi_block_addresses(viterbiCounter, pp.L1, PI1);
-  _extract_viterbi_block_addresses(viterbiCounter, pp.L2, PI2);
-  _extract_viterbi_block_addresses(viterbiCounter, pp.L3, PI3);
-  _extract_viterbi_block_addresses(viterbiCounter, pp.L4, PI4); // L4 is 0 if PI4 is -1, so calling this is safe
+  oPositions.reserve(viterbiBlockSize);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, pp.L1, PI1);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, pp.L2, PI2);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, pp.L3, PI3);
+  _extract_viterbi_block_positions(oPositions, viterbiCounter, pp.L4, PI4); // L4 is 0 if PI4 is -1, so calling this is safe
 
   /**
     *	we have a final block of 24 bits  with puncturing according to PI_X
@@ -188,14 +195,14 @@ UepProtection::UepProtection(const i16 bitRate, const i16 protLevel)
   {
     if (PI_X[i] != 0)
     {
-      assert(viterbiCounter < (signed)viterbiBlock.size());
-      viterbiBlockAddresses.emplace_back(&viterbiBlock[viterbiCounter]);
+      assert(viterbiCounter < viterbiBlockSize);
+      oPositions.emplace_back(viterbiCounter);
     }
     viterbiCounter++;
   }
 }
 
-void UepProtection::_extract_viterbi_block_addresses(i16 & ioViterbiCounter, const i16 iLx, const i8 * const ipPIx)
+void UepProtection::_extract_viterbi_block_positions(std::vector<u32> & oPositions, i32 & ioViterbiCounter, const i16 iLx, const i8 * const ipPIx)
 {
   for (i32 i = 0; i < iLx; i++)
   {
@@ -203,8 +210,7 @@ void UepProtection::_extract_viterbi_block_addresses(i16 & ioViterbiCounter, con
     {
       if (ipPIx[j % 32] != 0)
       {
-        assert(ioViterbiCounter < (signed)viterbiBlock.size());
-        viterbiBlockAddresses.emplace_back(&viterbiBlock[ioViterbiCounter]);
+        oPositions.emplace_back(ioViterbiCounter);
       }
       ioViterbiCounter++;
     }
@@ -38,6 +38,7 @@ public:
   ~UepProtection() override = default;
 
 private:
-  void _extract_viterbi_block_addresses(i16 & ioViterbiCounter, i16 iLx, const i8 * ipPIx);
+  static void _build_positions(i16 bitRate, i16 protLevel, std::vector<u32> & oPositions);
+  static void _extract_viterbi_block_positions(std::vector<u32> & oPositions, i32 & ioViterbiCounter, i16 iLx, const i8 * ipPIx);
 };
 
@@ -112,8 +112,8 @@ void	tcpServer::run (i32 port) {
 	      i32 status;
 	      while (running. load()) {
 	         while (running. load() &&
-	                 (buffer -> get_ring_buffer_read_available() < BUF_SIZE))
-	            usleep (1000);
+	                 (buffer -> wait_for_read_available (BUF_SIZE, std::chrono::milliseconds (100)) < BUF_SIZE))
+	            ;
 	         amount = buffer -> get_data_from_ring_buffer (localBuffer, BUF_SIZE);
 	         status = send (client_sock, localBuffer, amount ,0);
 	         if (status == -1) {
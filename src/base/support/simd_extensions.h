@@ -19,17 +19,23 @@
 #pragma once
 
 #include "glob_defs.h"
-#include <pmmintrin.h>
+#if defined(__x86_64__) || defined(_M_X64)
+  #define SIMD_EXT_USE_SSE
+  #include <pmmintrin.h>
+#endif
 //#include <immintrin.h>
 #include <volk/volk.h>
 
-// we try to use the older SSE3 commands to let also older HW be working with that
+// The VOLK kernels choose the best implementation (SSE/AVX/NEON) at runtime by themselves.
+// The few hand-written helpers here use only SSE2 (which is part of the x86_64 baseline), on other platforms
+// (like ARM, where VOLK uses NEON) a plain loop is used, which is left to the auto-vectorizer of the compiler.
 
 // perform abs() on f32 input vector (remove sign)
 inline void simd_abs(f32 * opOut, const f32 * ipInp, const size_t iN)
 {
   assert(iN % 4 == 0);
 
+#ifdef SIMD_EXT_USE_SSE
   const f32 * pInp = reinterpret_cast<const f32 *>(ipInp);
   f32 * pOut = reinterpret_cast<f32 *>(opOut);
 
@@ -41,12 +47,19 @@ inline void simd_abs(f32 * opOut, const f32 * ipInp, const size_t iN)
     __m128 result = _mm_and_ps(data, mask);
     _mm_store_ps(pOut, result);
   }
+#else
+  for (size_t i = 0; i < iN; i++)
+  {
+    opOut[i] = std::abs(ipInp[i]);
+  }
+#endif
 }
 
 inline void simd_normalize(cf32 * opOut, const cf32 * ipInp, const size_t iN)
 {
   assert(iN % 4 == 0);
 
+#ifdef SIMD_EXT_USE_SSE
   const f32 * pInp = reinterpret_cast<const f32 *>(ipInp);
   f32 * pOut = reinterpret_cast<f32 *>(opOut);
 
@@ -71,6 +84,12 @@ inline void simd_normalize(cf32 * opOut, const cf32 * ipInp, const size_t iN)
     // Store the normalized values to the output array
     _mm_store_ps(pOut, normalized);
   }
+#else
+  for (size_t i = 0; i < iN; i++)
+  {
+    opOut[i] = ipInp[i] / std::sqrt(std::norm(ipInp[i])); // no element of ipInp may be 0 (same as SSE variant)
+  }
+#endif
 }
 
 template<typename T>
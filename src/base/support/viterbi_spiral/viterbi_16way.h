@@ -4,6 +4,9 @@
  * Karn's original code can be found here: http://www.ka9q.net/code/fec/
  * May be used under the terms of the GNU Lesser General Public License (LGPL)
  * see http://www.gnu.org/copyleft/lgpl.html
+ *
+ * A decision is 1 if the path from the upper state is worse (like in viterbi_scalar.h), so equal path metrics lead to
+ * the same decision as in the other kernels and the result is bit-exact.
  */
 
 #define RENORMALIZE_THRESHOLD 60000
@@ -39,8 +42,8 @@
     /* Compare and select */\
     const __m256i survivor0 = _mm256_min_epu16(m0, m1);\
     const __m256i survivor1 = _mm256_min_epu16(m2, m3);\
-    const __m256i decision0 = _mm256_cmpeq_epi16(survivor0, m1);\
-    const __m256i decision1 = _mm256_cmpeq_epi16(survivor1, m3);\
+    const __m256i decision0 = _mm256_cmpeq_epi16(survivor0, m0); /* inverted */\
+    const __m256i decision1 = _mm256_cmpeq_epi16(survivor1, m2); /* inverted */\
 \
     /* Store surviving metrics */\
     const __m256i new_metric_lo = _mm256_unpacklo_epi16(survivor0, survivor1);\
@@ -51,7 +54,7 @@
     /* Pack each set of decisions into 16 8-bit bytes, then interleave them and compress into 32 bits */\
 	m0 = _mm256_packs_epi16(decision0, _mm256_setzero_si256());\
 	m1 = _mm256_packs_epi16(decision1, _mm256_setzero_si256());\
-    *d++ = _mm256_movemask_epi8(_mm256_unpacklo_epi8(m0, m1));\
+    *d++ = ~_mm256_movemask_epi8(_mm256_unpacklo_epi8(m0, m1));\
 }
 
     __m256i *old_metrics = (__m256i *)metrics1;
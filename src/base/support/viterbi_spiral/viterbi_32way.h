@@ -0,0 +1,91 @@
+/* K=7 r=1/4 Viterbi decoder for AVX-512BW
+ * Copyright Phil Karn, KA9Q,
+ * Code has been slightly modified for use with Spiral (www.spiral.net)
+ * Karn's original code can be found here: http://www.ka9q.net/code/fec/
+ * May be used under the terms of the GNU Lesser General Public License (LGPL)
+ * see http://www.gnu.org/copyleft/lgpl.html
+ *
+ * All 32 butterflies of one decoded bit are processed at once (u16 metrics, 32 lanes).
+ * The decisions are the same as in viterbi_scalar.h (also for equal path metrics), so the result is bit-exact.
+ */
+
+#define RENORMALIZE_THRESHOLD 30000
+
+#define renormalize {\
+    if (_mm512_cmpgt_epu16_mask(new_metrics[0], mThreshold) & 1) {\
+        __m512i m = _mm512_min_epu16(new_metrics[0], new_metrics[1]);\
+        m = _mm512_min_epu16(m, _mm512_permutex2var_epi64(m, idxSwap256, m));\
+        m = _mm512_min_epu16(m, _mm512_permutex2var_epi64(m, idxSwap128, m));\
+        m = _mm512_min_epu16(m, _mm512_bsrli_epi128(m, 8));\
+        m = _mm512_min_epu16(m, _mm512_bsrli_epi128(m, 4));\
+        m = _mm512_min_epu16(m, _mm512_bsrli_epi128(m, 2));\
+        m = _mm512_permutexvar_epi16(_mm512_setzero_si512(), m); /* broadcast the minimum in lane 0 */\
+        new_metrics[0] = _mm512_subs_epu16(new_metrics[0], m);\
+        new_metrics[1] = _mm512_subs_epu16(new_metrics[1], m);\
+    }\
+}
+
+#define limit_min_max(sym) {\
+    i16 tmp = *syms++;\
+    tmp += 127;\
+    if (tmp < 0) tmp = 0;\
+    else if (tmp > 255) tmp = 255;\
+    sym = _mm512_set1_epi16(tmp);\
+}
+
+    __m512i *old_metrics = (__m512i *)metrics1;
+    __m512i *new_metrics = (__m512i *)metrics2;
+    const __m512i *Branchtab = (const __m512i *)Branchtable;
+    const i16 *syms = input;
+    u64 *d = (u64 *)decisions;
+    const __m512i m1020 = _mm512_set1_epi16(1020);
+    const __m512i mThreshold = _mm512_set1_epi16(RENORMALIZE_THRESHOLD);
+    const __m512i idxSwap256 = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
+    const __m512i idxSwap128 = _mm512_set_epi64(5, 4, 7, 6, 1, 0, 3, 2);
+
+    // unpacklo/hi_epi16() interleave the survivors of butterfly i to the new states 2*i and 2*i+1 only within 128 bit lanes,
+    // these (64 bit element) indices bring the lanes into state order
+    const __m512i idxLo = _mm512_set_epi64(11, 10, 3, 2,  9,  8, 1, 0);
+    const __m512i idxHi = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+
+    while(nbits--)
+    {
+        __m512i sym0, sym1, sym2, sym3;
+        limit_min_max(sym0);
+        limit_min_max(sym1);
+        limit_min_max(sym2);
+        limit_min_max(sym3);
+
+        /* Form branch metrics */
+        const __m512i metric = _mm512_add_epi16(_mm512_add_epi16(_mm512_xor_si512(Branchtab[0], sym0), _mm512_xor_si512(Branchtab[1], sym1)),
+                                                _mm512_add_epi16(_mm512_xor_si512(Branchtab[2], sym2), _mm512_xor_si512(Branchtab[3], sym3)));
+        const __m512i m_metric = _mm512_sub_epi16(m1020, metric);
+
+        /* Add branch metrics to path metrics */
+        const __m512i m0 = _mm512_adds_epu16(old_metrics[0], metric);
+        const __m512i m1 = _mm512_adds_epu16(old_metrics[1], m_metric);
+        const __m512i m2 = _mm512_adds_epu16(old_metrics[0], m_metric);
+        const __m512i m3 = _mm512_adds_epu16(old_metrics[1], metric);
+
+        /* Compare and select (take the first path if the metrics are equal, like the scalar code) */
+        const __mmask32 decision0 = _mm512_cmpgt_epu16_mask(m0, m1);
+        const __mmask32 decision1 = _mm512_cmpgt_epu16_mask(m2, m3);
+        const __m512i survivor0 = _mm512_min_epu16(m0, m1);
+        const __m512i survivor1 = _mm512_min_epu16(m2, m3);
+
+        /* Store surviving metrics */
+        const __m512i new_metric_lo = _mm512_unpacklo_epi16(survivor0, survivor1);
+        const __m512i new_metric_hi = _mm512_unpackhi_epi16(survivor0, survivor1);
+        new_metrics[0] = _mm512_permutex2var_epi64(new_metric_lo, idxLo, new_metric_hi);
+        new_metrics[1] = _mm512_permutex2var_epi64(new_metric_lo, idxHi, new_metric_hi);
+
+        /* Interleave the decision bits, bit 2*i is decision0 and bit 2*i+1 is decision1 of butterfly i */
+        *d++ = _pdep_u64(decision0, 0x5555555555555555ULL) | _pdep_u64(decision1, 0xAAAAAAAAAAAAAAAAULL);
+
+        renormalize;
+
+        /* Swap pointers to old and new metrics */
+        __m512i *tmp = old_metrics;
+        old_metrics = new_metrics;
+        new_metrics = tmp;
+    }
@@ -0,0 +1,25 @@
+/* K=7 r=1/4 Viterbi decoder,
+ * Copyright Phil Karn, KA9Q,
+ * Code has been slightly modified for use with Spiral (www.spiral.net)
+ * Karn's original code can be found here: http://www.ka9q.net/code/fec/
+ * May be used under the terms of the GNU Lesser General Public License (LGPL)
+ * see http://www.gnu.org/copyleft/lgpl.html
+ */
+
+#include "viterbi_kernels.h"
+
+#if defined(VITERBI_X86)
+#include <immintrin.h>
+
+using COMPUTETYPE = u16;
+
+VITERBI_TARGET("avx2")
+void viterbi_kernel_avx2(const i16 * const input, u8 * const metricsBuf1, u8 * const metricsBuf2, decision_t * const decisions, u32 nbits)
+{
+  COMPUTETYPE * const metrics1 = viterbi_init_metrics<COMPUTETYPE>(metricsBuf1);
+  COMPUTETYPE * const metrics2 = reinterpret_cast<COMPUTETYPE *>(metricsBuf2);
+  const COMPUTETYPE * const Branchtable = cViterbiBranchtable<COMPUTETYPE>;
+
+  #include "viterbi_16way.h"
+}
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * All available Viterbi kernels are compiled into the binary, the best one is chosen at runtime (see ViterbiSpiral).
+ * The SIMD kernels are compiled with a function target attribute, so no special compiler flags are needed.
+ */
+#include "viterbi_spiral.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #define VITERBI_X86
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+  #define VITERBI_NEON
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define VITERBI_TARGET(t_)  __attribute__((target(t_)))
+#else
+  #define VITERBI_TARGET(t_)
+#endif
+
+#define K        7
+#define RATE     4
+
+// The kernel initializes the path metrics (which are of the kernel specific compute type) and fills the decisions.
+using TViterbiKernel = void (*)(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+
+void viterbi_kernel_scalar(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+#if defined(VITERBI_X86)
+void viterbi_kernel_sse2(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+void viterbi_kernel_avx2(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+void viterbi_kernel_avx512(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+#elif defined(VITERBI_NEON)
+void viterbi_kernel_neon(const i16 * input, u8 * metricsBuf1, u8 * metricsBuf2, decision_t * decisions, u32 nbits);
+#endif
+
+// same content for all kernels, but in the compute type of the kernel
+template<typename T>
+alignas(64) inline constexpr T cViterbiBranchtable[RATE * NUMSTATES / 2]
+{
+  0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, // 0
+  255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, // 1
+  0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, // 2
+  0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, // 2
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, // 3
+  0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, // 3
+  0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, // 0
+  255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255  // 1
+};
+
+// set the start values of the path metrics for a new frame
+template<typename T>
+inline T * viterbi_init_metrics(u8 * const ioMetricsBuf)
+{
+  static_assert(sizeof(T) <= sizeof(i32), "metric storage in ViterbiSpiral too small");
+  T * const metrics = reinterpret_cast<T *>(ioMetricsBuf);
+  for (i32 i = 0; i < NUMSTATES; i++)
+    metrics[i] = 1000;
+  metrics[0] = 0; /* Bias known start state */
+  return metrics;
+}
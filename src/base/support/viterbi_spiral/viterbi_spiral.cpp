@@ -7,38 +7,37 @@
  */
 
 #include "viterbi_spiral.h"
-
-#if defined(HAVE_VITERBI_AVX2)
-  #include <immintrin.h>
-  using COMPUTETYPE = u16;
-#elif defined(HAVE_VITERBI_SSE2)
-  #include <immintrin.h>
-  using COMPUTETYPE = u16;
-#elif defined(HAVE_VITERBI_NEON)
-  #include "sse2neon.h"
-  using COMPUTETYPE = u16;
-#else
-  using COMPUTETYPE = i32;
+#include "viterbi_kernels.h"
+#include "cpu_features.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#if defined(__SSE2__)
+  #include <emmintrin.h>
 #endif
 
-#define K        7
-#define RATE     4
-
-alignas(64) static const COMPUTETYPE Branchtable[RATE * NUMSTATES / 2]
+struct SKernel
 {
-  0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, // 0
-  255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, // 1
-  0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, // 2
-  0, 255, 255, 0, 255, 0, 0, 255, 0, 255, 255, 0, 255, 0, 0, 255, // 2
-  0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, // 3
-  0, 255, 0, 255, 0, 255, 0, 255, 255, 0, 255, 0, 255, 0, 255, 0, // 3
-  0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, // 0
-  255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255  // 1
+  TViterbiKernel pFunc;
+  const char * pName;
 };
 
-
-alignas(64) static COMPUTETYPE metrics1[NUMSTATES];
-alignas(64) static COMPUTETYPE metrics2[NUMSTATES];
+// the choice is done only once at the first call (thread-safe since C++11)
+static const SKernel & get_kernel()
+{
+  static const SKernel kernel = []() -> SKernel
+  {
+#if defined(VITERBI_X86)
+    if (CpuFeatures::has_avx512bw()) return { viterbi_kernel_avx512, "AVX-512" };
+    if (CpuFeatures::has_avx2()) return { viterbi_kernel_avx2, "AVX2" };
+    if (CpuFeatures::has_sse2()) return { viterbi_kernel_sse2, "SSE2" };
+#elif defined(VITERBI_NEON)
+    if (CpuFeatures::has_neon()) return { viterbi_kernel_neon, "NEON" };
+#endif
+    return { viterbi_kernel_scalar, "Scalar" };
+  }();
+  return kernel;
+}
 
 static const u8 PARTAB[256] =
 {
@@ -57,15 +56,7 @@ ViterbiSpiral::ViterbiSpiral(const i16 iWordlength, const bool iSpiralMode)
   : mFrameBits(iWordlength)
   , mSpiral(iSpiralMode)
 {
-#if defined(HAVE_VITERBI_AVX2)
-  qInfo("Using AVX2 for Viterbi spiral decoder");
-#elif defined(HAVE_VITERBI_SSE2)
-  qInfo("Using SSE2 for Viterbi spiral decoder");
-#elif defined(HAVE_VITERBI_NEON)
-  qInfo("Using NEON for Viterbi spiral decoder");
-#else
-  qInfo("Using Scalar for Viterbi spiral decoder");
-#endif
+  qInfo("Using %s for Viterbi spiral decoder", get_kernel().pName);
 
   const i32 nbits = mFrameBits + (K - 1);
   decisions = (decision_t *)malloc(nbits * sizeof(decision_t));
@@ -77,7 +68,7 @@ ViterbiSpiral::~ViterbiSpiral()
   free(decisions);
 }
 
-i32 ViterbiSpiral::parity(i32 x)
+static i32 parity(i32 x)
 {
   /* Fold down to one byte */
   x ^= (x >> 16);
@@ -94,22 +85,7 @@ return (0x6996 >> v) & 1;*/
 
 void ViterbiSpiral::deconvolve(const i16 * const input, u8 * const output)
 {
-  /* Initialize Viterbi decoder for start of new frame */
-  for (i32 i = 0; i < NUMSTATES; i++)
-    metrics1[i] = 1000;
-
-  metrics1[0] = 0; /* Bias known start state */
-
-  u32 nbits = mFrameBits + (K - 1);
-
-#if defined(HAVE_VITERBI_AVX2)
-  #include "viterbi_16way.h"
-
-#elif defined(HAVE_VITERBI_NEON) || defined(HAVE_VITERBI_SSE2)
-  #include "viterbi_8way.h"
-#else
-  #include "viterbi_scalar.h"
-#endif
+  get_kernel().pFunc(input, mMetrics1, mMetrics2, decisions, mFrameBits + (K - 1));
 
   /* Do Viterbi chainback */
   u32 endstate = 0; /* Terminal encoder state */
@@ -125,40 +101,118 @@ void ViterbiSpiral::deconvolve(const i16 * const input, u8 * const output)
   }
 }
 
-void ViterbiSpiral::calculate_BER(const i16 * const input, u8 * punctureTable, u8 const * output, i32 & bits, i32 & errors)
+void ViterbiSpiral::deconvolve_packed(const i16 * const input, u8 * const output, const u8 * const ipXorMask)
 {
-  i32 i;
-  i32 sr = 0;
-  const i32 polys[RATE] = { 109, 79, 83, 109 };
+  get_kernel().pFunc(input, mMetrics1, mMetrics2, decisions, mFrameBits + (K - 1));
+
+  /* Do Viterbi chainback, the bits are collected from the LSB (last bit of a byte) upwards */
+  u32 endstate = 0; /* Terminal encoder state */
+  u32 framebits = mFrameBits;
+  u32 byte = 0;
+  decision_t * dec = decisions;
 
-  for (i = 0; i < mFrameBits; i++)
+  dec += (K - 1); /* Look past tail */
+  while (framebits--)
   {
-    sr = ((sr << 1) | output[i]) & 0xff;
-    for (i32 j = 0; j < RATE; j++)
+    i32 k = (dec[framebits].w[(endstate >> 2) / 32] >> ((endstate >> 2) % 32)) & 1;
+    endstate = (endstate >> 1) | (k << K);
+    byte = (byte >> 1) | (k << 7);
+    if ((framebits & 7) == 0)
     {
-      u8 b = parity(sr & polys[j]);
-      if (punctureTable[i * RATE + j])
-      {
-        bits++;
-        if ((input[i * RATE + j] > 0) != b)
-          errors++;
-      }
+      output[framebits >> 3] = (u8)(ipXorMask != nullptr ? byte ^ ipXorMask[framebits >> 3] : byte);
     }
   }
+}
 
-  //Now the residue bits. Empty the registers by shifting in zeros
-  for (i = mFrameBits; i < mFrameBits + 6; i++)
+// the 4 code bits (one byte each, 0 or 1) for each state of the shift register
+static const std::array<std::array<u8, RATE>, 256> cEncoderTable = []()
+{
+  const i32 polys[RATE] = { 109, 79, 83, 109 };
+  std::array<std::array<u8, RATE>, 256> t{};
+  for (i32 sr = 0; sr < 256; sr++)
   {
-    sr = (sr << 1) & 0xff;
     for (i32 j = 0; j < RATE; j++)
     {
-      u8 b = parity(sr & polys[j]);
-      if (punctureTable[i * RATE + j])
-      {
-        bits++;
-        if ((input[i * RATE + j] > 0) != b)
-          errors++;
-      }
+      t[sr][j] = (u8)parity(sr & polys[j]);
     }
   }
+  return t;
+}();
+
+void ViterbiSpiral::calculate_BER(const i16 * const input, const u8 * punctureTable, u8 const * output, i32 & bits, i32 & errors, u32 * const opPathMetric)
+{
+  const i32 numCodeBits = (mFrameBits + (K - 1)) * RATE;
+
+  if (mCodeBits.empty())
+  {
+    mCodeBits.resize(numCodeBits); // only the FIC decoder calls this, so the MSC instances do not need the buffer
+  }
+  u8 * const codeBits = mCodeBits.data();
+  i32 sr = 0;
+
+  // re-encode the decoded bits, the residue bits at the end empty the register by shifting in zeros
+  for (i32 i = 0; i < mFrameBits + (K - 1); i++)
+  {
+    sr = ((sr << 1) | (i < mFrameBits ? output[i] : 0)) & 0xff;
+    memcpy(&codeBits[i * RATE], cEncoderTable[sr].data(), RATE);
+  }
+
+  // compare with the input branch-free, the soft distance is scaled like the branch metrics in the Viterbi kernels
+  i32 numBits = 0;
+  i32 numErrors = 0;
+  u32 pathMetric = 0;
+  i32 idx = 0;
+
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(1);
+  const __m128i c127 = _mm_set1_epi16(127);
+  const __m128i c255 = _mm_set1_epi16(255);
+  __m128i accBits = zero;   // 8 x i16, at most numCodeBits / 8 per lane
+  __m128i accErrors = zero; // 8 x i16
+  __m128i accMetric = zero; // 4 x i32
+
+  for (; idx + 8 <= numCodeBits; idx += 8)
+  {
+    const __m128i in = _mm_loadu_si128((const __m128i *)&input[idx]);
+    const __m128i used = _mm_cmpgt_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&punctureTable[idx]), zero), zero);
+    const __m128i b = _mm_cmpgt_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&codeBits[idx]), zero), zero);
+    const __m128i hard = _mm_cmpgt_epi16(in, zero);
+    const __m128i sym = _mm_min_epi16(_mm_max_epi16(_mm_adds_epi16(in, c127), zero), c255);
+    const __m128i dist = _mm_and_si128(_mm_xor_si128(sym, _mm_and_si128(b, c255)), used);
+    accBits = _mm_sub_epi16(accBits, used);
+    accErrors = _mm_sub_epi16(accErrors, _mm_and_si128(_mm_xor_si128(hard, b), used));
+    accMetric = _mm_add_epi32(accMetric, _mm_madd_epi16(dist, ones));
+  }
+
+  alignas(16) i16 bitsV[8];
+  alignas(16) i16 errorsV[8];
+  alignas(16) i32 metricV[4];
+  _mm_store_si128((__m128i *)bitsV, accBits);
+  _mm_store_si128((__m128i *)errorsV, accErrors);
+  _mm_store_si128((__m128i *)metricV, accMetric);
+  for (i32 i = 0; i < 8; i++)
+  {
+    numBits += bitsV[i];
+    numErrors += errorsV[i];
+  }
+  pathMetric = (u32)(metricV[0] + metricV[1] + metricV[2] + metricV[3]);
+#endif
+
+  for (; idx < numCodeBits; idx++)
+  {
+    const i32 used = (punctureTable[idx] != 0);
+    const i32 b = codeBits[idx];
+    const i32 sym = std::min(std::max(input[idx] + 127, 0), 255);
+    numBits += used;
+    numErrors += used & ((i32)(input[idx] > 0) ^ b);
+    pathMetric += (u32)(used * (sym ^ (-b & 255)));
+  }
+
+  bits += numBits;
+  errors += numErrors;
+  if (opPathMetric != nullptr)
+  {
+    *opPathMetric = pathMetric;
+  }
 }
@@ -3,6 +3,7 @@
  * 	Viterbi.h according to the SPIRAL project
  */
 #include "dab_constants.h"
+#include <vector>
 
 #define NUMSTATES 64
 
@@ -18,13 +19,24 @@ public:
   virtual ~ViterbiSpiral();
 
   void deconvolve(const short * const input, u8 * const output);
-  void calculate_BER(const short * const input, u8 * punctureTable,
-                     u8 const * output, i32 & bits, i32 & errors);
+  // same as deconvolve() but the output is packed into bytes (MSB first), the frame length must be a multiple of 8 bits,
+  // if ipXorMask is given each output byte is XORed with it (e.g. to reverse the energy dispersal)
+  void deconvolve_packed(const short * const input, u8 * const output, const u8 * const ipXorMask = nullptr);
+  // Re-encodes the decoded bits and compares them with the hard decisions of the non-punctured input bits
+  // (bits and errors are accumulated). If opPathMetric is given it gets the path metric of the decoded path, which is
+  // the sum of the soft distances of the non-punctured input bits to the re-encoded bits (0 is perfect, up to 255 per bit).
+  void calculate_BER(const short * const input, const u8 * punctureTable,
+                     u8 const * output, i32 & bits, i32 & errors, u32 * opPathMetric = nullptr);
 
 private:
-  i32 parity(i32);
   const short mFrameBits;
   const bool mSpiral;
   decision_t * decisions = nullptr;
+  std::vector<u8> mCodeBits; // re-encoded bits for calculate_BER(), allocated with its first call
+
+  // The path metrics are kept per instance (formerly file-static) so that several instances can deconvolve concurrently
+  // in different threads. The storage is sized for the widest compute type (i32) and cache line aligned for the SIMD kernels.
+  alignas(64) u8 mMetrics1[NUMSTATES * sizeof(i32)];
+  alignas(64) u8 mMetrics2[NUMSTATES * sizeof(i32)];
 };
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+// Asymmetric memory fences for a store-then-load handshake (each side stores its own flag and loads the one of the other
+// side) where one side runs very often (fast path, e.g. the producer of a ring buffer) and the other one only rarely
+// (slow path, e.g. a consumer which goes to sleep). light() costs nothing more than a compiler barrier, heavy() lets all
+// running threads of the process execute a full memory barrier (Linux membarrier(), Windows FlushProcessWriteBuffers()).
+// A light() on one side and a heavy() on the other side act like a seq_cst fence on both sides.
+// Without such an OS support both are seq_cst fences.
+
+#include <atomic>
+
+#if defined(_WIN32)
+  extern "C" __declspec(dllimport) void __stdcall FlushProcessWriteBuffers(void); // same as in windows.h, which is not wanted in this often included header
+#elif defined(__linux__) && __has_include(<linux/membarrier.h>)
+  #include <linux/membarrier.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #if defined(__NR_membarrier)
+    #define ASYMMETRIC_FENCE_USE_MEMBARRIER
+  #endif
+#endif
+
+namespace AsymmetricFence
+{
+
+namespace Detail
+{
+inline std::atomic<bool> sHeavyAvailable{false}; // set only after the heavy fence is usable, light() falls back to a full fence before
+
+inline bool heavy_available()
+{
+  static const bool b = []()
+  {
+#if defined(_WIN32)
+    const bool ok = true;
+#elif defined(ASYMMETRIC_FENCE_USE_MEMBARRIER)
+    const bool ok = syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0; // needs Linux >= 4.14
+#else
+    const bool ok = false;
+#endif
+    sHeavyAvailable.store(ok);
+    return ok;
+  }();
+  return b;
+}
+}
+
+inline void light()
+{
+  if (Detail::sHeavyAvailable.load(std::memory_order_relaxed))
+  {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+  }
+  else
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
+inline void heavy()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (Detail::heavy_available())
+  {
+#if defined(_WIN32)
+    FlushProcessWriteBuffers();
+#elif defined(ASYMMETRIC_FENCE_USE_MEMBARRIER)
+    syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+#endif
+  }
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+// Runtime detection of the SIMD features of the running CPU (for choosing the best kernel at startup)
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+#endif
+
+namespace CpuFeatures
+{
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+namespace Detail
+{
+inline bool os_saves_xstate(const unsigned long long iMask)
+{
+  int info[4];
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  return osxsave && (_xgetbv(0) & iMask) == iMask;
+}
+
+inline bool has_leaf7_ebx_bit(const int iBit)
+{
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << iBit)) != 0;
+}
+}
+
+inline bool has_sse2()     { return true; } // x86_64 baseline (and MSVC does not support x86 CPUs without SSE2 anymore)
+inline bool has_ssse3()    { static const bool b = []() { int info[4]; __cpuid(info, 1); return (info[2] & (1 << 9)) != 0; }(); return b; }
+inline bool has_sse41()    { static const bool b = []() { int info[4]; __cpuid(info, 1); return (info[2] & (1 << 19)) != 0; }(); return b; }
+inline bool has_avx2()     { static const bool b = Detail::os_saves_xstate(0x06) && Detail::has_leaf7_ebx_bit(5); return b; }
+inline bool has_avx512bw() { static const bool b = Detail::os_saves_xstate(0xE6) && Detail::has_leaf7_ebx_bit(16) && Detail::has_leaf7_ebx_bit(30) && Detail::has_leaf7_ebx_bit(8); return b; } // incl. BMI2
+
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
+// __builtin_cpu_supports() considers also the OS support of the extended register state
+inline bool has_sse2()     { static const bool b = __builtin_cpu_supports("sse2"); return b; }
+inline bool has_ssse3()    { static const bool b = __builtin_cpu_supports("ssse3"); return b; }
+inline bool has_sse41()    { static const bool b = __builtin_cpu_supports("sse4.1"); return b; }
+inline bool has_avx2()     { static const bool b = __builtin_cpu_supports("avx2"); return b; }
+inline bool has_avx512bw() { static const bool b = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("bmi2"); return b; } // incl. BMI2
+
+#else
+
+inline bool has_sse2()     { return false; }
+inline bool has_ssse3()    { return false; }
+inline bool has_sse41()    { return false; }
+inline bool has_avx2()     { return false; }
+inline bool has_avx512bw() { return false; }
+
+#endif
+
+#if defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+inline bool has_neon()     { return true; } // mandatory on AArch64, on 32 bit ARM only available if the compiler was told so
+#else
+inline bool has_neon()     { return false; }
+#endif
+
+}
@@ -32,6 +32,8 @@
 
 #include "glob_defs.h"
 #include <QString>
+#include <chrono>
+#include <thread>
 
 class QWidget;
 
@@ -55,6 +57,20 @@ public:
   virtual void setVisible(bool iVisible) { if (iVisible) show(); else hide(); }
   virtual QWidget * get_widget() { return nullptr; }
   virtual bool isFileInput() {return false;};
+
+  // Blocks until at least iNoSamples samples are available or the timeout elapsed, returns the available samples.
+  // Devices with a sample ring buffer override this with RingBuffer::wait_for_read_available(), this is only a polling fallback.
+  virtual i32 wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(iTimeoutMs);
+    i32 available = Samples();
+    while (available < iNoSamples && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      available = Samples();
+    }
+    return available;
+  }
   virtual bool should_be_visible() const { return false; } // should the device be visible at startup?
   virtual bool hasDump() {return false;};
   virtual bool startDumping() {return false;};
@@ -22,6 +22,122 @@
  */
 
 #include "fir_filters.h"
+#include "cpu_features.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define TARGET_AVX2  __attribute__((target("avx2")))
+#else
+  #define TARGET_SSE41
+  #define TARGET_AVX2
+#endif
+
+//	Filtering of iNumOut outputs, output i is the sum of
+//	ipX [i + j] * ipTaps [j] over all taps j (the taps are given
+//	in reversed order). The SIMD variants calculate several adjacent
+//	outputs at once: each tap is broadcast and multiplied with the
+//	window of interleaved samples (which has already the layout of
+//	the outputs), so no horizontal sum is needed. All variants sum up
+//	the taps in the same order.
+static void	fir_scalar (const cf32 * ipX, const f32 * ipTaps, i32 iNumTaps,
+	                    cf32 * opOut, i32 iNumOut) {
+	for (i32 i = 0; i < iNumOut; i ++) {
+	   f32	re	= 0;
+	   f32	im	= 0;
+	   for (i32 j = 0; j < iNumTaps; j ++) {
+	      re	+= real (ipX [i + j]) * ipTaps [j];
+	      im	+= imag (ipX [i + j]) * ipTaps [j];
+	   }
+	   opOut [i]	= cf32 (re, im);
+	}
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TARGET_SSE41 static void	fir_sse41 (const cf32 * ipX, const f32 * ipTaps, i32 iNumTaps,
+	                                   cf32 * opOut, i32 iNumOut) {
+const f32 * const x	= reinterpret_cast<const f32 *> (ipX);
+f32 * const out		= reinterpret_cast<f32 *> (opOut);
+i32	i	= 0;
+
+	for (; i + 4 <= iNumOut; i += 4) {
+	   __m128	acc0	= _mm_setzero_ps ();
+	   __m128	acc1	= _mm_setzero_ps ();
+	   for (i32 j = 0; j < iNumTaps; j ++) {
+	      const __m128 t	= _mm_set1_ps (ipTaps [j]);
+	      acc0 = _mm_add_ps (acc0, _mm_mul_ps (_mm_loadu_ps (x + 2 * (i + j)), t));
+	      acc1 = _mm_add_ps (acc1, _mm_mul_ps (_mm_loadu_ps (x + 2 * (i + j) + 4), t));
+	   }
+	   _mm_storeu_ps (out + 2 * i, acc0);
+	   _mm_storeu_ps (out + 2 * i + 4, acc1);
+	}
+	fir_scalar (ipX + i, ipTaps, iNumTaps, opOut + i, iNumOut - i);
+}
+
+TARGET_AVX2 static void	fir_avx2 (const cf32 * ipX, const f32 * ipTaps, i32 iNumTaps,
+	                                  cf32 * opOut, i32 iNumOut) {
+const f32 * const x	= reinterpret_cast<const f32 *> (ipX);
+f32 * const out		= reinterpret_cast<f32 *> (opOut);
+i32	i	= 0;
+
+	for (; i + 8 <= iNumOut; i += 8) {
+	   __m256	acc0	= _mm256_setzero_ps ();
+	   __m256	acc1	= _mm256_setzero_ps ();
+	   for (i32 j = 0; j < iNumTaps; j ++) {
+	      const __m256 t	= _mm256_set1_ps (ipTaps [j]);
+	      acc0 = _mm256_add_ps (acc0, _mm256_mul_ps (_mm256_loadu_ps (x + 2 * (i + j)), t));
+	      acc1 = _mm256_add_ps (acc1, _mm256_mul_ps (_mm256_loadu_ps (x + 2 * (i + j) + 8), t));
+	   }
+	   _mm256_storeu_ps (out + 2 * i, acc0);
+	   _mm256_storeu_ps (out + 2 * i + 8, acc1);
+	}
+//	no AVX-SSE transition penalty in the (non VEX encoded) scalar code
+	_mm256_zeroupper ();
+	fir_scalar (ipX + i, ipTaps, iNumTaps, opOut + i, iNumOut - i);
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static void	fir_neon (const cf32 * ipX, const f32 * ipTaps, i32 iNumTaps,
+	                  cf32 * opOut, i32 iNumOut) {
+const f32 * const x	= reinterpret_cast<const f32 *> (ipX);
+f32 * const out		= reinterpret_cast<f32 *> (opOut);
+i32	i	= 0;
+
+	for (; i + 4 <= iNumOut; i += 4) {
+	   float32x4_t	acc0	= vdupq_n_f32 (0);
+	   float32x4_t	acc1	= vdupq_n_f32 (0);
+	   for (i32 j = 0; j < iNumTaps; j ++) {
+	      const float32x4_t t	= vdupq_n_f32 (ipTaps [j]);
+	      acc0 = vaddq_f32 (acc0, vmulq_f32 (vld1q_f32 (x + 2 * (i + j)), t));
+	      acc1 = vaddq_f32 (acc1, vmulq_f32 (vld1q_f32 (x + 2 * (i + j) + 4), t));
+	   }
+	   vst1q_f32 (out + 2 * i, acc0);
+	   vst1q_f32 (out + 2 * i + 4, acc1);
+	}
+	fir_scalar (ipX + i, ipTaps, iNumTaps, opOut + i, iNumOut - i);
+}
+
+#endif
+
+static LowPassFIR::TFirKernel	get_fir_kernel () {
+static const LowPassFIR::TFirKernel kernel = []() -> LowPassFIR::TFirKernel {
+#if defined(__x86_64__) || defined(_M_X64)
+	   if (CpuFeatures::has_avx2 ()) return fir_avx2;
+	   if (CpuFeatures::has_sse41 ()) return fir_sse41;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	   if (CpuFeatures::has_neon ()) return fir_neon;
+#endif
+	   return fir_scalar;
+	}();
+	return kernel;
+}
 
 //	FIR LowPass
 
@@ -33,12 +149,11 @@ auto * const temp = make_vla(f32, firsize);
 	this -> frequency	= (f32)Fc / fs;
 	this -> filterSize	= firsize;
 	this -> ip		= 0;
+	this -> firKernel	= get_fir_kernel ();
 	filterKernel.	resize (filterSize);
-	Buffer.		resize (filterSize);
 
 	for (i32 i = 0; i < filterSize; i ++) {
 	   filterKernel [i]	= 0;
-	   Buffer [i]		= cf32 (0, 0);
 	}
 
 	for (i32 i = 0; i < filterSize; i ++) {
@@ -58,13 +173,22 @@ auto * const temp = make_vla(f32, firsize);
 
 	for (i32 i = 0; i < filterSize; i ++)
 	   filterKernel [i] = temp [i] / sum;
+	setupTaps ();
 }
 
 	LowPassFIR::~LowPassFIR () {
 }
 
 i32	LowPassFIR::theSize	() {
-	return Buffer. size ();
+	return filterSize;
+}
+
+//	clears the history and builds the reversed taps
+void	LowPassFIR::setupTaps () {
+	Buffer. assign (2 * filterSize, cf32 (0, 0));
+	tapsReversed. resize (filterSize);
+	for (i32 i = 0; i < filterSize; i ++)
+	   tapsReversed [i]	= filterKernel [filterSize - 1 - i];
 }
 
 void	LowPassFIR::resize (i32 newSize) {
@@ -73,7 +197,6 @@ f32	sum = 0;
 
 	filterSize	= newSize;
 	filterKernel. resize (filterSize);
-	Buffer. resize (filterSize);
 	ip		= 0;
 
 	for (i32 i = 0; i < filterSize; i ++) {
@@ -97,26 +220,46 @@ f32	sum = 0;
 
 	for (i32 i = 0; i < filterSize; i ++)
 	   filterKernel [i] = temp [i] / sum;
+	setupTaps ();
 }
 
-//	we process the samples backwards rather than reversing
-//	the kernel
+//	the new sample is stored at ip and ip + filterSize, the window
+//	of the last filterSize samples starts then at ip + 1 and is
+//	multiplied with the reversed kernel
 cf32	LowPassFIR::Pass (cf32 z) {
-i16	i;
-cf32	tmp	= 0;
-
-	Buffer [ip]	= z;
-	for (i = 0; i < filterSize; i ++) {
-	   i16 index = ip - i;
-	   if (index < 0)
-	      index += filterSize;
-	   tmp		+= Buffer [index] * filterKernel [i];
-	}
-
+	Buffer [ip]		= z;
+	Buffer [ip + filterSize]	= z;
+cf32	tmp;
+	fir_scalar (&Buffer [ip + 1], tapsReversed. data (), filterSize, &tmp, 1);
 	ip = (ip + 1) % filterSize;
 	return tmp;
 }
 
+//	For a block the history (the last filterSize - 1 samples) and the
+//	new samples are put in one linear buffer, so the kernel can
+//	calculate many adjacent outputs from contiguous windows.
+//	Afterwards the doubled history is set up again for Pass ().
+void	LowPassFIR::process (const cf32 * ipIn, cf32 * opOut, i32 iNumSamples) {
+const i32	histSize	= filterSize - 1;
+
+	if (iNumSamples <= 0)
+	   return;
+	if ((i32)workBuffer. size () < histSize + iNumSamples)
+	   workBuffer. resize (histSize + iNumSamples);
+	cf32 * const work	= workBuffer. data ();
+
+	std::copy (&Buffer [ip + 1], &Buffer [ip + 1] + histSize, work);
+	std::copy (ipIn, ipIn + iNumSamples, work + histSize);
+
+	firKernel (work, tapsReversed. data (), filterSize, opOut, iNumSamples);
+
+	for (i32 k = 1; k < filterSize; k ++) {
+	   Buffer [k]		= work [iNumSamples + k - 1];
+	   Buffer [k + filterSize]	= work [iNumSamples + k - 1];
+	}
+	ip	= 0;
+}
+
 f32	LowPassFIR::Pass (f32 v) {
 	return real (Pass (cf32 (v, 0)));
 }
@@ -26,6 +26,7 @@
 
 #include	"dab_constants.h"
 #include	<vector>
+#include	<algorithm>
 
 class	LowPassFIR {
 public:
@@ -36,14 +37,27 @@ public:
 			~LowPassFIR ();
 	cf32	Pass		(cf32);
 	f32			Pass		(f32);
+//	filters a block of samples, ipIn and opOut may be the same buffer
+	void			process		(const cf32 * ipIn,
+	                                         cf32 * opOut,
+	                                         i32 iNumSamples);
 	void			resize		(i32);
 	i32			theSize		();
+
+	using TFirKernel = void (*)(const cf32 * ipX, const f32 * ipTaps, i32 iNumTaps,
+	                            cf32 * opOut, i32 iNumOut);
 private:
 	i16		filterSize;
 	i16		ip;
 	std::vector<f32>	filterKernel;
+//	the history is stored twice (at ip and ip + filterSize), so the
+//	last filterSize samples are always contiguous in memory
 	std::vector<cf32>	Buffer;
+	std::vector<f32>	tapsReversed;
+	std::vector<cf32>	workBuffer;
 	f32		frequency;
+	TFirKernel	firKernel;
+	void		setupTaps	();
 };
 
 
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "iq_converter.h"
+#include "cpu_features.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define TARGET_AVX2  __attribute__((target("avx2")))
+#else
+  #define TARGET_SSE41
+  #define TARGET_AVX2
+#endif
+
+/*
+ * Notes to the SIMD variants:
+ * - An interleaved IQ stream has already the memory layout of a cf32 array, so apart from the i12 packed format
+ *   every value is converted independently (widening to i32, conversion to f32, subtraction, multiplication).
+ * - The signed formats have no offset, x * s is the same as (x - 0) * s, so the offset is not applied there.
+ * - The big endian i16 values are byte swapped with a shuffle before the widening.
+ * - For the i12 packed format a shuffle builds one 16 bit word per value which contains the 12 bits of it:
+ *   (b1:b0) for I and (b2:b1) for Q. I is shifted up by 4 bits with a multiplication by 16, then both are
+ *   shifted down arithmetically by 4 bits, which also does the sign extension.
+ * - The remaining values at the end of a block are done with the scalar code.
+ * - The AVX2 variants clear the upper register halves explicitly before the (non VEX encoded) scalar code runs,
+ *   the compiler does not insert this reliably for functions with a target attribute.
+ */
+
+static inline f32 * as_f32(cf32 * const opV) { return reinterpret_cast<f32 *>(opV); }
+
+static inline i16 i12_first(const u8 * const ipB) { return (i16)((i16)(u16)((ipB[0] | (ipB[1] << 8)) << 4) >> 4); }
+static inline i16 i12_second(const u8 * const ipB) { return (i16)((i16)(u16)(ipB[1] | (ipB[2] << 8)) >> 4); }
+
+// The scalar loops are written for the auto-vectorizer: they run over blocks with a fixed number of values, so the
+// compiler vectorizes them also with -O2 (where GCC does not vectorize a loop which needs a scalar epilogue), and the
+// pointers are marked as not aliasing (the u8 input could alias the output otherwise). The rest is done value by value.
+// Only the i12 packed format is not vectorized by the compiler (3 byte stride), this one is left as simple as possible.
+constexpr i32 cScalarBlockSize = 16;
+
+template<typename TConv>
+static inline void for_each_value(const i32 iNumVal, const TConv & iConv)
+{
+  i32 i = 0;
+  for (; i + cScalarBlockSize <= iNumVal; i += cScalarBlockSize)
+  {
+    for (i32 j = 0; j < cScalarBlockSize; ++j)
+    {
+      iConv(i + j);
+    }
+  }
+  for (; i < iNumVal; ++i)
+  {
+    iConv(i);
+  }
+}
+
+static void conv_u8_scalar(const u8 * __restrict const ipIQ, cf32 * __restrict const opV, const i32 iNumSamples, const f32 iOffset, const f32 iScale)
+{
+  f32 * __restrict const pOut = as_f32(opV);
+  for_each_value(2 * iNumSamples, [=](const i32 i) { pOut[i] = ((f32)ipIQ[i] - iOffset) * iScale; });
+}
+
+static void conv_i8_scalar(const i8 * __restrict const ipIQ, cf32 * __restrict const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * __restrict const pOut = as_f32(opV);
+  for_each_value(2 * iNumSamples, [=](const i32 i) { pOut[i] = (f32)ipIQ[i] * iScale; });
+}
+
+static void conv_i16_scalar(const i16 * __restrict const ipIQ, cf32 * __restrict const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * __restrict const pOut = as_f32(opV);
+  for_each_value(2 * iNumSamples, [=](const i32 i) { pOut[i] = (f32)ipIQ[i] * iScale; });
+}
+
+static void conv_i16be_scalar(const u8 * __restrict const ipIQ, cf32 * __restrict const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * __restrict const pOut = as_f32(opV);
+  for_each_value(2 * iNumSamples, [=](const i32 i) { pOut[i] = (f32)(i16)((ipIQ[2 * i] << 8) | ipIQ[2 * i + 1]) * iScale; });
+}
+
+static void conv_i12_packed_scalar(const u8 * __restrict const ipIQ, cf32 * __restrict const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * __restrict const pOut = as_f32(opV);
+  for_each_value(iNumSamples, [=](const i32 i)
+  {
+    pOut[2 * i + 0] = (f32)i12_first(ipIQ + 3 * i) * iScale;
+    pOut[2 * i + 1] = (f32)i12_second(ipIQ + 3 * i) * iScale;
+  });
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TARGET_SSE41 static inline void store_4x_sse41(f32 * const opOut, const __m128i iVal, const __m128 iOffset, const __m128 iScale)
+{
+  _mm_storeu_ps(opOut, _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(iVal), iOffset), iScale));
+}
+
+TARGET_SSE41 static inline void store_4x_sse41(f32 * const opOut, const __m128i iVal, const __m128 iScale)
+{
+  _mm_storeu_ps(opOut, _mm_mul_ps(_mm_cvtepi32_ps(iVal), iScale));
+}
+
+TARGET_SSE41 static void conv_u8_sse41(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iOffset, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m128 offset = _mm_set1_ps(iOffset);
+  const __m128 scale = _mm_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    const __m128i b = _mm_loadu_si128((const __m128i *)(ipIQ + i));
+    store_4x_sse41(pOut + i +  0, _mm_cvtepu8_epi32(b), offset, scale);
+    store_4x_sse41(pOut + i +  4, _mm_cvtepu8_epi32(_mm_srli_si128(b, 4)), offset, scale);
+    store_4x_sse41(pOut + i +  8, _mm_cvtepu8_epi32(_mm_srli_si128(b, 8)), offset, scale);
+    store_4x_sse41(pOut + i + 12, _mm_cvtepu8_epi32(_mm_srli_si128(b, 12)), offset, scale);
+  }
+  conv_u8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iOffset, iScale);
+}
+
+TARGET_SSE41 static void conv_i8_sse41(const i8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m128 scale = _mm_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    const __m128i b = _mm_loadu_si128((const __m128i *)(ipIQ + i));
+    store_4x_sse41(pOut + i +  0, _mm_cvtepi8_epi32(b), scale);
+    store_4x_sse41(pOut + i +  4, _mm_cvtepi8_epi32(_mm_srli_si128(b, 4)), scale);
+    store_4x_sse41(pOut + i +  8, _mm_cvtepi8_epi32(_mm_srli_si128(b, 8)), scale);
+    store_4x_sse41(pOut + i + 12, _mm_cvtepi8_epi32(_mm_srli_si128(b, 12)), scale);
+  }
+  conv_i8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+TARGET_SSE41 static void conv_i16_sse41(const i16 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m128 scale = _mm_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 8 <= numVal; i += 8)
+  {
+    const __m128i w = _mm_loadu_si128((const __m128i *)(ipIQ + i));
+    store_4x_sse41(pOut + i + 0, _mm_cvtepi16_epi32(w), scale);
+    store_4x_sse41(pOut + i + 4, _mm_cvtepi16_epi32(_mm_srli_si128(w, 8)), scale);
+  }
+  conv_i16_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+TARGET_SSE41 static void conv_i16be_sse41(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m128 scale = _mm_set1_ps(iScale);
+  const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  i32 i = 0;
+
+  for (; i + 8 <= numVal; i += 8)
+  {
+    const __m128i w = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(ipIQ + 2 * i)), swap);
+    store_4x_sse41(pOut + i + 0, _mm_cvtepi16_epi32(w), scale);
+    store_4x_sse41(pOut + i + 4, _mm_cvtepi16_epi32(_mm_srli_si128(w, 8)), scale);
+  }
+  conv_i16be_scalar(ipIQ + 2 * i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+// unpacks 4 complex samples (12 bytes, the load reads 16 bytes) into 8 sign extended i16 values
+TARGET_SSE41 static inline __m128i unpack_i12_sse41(const u8 * const ipB)
+{
+  const __m128i words = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ipB),
+                                         _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+  return _mm_srai_epi16(_mm_mullo_epi16(words, _mm_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1)), 4);
+}
+
+TARGET_SSE41 static void conv_i12_packed_sse41(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const __m128 scale = _mm_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; 3 * i + 16 <= 3 * iNumSamples; i += 4)
+  {
+    const __m128i w = unpack_i12_sse41(ipIQ + 3 * i);
+    store_4x_sse41(pOut + 2 * i + 0, _mm_cvtepi16_epi32(w), scale);
+    store_4x_sse41(pOut + 2 * i + 4, _mm_cvtepi16_epi32(_mm_srli_si128(w, 8)), scale);
+  }
+  conv_i12_packed_scalar(ipIQ + 3 * i, opV + i, iNumSamples - i, iScale);
+}
+
+TARGET_AVX2 static inline void store_8x_avx2(f32 * const opOut, const __m256i iVal, const __m256 iOffset, const __m256 iScale)
+{
+  _mm256_storeu_ps(opOut, _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(iVal), iOffset), iScale));
+}
+
+TARGET_AVX2 static inline void store_8x_avx2(f32 * const opOut, const __m256i iVal, const __m256 iScale)
+{
+  _mm256_storeu_ps(opOut, _mm256_mul_ps(_mm256_cvtepi32_ps(iVal), iScale));
+}
+
+TARGET_AVX2 static void conv_u8_avx2(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iOffset, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m256 offset = _mm256_set1_ps(iOffset);
+  const __m256 scale = _mm256_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 32 <= numVal; i += 32)
+  {
+    const __m128i b0 = _mm_loadu_si128((const __m128i *)(ipIQ + i));
+    const __m128i b1 = _mm_loadu_si128((const __m128i *)(ipIQ + i + 16));
+    store_8x_avx2(pOut + i +  0, _mm256_cvtepu8_epi32(b0), offset, scale);
+    store_8x_avx2(pOut + i +  8, _mm256_cvtepu8_epi32(_mm_srli_si128(b0, 8)), offset, scale);
+    store_8x_avx2(pOut + i + 16, _mm256_cvtepu8_epi32(b1), offset, scale);
+    store_8x_avx2(pOut + i + 24, _mm256_cvtepu8_epi32(_mm_srli_si128(b1, 8)), offset, scale);
+  }
+  _mm256_zeroupper();
+  conv_u8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iOffset, iScale);
+}
+
+TARGET_AVX2 static void conv_i8_avx2(const i8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m256 scale = _mm256_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 32 <= numVal; i += 32)
+  {
+    const __m128i b0 = _mm_loadu_si128((const __m128i *)(ipIQ + i));
+    const __m128i b1 = _mm_loadu_si128((const __m128i *)(ipIQ + i + 16));
+    store_8x_avx2(pOut + i +  0, _mm256_cvtepi8_epi32(b0), scale);
+    store_8x_avx2(pOut + i +  8, _mm256_cvtepi8_epi32(_mm_srli_si128(b0, 8)), scale);
+    store_8x_avx2(pOut + i + 16, _mm256_cvtepi8_epi32(b1), scale);
+    store_8x_avx2(pOut + i + 24, _mm256_cvtepi8_epi32(_mm_srli_si128(b1, 8)), scale);
+  }
+  _mm256_zeroupper();
+  conv_i8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+TARGET_AVX2 static void conv_i16_avx2(const i16 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m256 scale = _mm256_set1_ps(iScale);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    store_8x_avx2(pOut + i + 0, _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(ipIQ + i))), scale);
+    store_8x_avx2(pOut + i + 8, _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(ipIQ + i + 8))), scale);
+  }
+  _mm256_zeroupper();
+  conv_i16_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+TARGET_AVX2 static void conv_i16be_avx2(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const __m256 scale = _mm256_set1_ps(iScale);
+  const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    const __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(ipIQ + 2 * i)), swap);
+    const __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(ipIQ + 2 * i + 16)), swap);
+    store_8x_avx2(pOut + i + 0, _mm256_cvtepi16_epi32(w0), scale);
+    store_8x_avx2(pOut + i + 8, _mm256_cvtepi16_epi32(w1), scale);
+  }
+  _mm256_zeroupper();
+  conv_i16be_scalar(ipIQ + 2 * i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+TARGET_AVX2 static void conv_i12_packed_avx2(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const __m256 scale = _mm256_set1_ps(iScale);
+  i32 i = 0;
+
+  // 8 complex samples (24 bytes) per loop, the second load reads up to byte 28
+  for (; 3 * i + 28 <= 3 * iNumSamples; i += 8)
+  {
+    store_8x_avx2(pOut + 2 * i + 0, _mm256_cvtepi16_epi32(unpack_i12_sse41(ipIQ + 3 * i)), scale);
+    store_8x_avx2(pOut + 2 * i + 8, _mm256_cvtepi16_epi32(unpack_i12_sse41(ipIQ + 3 * i + 12)), scale);
+  }
+  _mm256_zeroupper();
+  conv_i12_packed_scalar(ipIQ + 3 * i, opV + i, iNumSamples - i, iScale);
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static inline void store_8x_neon(f32 * const opOut, const int16x8_t iVal, const float32x4_t iOffset, const float32x4_t iScale)
+{
+  vst1q_f32(opOut + 0, vmulq_f32(vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iVal))), iOffset), iScale));
+  vst1q_f32(opOut + 4, vmulq_f32(vsubq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iVal))), iOffset), iScale));
+}
+
+static inline void store_8x_neon(f32 * const opOut, const int16x8_t iVal, const float32x4_t iScale)
+{
+  vst1q_f32(opOut + 0, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iVal))), iScale));
+  vst1q_f32(opOut + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iVal))), iScale));
+}
+
+static void conv_u8_neon(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iOffset, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const float32x4_t offset = vdupq_n_f32(iOffset);
+  const float32x4_t scale = vdupq_n_f32(iScale);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    const uint8x16_t b = vld1q_u8(ipIQ + i);
+    store_8x_neon(pOut + i + 0, vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b))), offset, scale);
+    store_8x_neon(pOut + i + 8, vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b))), offset, scale);
+  }
+  conv_u8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iOffset, iScale);
+}
+
+static void conv_i8_neon(const i8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const float32x4_t scale = vdupq_n_f32(iScale);
+  i32 i = 0;
+
+  for (; i + 16 <= numVal; i += 16)
+  {
+    const int8x16_t b = vld1q_s8(ipIQ + i);
+    store_8x_neon(pOut + i + 0, vmovl_s8(vget_low_s8(b)), scale);
+    store_8x_neon(pOut + i + 8, vmovl_s8(vget_high_s8(b)), scale);
+  }
+  conv_i8_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+static void conv_i16_neon(const i16 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const float32x4_t scale = vdupq_n_f32(iScale);
+  i32 i = 0;
+
+  for (; i + 8 <= numVal; i += 8)
+  {
+    store_8x_neon(pOut + i, vld1q_s16(ipIQ + i), scale);
+  }
+  conv_i16_scalar(ipIQ + i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+static void conv_i16be_neon(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const i32 numVal = 2 * iNumSamples;
+  const float32x4_t scale = vdupq_n_f32(iScale);
+  i32 i = 0;
+
+  for (; i + 8 <= numVal; i += 8)
+  {
+    store_8x_neon(pOut + i, vreinterpretq_s16_u8(vrev16q_u8(vld1q_u8(ipIQ + 2 * i))), scale);
+  }
+  conv_i16be_scalar(ipIQ + 2 * i, opV + i / 2, (numVal - i) / 2, iScale);
+}
+
+static void conv_i12_packed_neon(const u8 * const ipIQ, cf32 * const opV, const i32 iNumSamples, const f32 iScale)
+{
+  f32 * const pOut = as_f32(opV);
+  const float32x4_t scale = vdupq_n_f32(iScale);
+  i32 i = 0;
+
+  // the de-interleaving load delivers b0, b1 and b2 of 8 complex samples in separate registers
+  for (; i + 8 <= iNumSamples; i += 8)
+  {
+    const uint8x8x3_t b = vld3_u8(ipIQ + 3 * i);
+    const uint16x8_t b1 = vmovl_u8(b.val[1]);
+    const uint16x8_t re = vorrq_u16(vshlq_n_u16(vmovl_u8(b.val[0]), 4), vshlq_n_u16(b1, 12)); // 12 bit value in the upper bits
+    const uint16x8_t im = vorrq_u16(b1, vshlq_n_u16(vmovl_u8(b.val[2]), 8));
+    const int16x8_t reS = vshrq_n_s16(vreinterpretq_s16_u16(re), 4);
+    const int16x8_t imS = vshrq_n_s16(vreinterpretq_s16_u16(im), 4);
+    float32x4x2_t v;
+    v.val[0] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(reS))), scale);
+    v.val[1] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(imS))), scale);
+    vst2q_f32(pOut + 2 * i, v);
+    v.val[0] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(reS))), scale);
+    v.val[1] = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(imS))), scale);
+    vst2q_f32(pOut + 2 * i + 8, v);
+  }
+  conv_i12_packed_scalar(ipIQ + 3 * i, opV + i, iNumSamples - i, iScale);
+}
+
+#endif
+
+const SIqConverterKernels cIqConverterKernelsScalar = { conv_u8_scalar, conv_i8_scalar, conv_i16_scalar, conv_i16be_scalar, conv_i12_packed_scalar, "Scalar" };
+#if defined(__x86_64__) || defined(_M_X64)
+const SIqConverterKernels cIqConverterKernelsSse41 = { conv_u8_sse41, conv_i8_sse41, conv_i16_sse41, conv_i16be_sse41, conv_i12_packed_sse41, "SSE4.1" };
+const SIqConverterKernels cIqConverterKernelsAvx2 = { conv_u8_avx2, conv_i8_avx2, conv_i16_avx2, conv_i16be_avx2, conv_i12_packed_avx2, "AVX2" };
+#elif defined(__aarch64__) || defined(_M_ARM64)
+const SIqConverterKernels cIqConverterKernelsNeon = { conv_u8_neon, conv_i8_neon, conv_i16_neon, conv_i16be_neon, conv_i12_packed_neon, "NEON" };
+#endif
+
+const SIqConverterKernels & get_iq_converter_kernels()
+{
+  static const SIqConverterKernels & kernels = []() -> const SIqConverterKernels &
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (CpuFeatures::has_avx2()) return cIqConverterKernelsAvx2;
+    if (CpuFeatures::has_sse41()) return cIqConverterKernelsSse41;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (CpuFeatures::has_neon()) return cIqConverterKernelsNeon;
+#endif
+    return cIqConverterKernelsScalar;
+  }();
+  return kernels;
+}
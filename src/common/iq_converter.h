@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+/*
+ * Conversion of interleaved integer IQ samples (as delivered by the devices or stored in raw and xml files) into cf32.
+ * Each I and Q value is converted with opV = ((f32)ipIQ - iOffset) * iScale, so all variants deliver bit-identical
+ * results. The scalar, SSE4.1, AVX2 and NEON (AArch64) variants are compiled in, the best one is chosen at runtime.
+ * iNumSamples is always the number of complex samples.
+ */
+#include "glob_defs.h"
+
+// offset and scaling of the u8 samples of the rtlsdr sticks (also used for the raw and xml files recorded with them),
+// the DC offset of the sticks is a bit shifted from the ideal value 127.5 (from old-dab)
+inline constexpr f32 cRtlSdrIqOffset = 127.38f;
+inline constexpr f32 cRtlSdrIqScale = 1.0f / 128.0f;
+
+// u8 with DC offset (rtlsdr)
+using TIqConvU8 = void (*)(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iOffset, f32 iScale);
+// i8 (hackrf)
+using TIqConvI8 = void (*)(const i8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale);
+// i16 in native (little endian) byte order (sdrplay, lime, airspy, pluto)
+using TIqConvI16 = void (*)(const i16 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale);
+// i16 as big endian byte stream (xml files with byteOrder "MSB")
+using TIqConvI16Be = void (*)(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale);
+// 12 bit packed, 3 bytes per complex sample: I = b0 | (b1 & 0x0F) << 8, Q = (b1 >> 4) | b2 << 4 (both two's complement)
+using TIqConvI12Packed = void (*)(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale);
+
+struct SIqConverterKernels
+{
+  TIqConvU8 pU8;
+  TIqConvI8 pI8;
+  TIqConvI16 pI16;
+  TIqConvI16Be pI16Be;
+  TIqConvI12Packed pI12Packed;
+  const char * pName;
+};
+
+// the single variants for the tests and benchmarks, only the ones of the target architecture exist
+extern const SIqConverterKernels cIqConverterKernelsScalar;
+#if defined(__x86_64__) || defined(_M_X64)
+extern const SIqConverterKernels cIqConverterKernelsSse41;
+extern const SIqConverterKernels cIqConverterKernelsAvx2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+extern const SIqConverterKernels cIqConverterKernelsNeon;
+#endif
+
+const SIqConverterKernels & get_iq_converter_kernels();
+
+inline void convert_iq_u8(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iOffset, f32 iScale)
+{
+  get_iq_converter_kernels().pU8(ipIQ, opV, iNumSamples, iOffset, iScale);
+}
+
+inline void convert_iq_i8(const i8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale)
+{
+  get_iq_converter_kernels().pI8(ipIQ, opV, iNumSamples, iScale);
+}
+
+inline void convert_iq_i16(const i16 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale)
+{
+  get_iq_converter_kernels().pI16(ipIQ, opV, iNumSamples, iScale);
+}
+
+inline void convert_iq_i16_be(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale)
+{
+  get_iq_converter_kernels().pI16Be(ipIQ, opV, iNumSamples, iScale);
+}
+
+inline void convert_iq_i12_packed(const u8 * ipIQ, cf32 * opV, i32 iNumSamples, f32 iScale)
+{
+  get_iq_converter_kernels().pI12Packed(ipIQ, opV, iNumSamples, iScale);
+}
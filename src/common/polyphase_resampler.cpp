@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "polyphase_resampler.h"
+#include "cpu_features.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <QDebug>
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  #include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define TARGET_AVX2  __attribute__((target("avx2")))
+#else
+  #define TARGET_SSE41
+  #define TARGET_AVX2
+#endif
+
+/*
+ * Notes to the kernels:
+ * - As each tap is stored twice (once for I and once for Q) the interleaved input window is multiplied directly with
+ *   the taps, I and Q are only separated by the final horizontal sum.
+ * - K is a multiple of 4, so there are no remaining taps to handle.
+ * - The phase is stepped forward by M modulo L without a division, the input position by M / L plus the carry.
+ *   Only if L is approximated by fewer phases the phase has to be scaled to the filter bank (see get_taps()).
+ * - The AVX2 variant clears the upper register halves explicitly before it returns, the compiler does not insert this
+ *   reliably for functions with a target attribute.
+ */
+
+static inline void step_forward(const SResamplerParam & iParam, i32 & ioPos, i32 & ioPhase)
+{
+  ioPos += iParam.stepInt;
+  ioPhase += iParam.stepFrac;
+  if (ioPhase >= iParam.interp)
+  {
+    ioPhase -= iParam.interp;
+    ++ioPos;
+  }
+}
+
+static inline const f32 * get_taps(const SResamplerParam & iParam, const i32 iPhase)
+{
+  const i32 phase = (iParam.numPhases == iParam.interp ? iPhase : (i32)((i64)iPhase * iParam.numPhases / iParam.interp));
+  return iParam.pTapsIQ + 2 * iParam.numTaps * phase;
+}
+
+static i32 resample_scalar(const SResamplerParam & iParam, const cf32 * const ipX, const i32 iNumIn, i32 & ioPos, i32 & ioPhase, cf32 * const opOut)
+{
+  i32 numOut = 0;
+
+  while (ioPos < iNumIn)
+  {
+    const f32 * const pX = reinterpret_cast<const f32 *>(ipX + ioPos);
+    const f32 * const pT = get_taps(iParam, ioPhase);
+    f32 re = 0, im = 0;
+
+    for (i32 i = 0; i < 2 * iParam.numTaps; i += 2)
+    {
+      re += pX[i + 0] * pT[i + 0];
+      im += pX[i + 1] * pT[i + 1];
+    }
+    opOut[numOut++] = cf32(re, im);
+    step_forward(iParam, ioPos, ioPhase);
+  }
+  return numOut;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+TARGET_SSE41 static i32 resample_sse41(const SResamplerParam & iParam, const cf32 * const ipX, const i32 iNumIn, i32 & ioPos, i32 & ioPhase, cf32 * const opOut)
+{
+  i32 numOut = 0;
+
+  while (ioPos < iNumIn)
+  {
+    const f32 * const pX = reinterpret_cast<const f32 *>(ipX + ioPos);
+    const f32 * const pT = get_taps(iParam, ioPhase);
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+
+    for (i32 i = 0; i < 2 * iParam.numTaps; i += 8)
+    {
+      acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(pX + i + 0), _mm_loadu_ps(pT + i + 0)));
+      acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(pX + i + 4), _mm_loadu_ps(pT + i + 4)));
+    }
+    const __m128 acc = _mm_add_ps(acc0, acc1);  // re0 im0 re1 im1
+    _mm_storel_pi(reinterpret_cast<__m64 *>(opOut + numOut++), _mm_add_ps(acc, _mm_movehl_ps(acc, acc)));
+    step_forward(iParam, ioPos, ioPhase);
+  }
+  return numOut;
+}
+
+TARGET_AVX2 static i32 resample_avx2(const SResamplerParam & iParam, const cf32 * const ipX, const i32 iNumIn, i32 & ioPos, i32 & ioPhase, cf32 * const opOut)
+{
+  const i32 numVal = 2 * iParam.numTaps;
+  i32 numOut = 0;
+
+  while (ioPos < iNumIn)
+  {
+    const f32 * const pX = reinterpret_cast<const f32 *>(ipX + ioPos);
+    const f32 * const pT = get_taps(iParam, ioPhase);
+    __m256 acc0 = _mm256_mul_ps(_mm256_loadu_ps(pX), _mm256_loadu_ps(pT));
+    __m256 acc1 = _mm256_setzero_ps();
+    i32 i = 8;
+
+    for (; i + 16 <= numVal; i += 16)
+    {
+      acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(pX + i + 0), _mm256_loadu_ps(pT + i + 0)));
+      acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(pX + i + 8), _mm256_loadu_ps(pT + i + 8)));
+    }
+    if (i < numVal)
+    {
+      acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(pX + i), _mm256_loadu_ps(pT + i)));
+    }
+    const __m256 acc = _mm256_add_ps(acc0, acc1);
+    const __m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)); // re0 im0 re1 im1
+    _mm_storel_pi(reinterpret_cast<__m64 *>(opOut + numOut++), _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4)));
+    step_forward(iParam, ioPos, ioPhase);
+  }
+  _mm256_zeroupper();
+  return numOut;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+static i32 resample_neon(const SResamplerParam & iParam, const cf32 * const ipX, const i32 iNumIn, i32 & ioPos, i32 & ioPhase, cf32 * const opOut)
+{
+  i32 numOut = 0;
+
+  while (ioPos < iNumIn)
+  {
+    const f32 * const pX = reinterpret_cast<const f32 *>(ipX + ioPos);
+    const f32 * const pT = get_taps(iParam, ioPhase);
+    float32x4_t acc0 = vdupq_n_f32(0);
+    float32x4_t acc1 = vdupq_n_f32(0);
+
+    for (i32 i = 0; i < 2 * iParam.numTaps; i += 8)
+    {
+      acc0 = vmlaq_f32(acc0, vld1q_f32(pX + i + 0), vld1q_f32(pT + i + 0));
+      acc1 = vmlaq_f32(acc1, vld1q_f32(pX + i + 4), vld1q_f32(pT + i + 4));
+    }
+    const float32x4_t acc = vaddq_f32(acc0, acc1); // re0 im0 re1 im1
+    vst1_f32(reinterpret_cast<f32 *>(opOut + numOut++), vadd_f32(vget_low_f32(acc), vget_high_f32(acc)));
+    step_forward(iParam, ioPos, ioPhase);
+  }
+  return numOut;
+}
+
+#endif
+
+struct SResamplerKernel
+{
+  TResamplerKernel pFunc;
+  const char * pName;
+};
+
+static const SResamplerKernel & get_resampler_kernel()
+{
+  static const SResamplerKernel kernel = []() -> SResamplerKernel
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (CpuFeatures::has_avx2()) return { resample_avx2, "AVX2" };
+    if (CpuFeatures::has_sse41()) return { resample_sse41, "SSE4.1" };
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    if (CpuFeatures::has_neon()) return { resample_neon, "NEON" };
+#endif
+    return { resample_scalar, "Scalar" };
+  }();
+  return kernel;
+}
+
+// modified Bessel function of the first kind and order 0 (for the Kaiser window)
+static f64 bessel_i0(const f64 iX)
+{
+  f64 sum = 1.0;
+  f64 term = 1.0;
+
+  for (i32 k = 1; k < 50 && term > 1e-12 * sum; ++k)
+  {
+    const f64 t = iX / (2.0 * k);
+    term *= t * t;
+    sum += term;
+  }
+  return sum;
+}
+
+PolyphaseResampler::PolyphaseResampler(const i32 iInputRate, const i32 iOutputRate, const f32 iPassBandHz, const f32 iStopBandAttDb)
+{
+  const i32 gcd = std::gcd(iInputRate, iOutputRate);
+
+  mInterp = iOutputRate / gcd;
+  mDecim = iInputRate / gcd;
+  mNumPhases = std::min(mInterp, cMaxInterpolation);
+  _design_filter(iInputRate, iOutputRate, iPassBandHz, iStopBandAttDb);
+  mWorkBuffer.resize(mNumTaps - 1 + cMaxBlockSize);
+  mKernel = get_resampler_kernel().pFunc;
+
+  qInfo("Using %s for resampling %d -> %d S/s (L = %d, M = %d, %d phases with %d taps)",
+        get_resampler_kernel().pName, iInputRate, iOutputRate, mInterp, mDecim, mNumPhases, mNumTaps);
+}
+
+void PolyphaseResampler::_design_filter(const i32 iInputRate, const i32 iOutputRate, const f32 iPassBandHz, const f32 iStopBandAttDb)
+{
+  const f64 minRate = std::min(iInputRate, iOutputRate);
+  const f64 passBand = std::min<f64>(iPassBandHz, 0.45 * minRate);
+  const f64 stopBand = std::max<f64>(minRate - passBand, 0.55 * minRate);
+  const f64 protoRate = (f64)iInputRate * mNumPhases;
+  const f64 att = std::max<f64>(iStopBandAttDb, 21.0);
+
+  // length and shape parameter of the Kaiser window for the given transition band and stopband attenuation
+  const f64 deltaOmega = 2.0 * M_PI * (stopBand - passBand) / protoRate;
+  const i32 protoLen = (i32)std::ceil((att - 8.0) / (2.285 * deltaOmega)) + 1;
+  const f64 beta = (att > 50.0 ? 0.1102 * (att - 8.7) : 0.5842 * std::pow(att - 21.0, 0.4) + 0.07886 * (att - 21.0));
+
+  mNumTaps = ((protoLen + mNumPhases - 1) / mNumPhases + 3) & ~3;
+  const i32 numProto = mNumTaps * mNumPhases;
+  const f64 center = 0.5 * (numProto - 1);
+  const f64 fc = 0.5 * (passBand + stopBand) / protoRate; // normalized to the prototype rate
+  std::vector<f64> proto(numProto);
+  f64 sum = 0;
+
+  for (i32 n = 0; n < numProto; ++n)
+  {
+    const f64 t = n - center;
+    const f64 sinc = (t == 0.0 ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t));
+    const f64 r = 2.0 * t / (numProto - 1);
+    proto[n] = sinc * bessel_i0(beta * std::sqrt(std::max<f64>(0.0, 1.0 - r * r)));
+    sum += proto[n];
+  }
+
+  // the interpolation by L (zero stuffing) needs a DC gain of L, each phase has a gain of about 1
+  mTapsIQ.resize(2 * numProto);
+  for (i32 p = 0; p < mNumPhases; ++p)
+  {
+    for (i32 j = 0; j < mNumTaps; ++j)
+    {
+      const f32 tap = (f32)(proto[p + (mNumTaps - 1 - j) * mNumPhases] * mNumPhases / sum);
+      mTapsIQ[2 * (p * mNumTaps + j) + 0] = tap;
+      mTapsIQ[2 * (p * mNumTaps + j) + 1] = tap;
+    }
+  }
+}
+
+void PolyphaseResampler::reset()
+{
+  mPos = 0;
+  mPhase = 0;
+  std::fill(mWorkBuffer.begin(), mWorkBuffer.begin() + mNumTaps - 1, cf32(0, 0));
+}
+
+i32 PolyphaseResampler::process(const cf32 * ipIn, i32 iNumIn, cf32 * const opOut)
+{
+  const i32 numHist = mNumTaps - 1;
+  const SResamplerParam param{ mTapsIQ.data(), mNumTaps, mNumPhases, mInterp, mDecim / mInterp, mDecim % mInterp };
+  i32 numOut = 0;
+
+  while (iNumIn > 0)
+  {
+    const i32 numIn = std::min(iNumIn, cMaxBlockSize);
+    std::copy(ipIn, ipIn + numIn, mWorkBuffer.begin() + numHist);
+
+    numOut += mKernel(param, mWorkBuffer.data(), numIn, mPos, mPhase, opOut + numOut);
+
+    // keep the last K - 1 samples as history for the next block
+    std::copy(mWorkBuffer.begin() + numIn, mWorkBuffer.begin() + numIn + numHist, mWorkBuffer.begin());
+    mPos -= numIn;
+    ipIn += numIn;
+    iNumIn -= numIn;
+  }
+  return numOut;
+}
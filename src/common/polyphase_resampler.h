@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+/*
+ * Polyphase rational resampler for the devices and files which do not deliver 2.048 MS/s.
+ * The rate is changed by L/M (L = interpolation, M = decimation, both are the rates divided by their gcd). The prototype
+ * lowpass is a Kaiser windowed sinc at L times the input rate with the given passband and stopband attenuation, the
+ * stopband starts at (lower rate - passband), so all aliases fall outside the passband. It is split into L subfilters
+ * (phases) with K taps each, every output sample is one inner product of the last K input samples with one phase.
+ * The scalar, SSE4.1, AVX2 and NEON (AArch64) variants of the inner product are compiled in, the best one is chosen
+ * at runtime (they differ only in the summation order).
+ * If L is higher than cMaxInterpolation (odd rates) the filter bank gets only cMaxInterpolation phases. The output times
+ * are still counted exactly in 1/L input samples and the next lower phase is taken, so the output rate has no drift.
+ * What remains is a timing jitter of less than 1/cMaxInterpolation input samples, an error below -60 dB in the passband.
+ */
+#include "glob_defs.h"
+#include <vector>
+
+struct SResamplerParam
+{
+  const f32 * pTapsIQ;  // numPhases phases with K taps each, reversed and each tap stored twice (for I and Q)
+  i32 numTaps;          // K, a multiple of 4
+  i32 numPhases;        // L, or cMaxInterpolation if L is higher
+  i32 interp;           // L, the phase counts the time between two input samples in 1/L
+  i32 stepInt;          // M / L, the input samples to step forward per output sample
+  i32 stepFrac;         // M % L
+};
+
+// ipX holds K - 1 history samples followed by iNumIn new samples, returns the number of samples written to opOut,
+// ioPos (start of the next input window in ipX) and ioPhase are continued by the next call
+using TResamplerKernel = i32 (*)(const SResamplerParam & iParam, const cf32 * ipX, i32 iNumIn, i32 & ioPos, i32 & ioPhase, cf32 * opOut);
+
+class PolyphaseResampler
+{
+public:
+  static constexpr f32 cDefaultPassBandHz = 0.5f * (f32)(cK * cCarrDiff + 2 * 35000); // half the DAB bandwidth incl. some margin
+  static constexpr f32 cDefaultStopBandAttDb = 60.0f;
+  static constexpr i32 cMaxInterpolation = 2048; // max. number of phases, a higher L is approximated (see above)
+  static constexpr i32 cMaxBlockSize = 8192;     // longer input blocks are processed in parts of this size
+
+  PolyphaseResampler(i32 iInputRate, i32 iOutputRate, f32 iPassBandHz = cDefaultPassBandHz, f32 iStopBandAttDb = cDefaultStopBandAttDb);
+  ~PolyphaseResampler() = default;
+
+  // resamples the iNumIn samples of ipIn to opOut and returns the number of output samples, opOut must be able to take
+  // get_max_output_size(iNumIn) samples, the state is kept between calls so the block size is arbitrary
+  i32 process(const cf32 * ipIn, i32 iNumIn, cf32 * opOut);
+  [[nodiscard]] i32 get_max_output_size(i32 iNumIn) const { return (i32)(((i64)iNumIn * mInterp) / mDecim) + 2; }
+  void reset();
+
+  [[nodiscard]] i32 get_interpolation() const { return mInterp; }
+  [[nodiscard]] i32 get_decimation() const { return mDecim; }
+  [[nodiscard]] i32 get_num_phases() const { return mNumPhases; }
+  [[nodiscard]] i32 get_num_taps_per_phase() const { return mNumTaps; }
+
+private:
+  i32 mInterp = 1;
+  i32 mDecim = 1;
+  i32 mNumPhases = 1;
+  i32 mNumTaps = 4;
+  i32 mPos = 0;
+  i32 mPhase = 0;
+  std::vector<f32> mTapsIQ;
+  std::vector<cf32> mWorkBuffer; // K - 1 history samples followed by the current block (max. cMaxBlockSize samples)
+  TResamplerKernel mKernel;
+
+  void _design_filter(i32 iInputRate, i32 iOutputRate, f32 iPassBandHz, f32 iStopBandAttDb);
+};
@@ -76,6 +76,8 @@
 #pragma once
 
 #include "glob_defs.h"
+#include "asymmetric_fence.h"
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <vector>
@@ -83,63 +85,10 @@
 #include <cassert>
 #include <map>
 #include <memory>
-
-#ifdef __APPLE__
-#include <libkern/OSAtomic.h>
-#ifdef OSATOMIC_DEPRECATED
-#include <atomic>
-#endif
-#
-/* Mac OS X only provides
-   full memory barriers, so the three types of barriers are the same,
-   however, these barriers are superior to compiler-based ones. */
-
-inline void Apple_MemoryBarrier() {
-#ifdef OSATOMIC_DEPRECATED
-std::atomic_thread_fence(std::memory_order_seq_cst);
-#else
-OSMemoryBarrier();
-#endif
-}
-#   define PaUtil_FullMemoryBarrier()  Apple_MemoryBarrier()
-#   define PaUtil_ReadMemoryBarrier()  Apple_MemoryBarrier()
-#   define PaUtil_WriteMemoryBarrier() Apple_MemoryBarrier()
-#elif defined(__GNUC__)
-/* GCC >= 4.1 has built-in intrinsics. We'll use those */
-#   if (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)
-# define PaUtil_FullMemoryBarrier()  __sync_synchronize()
-# define PaUtil_ReadMemoryBarrier()  __sync_synchronize()
-# define PaUtil_WriteMemoryBarrier() __sync_synchronize()
-/* as a fallback, GCC understands volatile asm and "memory" to mean it
- * should not reorder memory read/writes */
-#   elif defined( __PPC__ )
-#      define PaUtil_FullMemoryBarrier()  asm volatile("sync":::"memory")
-#      define PaUtil_ReadMemoryBarrier()  asm volatile("sync":::"memory")
-#      define PaUtil_WriteMemoryBarrier() asm volatile("sync":::"memory")
-#   elif defined( __i386__ ) || defined( __i486__ ) || defined( __i586__ ) || defined( __i686__ ) || defined( __x86_64__ )
-#      define PaUtil_FullMemoryBarrier()  asm volatile("mfence":::"memory")
-#      define PaUtil_ReadMemoryBarrier()  asm volatile("lfence":::"memory")
-#      define PaUtil_WriteMemoryBarrier() asm volatile("sfence":::"memory")
-#   else
-#      ifdef ALLOW_SMP_DANGERS
-#         warning Memory barriers not defined on this system or system unknown
-#         warning For SMP safety, you should fix this.
-#         define PaUtil_FullMemoryBarrier()
-#         define PaUtil_ReadMemoryBarrier()
-#         define PaUtil_WriteMemoryBarrier()
-#      else
-#         error Memory barriers are not defined on this system. You can still compile by defining ALLOW_SMP_DANGERS, but SMP safety will not be guaranteed.
-#      endif
-#   endif
-#else
-#   ifdef ALLOW_SMP_DANGERS
-#      define PaUtil_FullMemoryBarrier()
-#      define PaUtil_ReadMemoryBarrier()
-#      define PaUtil_WriteMemoryBarrier()
-#   else
-#      error Memory barriers are not defined on this system. You can still compile by defining ALLOW_SMP_DANGERS, but SMP safety will not be guaranteed.
-#   endif
-#endif
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <climits>
 
 class RingbufferBase
 {
@@ -153,10 +102,26 @@ public:
   };
 };
 
+// Single producer / single consumer ring buffer. The indices are std::atomic: the consumer reads the write index with
+// acquire (sees the data written before) and the producer reads the read index with acquire (the consumer has finished
+// copying out before a slot is reused), the index updates are the corresponding release operations.
+// A blocking wait works like an eventcount: the waiting side publishes its threshold (which also tells that it waits),
+// the other side checks it after each index update and only then takes the mutex and notifies. The store-then-load
+// ordering this needs is done with asymmetric fences, so the index updates (fast path) only pay a compiler barrier and
+// the expensive part of the fence is done by the thread which is about to sleep anyway (slow path).
 template<class TElem>
 class RingBuffer : public RingbufferBase
 {
 public:
+  // readable data in place in the ring memory, the second segment is only used if the data wraps around the buffer end
+  struct SReadSegments
+  {
+    std::array<const TElem *, 2> pData;
+    std::array<i32, 2> size;
+
+    [[nodiscard]] i32 total() const { return size[0] + size[1]; }
+  };
+
   explicit RingBuffer(const u32 elementCount)
   {
     bufferSize = _round_up_to_next_power_of_2(elementCount);
@@ -169,7 +134,7 @@ public:
 
   [[nodiscard]] i32 get_ring_buffer_read_available() const
   {
-    return (writeIndex - readIndex) & bigMask;
+    return (writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire)) & bigMask;
   }
 
   [[nodiscard]] i32 get_ring_buffer_write_available() const
@@ -198,23 +163,82 @@ public:
     readIndex = 0;
   }
 
-  /* ensure that previous writes are seen before we update the write index
-     (write after write)
+  /* the written data is released with the new write index, the light fence keeps the following check of
+     waitThreshold after the store (pairs with the heavy fence of a reader starting to wait in between)
    */
   i32 advance_ring_buffer_write_index(i32 elementCount)
   {
-    PaUtil_WriteMemoryBarrier();
-    return writeIndex = (writeIndex + elementCount) & bigMask;
+    const i32 newWriteIndex = (writeIndex.load(std::memory_order_relaxed) + elementCount) & bigMask;
+    writeIndex.store(newWriteIndex, std::memory_order_release);
+    AsymmetricFence::light();
+
+    // wake up a waiting reader only if its threshold is reached, so the producer does not pay for a notify with each block
+    if (const i32 threshold = waitThreshold.load(std::memory_order_relaxed);
+        threshold != INT_MAX && get_ring_buffer_read_available() >= threshold)
+    {
+      std::lock_guard<std::mutex> lock(waitMutex);
+      waitCondVar.notify_one();
+    }
+    return newWriteIndex;
   }
 
-  /* ensure that previous reads (copies out of the ring buffer) are
-   * always completed before updating (writing) the read index.
-   * (write-after-read) => full barrier
+  /* Blocks the (single) reader until at least iElemCnt elements are available or the timeout elapsed.
+     Returns the number of available elements, which is less than iElemCnt in case of a timeout.
+   */
+  i32 wait_for_read_available(const i32 iElemCnt, const std::chrono::milliseconds iTimeout)
+  {
+    i32 available = get_ring_buffer_read_available();
+
+    if (available >= iElemCnt)
+    {
+      return available;
+    }
+
+    std::unique_lock<std::mutex> lock(waitMutex);
+    waitThreshold.store(iElemCnt, std::memory_order_relaxed); // the writer checks the threshold after updating the write index, so no wake-up can get lost
+    AsymmetricFence::heavy(); // pairs with the light fence after the write index update, the predicate below reads it afterwards
+    waitCondVar.wait_for(lock, iTimeout, [&] { return (available = get_ring_buffer_read_available()) >= iElemCnt; });
+    waitThreshold.store(INT_MAX, std::memory_order_relaxed);
+    return available;
+  }
+
+  /* the copies out of the ring buffer are completed (released) before the slots are given back with the new read index,
+     the light fence for the same reason as in advance_ring_buffer_write_index()
    */
   i32 advance_ring_buffer_read_index(i32 elementCount)
   {
-    PaUtil_FullMemoryBarrier();
-    return readIndex = (readIndex + elementCount) & bigMask;
+    const i32 newReadIndex = (readIndex.load(std::memory_order_relaxed) + elementCount) & bigMask;
+    readIndex.store(newReadIndex, std::memory_order_release);
+    AsymmetricFence::light();
+
+    // same for a waiting writer (e.g. a file reader which is only paced by the consumer)
+    if (const i32 threshold = writerWaitThreshold.load(std::memory_order_relaxed);
+        threshold != INT_MAX && get_ring_buffer_write_available() >= threshold)
+    {
+      std::lock_guard<std::mutex> lock(waitMutex);
+      writerWaitCondVar.notify_one();
+    }
+    return newReadIndex;
+  }
+
+  /* Blocks the (single) writer until at least iElemCnt elements are free or the timeout elapsed.
+     Returns the number of free elements, which is less than iElemCnt in case of a timeout.
+   */
+  i32 wait_for_write_available(const i32 iElemCnt, const std::chrono::milliseconds iTimeout)
+  {
+    i32 available = get_ring_buffer_write_available();
+
+    if (available >= iElemCnt)
+    {
+      return available;
+    }
+
+    std::unique_lock<std::mutex> lock(waitMutex);
+    writerWaitThreshold.store(iElemCnt, std::memory_order_relaxed);
+    AsymmetricFence::heavy(); // pairs with the light fence after the read index update
+    writerWaitCondVar.wait_for(lock, iTimeout, [&] { return (available = get_ring_buffer_write_available()) >= iElemCnt; });
+    writerWaitThreshold.store(INT_MAX, std::memory_order_relaxed);
+    return available;
   }
 
   i32 put_data_into_ring_buffer(const void * data, i32 elementCount)
@@ -265,10 +289,28 @@ public:
     return numRead;
   }
 
+  /* Zero-copy read: returns up to iElemCnt readable elements as (one or two) segments of the ring memory.
+     The data can be processed in place, it stays valid until it is released with commit_read().
+   */
+  SReadSegments peek_read(const i32 iElemCnt)
+  {
+    SReadSegments s;
+    void * pData1;
+    void * pData2;
+    _get_ring_buffer_read_regions((u32)std::max(iElemCnt, 0), &pData1, &s.size[0], &pData2, &s.size[1]);
+    s.pData[0] = static_cast<const TElem *>(pData1);
+    s.pData[1] = static_cast<const TElem *>(pData2);
+    return s;
+  }
+
+  // releases iElemCnt elements (usually SReadSegments::total()) of the last peek_read()
+  void commit_read(const i32 iElemCnt)
+  {
+    advance_ring_buffer_read_index(iElemCnt);
+  }
+
   u32 skip_data_in_ring_buffer(u32 n_values)
   {
-    //	ensure that we have the correct read and write indices
-    PaUtil_FullMemoryBarrier();
     if ((i32)n_values > get_ring_buffer_read_available())
     {
       n_values = get_ring_buffer_read_available();
@@ -288,6 +330,11 @@ private:
   u32 bufferSize;
   std::atomic<u32> writeIndex{ 0 };
   std::atomic<u32> readIndex{ 0 };
+  std::atomic<i32> waitThreshold{ INT_MAX }; // number of elements a waiting reader needs, INT_MAX if nobody waits (the waiter count of the eventcount)
+  std::mutex waitMutex;
+  std::condition_variable waitCondVar;
+  std::atomic<i32> writerWaitThreshold{ INT_MAX }; // number of free elements a waiting writer needs, INT_MAX if nobody waits
+  std::condition_variable writerWaitCondVar;
   u32 bigMask;
   u32 smallMask;
   std::vector<char> buffer;
@@ -309,7 +356,7 @@ private:
 
     /* Check to see if write is not contiguous. */
 
-    if (const u32 index = writeIndex & smallMask;
+    if (const u32 index = writeIndex.load(std::memory_order_relaxed) & smallMask;
         index + elementCount > bufferSize)
     {
       /* Write data in two blocks that wrap the buffer. */
@@ -327,12 +374,7 @@ private:
       *sizePtr2 = 0;
     }
 
-    if (available > 0)
-    {
-      PaUtil_FullMemoryBarrier(); /* (write-after-read) => full barrier */
-    }
-
-    return (i32)elementCount;
+    return (i32)elementCount; // the acquire load of readIndex (in available) ensures the consumer is done with these slots
   }
 
   /***************************************************************************
@@ -343,7 +385,7 @@ private:
    */
   i32 _get_ring_buffer_read_regions(u32 elementCount, void ** dataPtr1, i32 * sizePtr1, void ** dataPtr2, i32 * sizePtr2)
   {
-    const u32 available = get_ring_buffer_read_available(); /* doesn't use memory barrier */
+    const u32 available = get_ring_buffer_read_available();
 
     if (elementCount > available)
     {
@@ -352,7 +394,7 @@ private:
 
     /* Check to see if read is not contiguous. */
 
-    if (const u32 index = readIndex & smallMask;
+    if (const u32 index = readIndex.load(std::memory_order_relaxed) & smallMask;
         index + elementCount > bufferSize)
     {
       /* Write data in two blocks that wrap the buffer. */
@@ -370,12 +412,7 @@ private:
       *sizePtr2 = 0;
     }
 
-    if (available > 0)
-    {
-      PaUtil_ReadMemoryBarrier(); /* (read-after-read) => read barrier */
-    }
-
-    return (i32)elementCount;
+    return (i32)elementCount; // the acquire load of writeIndex (in available) ensures the data is visible
   }
 
   [[nodiscard]] u32 _round_up_to_next_power_of_2(u32 iVal) const
@@ -71,6 +71,8 @@ CATEGORY_BEGIN_NEW_NAME(Config, "Configuration")  // provide the name "Configura
   DEFINE_VARIANT(Config, varLongitude, 0)
   DEFINE_WIDGET(Config, cbCloseDirect)
   DEFINE_WIDGET(Config, cbUseStrongestPeak)
+  DEFINE_WIDGET(Config, cbUseFusedOfdmKernel)
+  DEFINE_WIDGET(Config, cbDecodeFullMultiplex)
   DEFINE_WIDGET(Config, cbUseNativeFileDialog)
   DEFINE_WIDGET(Config, cbUseNativeIqFormat)
   DEFINE_WIDGET(Config, cbUseUtcTime)
@@ -82,7 +82,7 @@ void XmlFileWriter::computeHeader()
 #define BLOCK_SIZE 8192
 static i16 buffer_int16[BLOCK_SIZE];
 static i32 bufferP_int16 = 0;
-void XmlFileWriter::add(std::complex<i16> * data, i32 count)
+void XmlFileWriter::add(const std::complex<i16> * data, i32 count)
 {
   for (i32 i = 0; i < count; i++)
   {
@@ -99,7 +99,7 @@ void XmlFileWriter::add(std::complex<i16> * data, i32 count)
 
 static u8 buffer_uint8[BLOCK_SIZE];
 static i32 bufferP_uint8 = 0;
-void XmlFileWriter::add(std::complex<u8> * data, i32 count)
+void XmlFileWriter::add(const std::complex<u8> * data, i32 count)
 {
   for (i32 i = 0; i < count; i++)
   {
@@ -116,7 +116,7 @@ void XmlFileWriter::add(std::complex<u8> * data, i32 count)
 
 static i8 buffer_int8[BLOCK_SIZE];
 static i32 bufferP_int8 = 0;
-void XmlFileWriter::add(std::complex<i8> * data, i32 count)
+void XmlFileWriter::add(const std::complex<i8> * data, i32 count)
 {
   for (i32 i = 0; i < count; i++)
   {
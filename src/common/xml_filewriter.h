@@ -55,9 +55,9 @@ public:
                 QString,
                 QString);
   ~XmlFileWriter();
-  void add(std::complex<i16> *, i32);
-  void add(std::complex<u8> *, i32);
-  void add(std::complex<i8> *, i32);
+  void add(const std::complex<i16> *, i32);
+  void add(const std::complex<u8> *, i32);
+  void add(const std::complex<i8> *, i32);
   void computeHeader();
 private:
   i32 nrBits;
@@ -18,6 +18,7 @@
 #include "airspy_handler.h"
 #include "dongleselect.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
 
@@ -144,19 +145,8 @@ AirspyHandler::AirspyHandler(QSettings *s, QString recorderVersion):
        throw(std_exception_string(my_airspy_error_name ((enum airspy_error)result)));
     }
 
-
-//  The sizes of the mapTables follow from the input and output rate
-//  (selectedRate / 1000) vs (2048000 / 1000)
-//  so we end up with buffers with 1 msec content
-    convBufferSize      = selectedRate / 1000;
-    for (i = 0; i < 2048; i ++)
-    {
-       f32 inVal    = f32 (selectedRate / 1000);
-       mapTable_int [i] = i32 (floor (i * (inVal / 2048.0)));
-       mapTable_float [i]   = i * (inVal / 2048.0) - mapTable_int [i];
-    }
-    convIndex   = 0;
-    convBuffer.resize (convBufferSize + 1);
+//  the airspy samplerates (2.5, 3, 6 or 10 MS/s) always need a resampling
+    resampler = std::make_unique<PolyphaseResampler> (selectedRate, INPUT_RATE);
 //
     restore_gainSettings (tab);
     connect (linearitySlider, SIGNAL (valueChanged (int)),
@@ -346,17 +336,17 @@ i32 AirspyHandler::callback (airspy_transfer* transfer)
 
 //  called from AIRSPY data callback
 //  2*2 = 4 bytes for sample, as per AirSpy USB data stream format
-//  we do the rate conversion here, read in groups of 2 * xxx samples
-//  and transform them into groups of 2 * 512 samples
+//  we do the rate conversion here, the whole transfer at once
 i32     AirspyHandler::data_available (void *buf, i32 buf_size)
 {
     i16 *sbuf   = (i16 *)buf;
     i32 nSamples    = buf_size / (sizeof (i16) * 2);
-    cf32 temp [2048];
-    i32  i, j;
 
     if (dumping.load ())
        xmlWriter->add ((std::complex<i16> *)sbuf, nSamples);
+    if ((i32)iqBuffer.size () < nSamples)
+       iqBuffer.resize (nSamples);
+    convert_iq_i16 (sbuf, iqBuffer.data (), nSamples, 1.0f / 2048.0f);
     if (filtering)
     {
        if (filterDepth->value () != currentDepth)
@@ -368,56 +358,12 @@ i32     AirspyHandler::data_available (void *buf, i32 buf_size)
           currentDepth = filterDepth->value ();
           theFilter->resize (currentDepth);
        }
-       for (i = 0; i < nSamples; i ++)
-       {
-          convBuffer [convIndex ++] = theFilter->Pass (
-                                         cf32 (
-                                            sbuf [2 * i] / (f32)2048,
-                                            sbuf [2 * i + 1] / (f32)2048)
-                                         );
-          if (convIndex > convBufferSize)
-          {
-             for (j = 0; j < 2048; j ++)
-             {
-                i16  inpBase    = mapTable_int [j];
-                f32    inpRatio = mapTable_float [j];
-                temp [j]    = convBuffer [inpBase + 1] * inpRatio +
-                            convBuffer [inpBase] * (1 - inpRatio);
-             }
-
-             _I_Buffer.put_data_into_ring_buffer (temp, 2048);
-//
-//  shift the sample at the end to the beginning, it is needed
-//  as the starting sample for the next time
-             convBuffer [0] = convBuffer [convBufferSize];
-             convIndex = 1;
-          }
-       }
-    }
-    else
-    for (i = 0; i < nSamples; i ++)
-    {
-       convBuffer [convIndex ++] = cf32 (
-                                         sbuf [2 * i] / (f32)2048,
-                                         sbuf [2 * i + 1] / (f32)2048);
-       if (convIndex > convBufferSize)
-       {
-          for (j = 0; j < 2048; j ++)
-          {
-             i16  inpBase   = mapTable_int [j];
-             f32    inpRatio    = mapTable_float [j];
-             temp [j]   = convBuffer [inpBase + 1] * inpRatio +
-                      convBuffer [inpBase] * (1 - inpRatio);
-          }
-
-          _I_Buffer.put_data_into_ring_buffer (temp, 2048);
-//
-//  shift the sample at the end to the beginning, it is needed
-//  as the starting sample for the next time
-          convBuffer [0] = convBuffer [convBufferSize];
-          convIndex = 1;
-       }
+       theFilter->process (iqBuffer.data (), iqBuffer.data (), nSamples);
     }
+    if ((i32)resampBuffer.size () < resampler->get_max_output_size (nSamples))
+       resampBuffer.resize (resampler->get_max_output_size (nSamples));
+    const i32 nOut = resampler->process (iqBuffer.data (), nSamples, resampBuffer.data ());
+    _I_Buffer.put_data_into_ring_buffer (resampBuffer.data (), nOut);
     return 0;
 }
 //
@@ -473,6 +419,11 @@ i32 AirspyHandler::Samples      () {
     return _I_Buffer.get_ring_buffer_read_available();
 }
 
+i32 AirspyHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+    return _I_Buffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 const char* AirspyHandler::board_id_name()
 {
     u8 bid;
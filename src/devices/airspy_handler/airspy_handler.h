@@ -30,9 +30,11 @@
 #include <QLibrary>
 #include <vector>
 #include <atomic>
+#include <memory>
 #include "dab_constants.h"
 #include "ringbuffer.h"
 #include "fir_filters.h"
+#include "polyphase_resampler.h"
 #include "device_handler_if.h"
 #include "ui_airspy_widget.h"
 #include "libairspy/airspy.h"
@@ -80,6 +82,7 @@ public:
   void stopReader() override;
   i32 getSamples(cf32 * v, i32 size) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   void resetBuffer() override;
   void show() override;
   void hide() override;
@@ -162,11 +165,9 @@ private:
   i16 mixerGain;
   i16 lnaGain;
   i32 selectedRate;
-  i16 convBufferSize;
-  i16 convIndex;
-  std::vector<cf32> convBuffer;
-  i16 mapTable_int[4 * 512];
-  f32 mapTable_float[4 * 512];
+  std::vector<cf32> iqBuffer;   // the converted samples of one transfer
+  std::vector<cf32> resampBuffer;
+  std::unique_ptr<PolyphaseResampler> resampler;
   QSettings * airspySettings;
   i32 inputRate;
   struct airspy_device * device;
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#pragma once
+
+#include "dab_constants.h"
+#include <chrono>
+#include <QString>
+
+// Counts the samples a file reader has put into the device ring buffer (at INPUT_RATE) and relates them to the
+// elapsed wall clock time. In "max speed" mode the readers are only paced by the DabProcessor, so the realtime
+// factor shows how much faster than realtime the decoder chain is able to work.
+class FileReaderThroughput
+{
+public:
+  void start()
+  {
+    mNumSamples = 0;
+    mStartTime = std::chrono::steady_clock::now();
+  }
+
+  void add_samples(const i64 iNumSamples)
+  {
+    mNumSamples += iNumSamples;
+  }
+
+  [[nodiscard]] QString get_report(const bool iMaxSpeed) const
+  {
+    const f64 elapsed_s = std::chrono::duration<f64>(std::chrono::steady_clock::now() - mStartTime).count();
+
+    if (elapsed_s <= 0.0 || mNumSamples == 0)
+    {
+      return "no samples processed";
+    }
+
+    const f64 samplesPerSec = (f64)mNumSamples / elapsed_s;
+    return QString("%1 samples in %2 s (%3 mode): %4 MSamples/s, realtime factor %5")
+             .arg(mNumSamples)
+             .arg(elapsed_s, 0, 'f', 1)
+             .arg(iMaxSpeed ? "max speed" : "realtime")
+             .arg(samplesPerSec / 1e6, 0, 'f', 3)
+             .arg(samplesPerSec / INPUT_RATE, 0, 'f', 2);
+  }
+
+private:
+  i64 mNumSamples = 0;
+  std::chrono::steady_clock::time_point mStartTime = std::chrono::steady_clock::now();
+};
@@ -22,6 +22,7 @@ public:
   QLCDNumber * lcdSampleRate = nullptr;
   QSpacerItem * spacerHorizontal2 = nullptr ;
   QCheckBox * cbLoopFile = nullptr;
+  QCheckBox * cbMaxSpeed = nullptr;
   QLabel * lblFormatText = nullptr;
   QLabel * lblFormat = nullptr;
 
@@ -61,6 +62,10 @@ public:
     spacerHorizontal2 = new QSpacerItem(0, 0, QSizePolicy::Policy::Expanding, QSizePolicy::Policy::Minimum);
     cbLoopFile = new QCheckBox("Loop");
     cbLoopFile->setChecked(true);
+    cbMaxSpeed = new QCheckBox("Max speed");
+    cbMaxSpeed->setChecked(false);
+    cbMaxSpeed->setToolTip("Do not pace the file to realtime, provide the samples as fast as the decoder consumes them.\n"
+                           "The throughput and realtime factor is logged when the playback stops.");
     lblFormatText = new QLabel("Format: ");
     lblFormat = new QLabel();
 
@@ -69,6 +74,7 @@ public:
     timebar->addWidget(lblSeconds);
     timebar->addWidget(lcdTotalTime);
     timebar->addItem(spacerHorizontal1);
+    timebar->addWidget(cbMaxSpeed);
     timebar->addWidget(cbLoopFile);
 
     QHBoxLayout * bottom = new QHBoxLayout();
@@ -31,6 +31,7 @@
 
 #include "raw_reader.h"
 #include "rawfiles.h"
+#include "iq_converter.h"
 #include <QLoggingCategory>
 #include <sys/time.h>
 #include <cinttypes>
@@ -59,15 +60,10 @@ RawReader::RawReader(RawFileHandler * ipRFH, FILE * ipFile, RingBuffer<cf32> * i
   qCInfo(sLogRawReader) << "RAW file length:" << mFileLength;
   fseek(ipFile, 0, SEEK_SET);
   continuous.store(ipRFH->cbLoopFile->isChecked());
+  mMaxSpeed.store(ipRFH->cbMaxSpeed->isChecked());
 
   mByteBuffer.resize(cBufferSize);
   mCmplxBuffer.resize(cBufferSize / 2);
-
-  for(i32 i = 0; i < 256; i++)
-  {
-    // the offset 127.38f is due to the input data comes usually from a SDR stick which has its DC offset a bit shifted from ideal (from old-dab)
-    mMapTable[i] = ((f32)i - 127.38f) / 128.0f;
-  }
 }
 
 RawReader::~RawReader()
@@ -115,12 +111,13 @@ void RawReader::run()
 
   i32 cnt = 0;
   i64 nextStop_us = get_cur_time_in_us();
+  mThroughput.start();
 
   while (mRunning.load())
   {
-    while (mRunning.load() && mpRingBuffer->get_ring_buffer_write_available() < cBufferSize + 10) // why that 10
+    // backpressure: wait until the DabProcessor has made room for a new block (this alone paces the max speed mode)
+    while (mRunning.load() && mpRingBuffer->wait_for_write_available(cBufferSize + 10, std::chrono::milliseconds(100)) < cBufferSize + 10) // why that 10
     {
-      usleep(1000);  // use minimum 1000us as Windows will ignore smaller values
     }
 
     if (mSetNewFilePos >= 0)
@@ -152,20 +149,22 @@ void RawReader::run()
 
     nextStop_us += (n * 1000) / (2 * 2048); // add runtime in us for n numbers of entries
 
-    for (i32 i = 0; i < n / 2; i++)
-    {
-      mCmplxBuffer[i] = cf32(mMapTable[mByteBuffer[2 * i + 0]], mMapTable[mByteBuffer[2 * i + 1]]);
-    }
+    convert_iq_u8(mByteBuffer.data(), mCmplxBuffer.data(), n / 2, cRtlSdrIqOffset, cRtlSdrIqScale);
 
     mpRingBuffer->put_data_into_ring_buffer(mCmplxBuffer.data(), n / 2);
+    mThroughput.add_samples(n / 2);
 
-    if (nextStop_us - get_cur_time_in_us() > 0)
+    if (mMaxSpeed.load())
+    {
+      nextStop_us = get_cur_time_in_us(); // continue in realtime from now on if the max speed mode gets switched off
+    }
+    else if (nextStop_us - get_cur_time_in_us() > 0)
     {
       usleep(nextStop_us - get_cur_time_in_us());
     }
   }
 
-  qCInfo(sLogRawReader) << "Playing RAW file stopped";
+  qCInfo(sLogRawReader) << "Playing RAW file stopped," << mThroughput.get_report(mMaxSpeed.load());
 }
 
 bool RawReader::handle_continuous_button()
@@ -174,3 +173,8 @@ bool RawReader::handle_continuous_button()
   return continuous.load();
 }
 
+void RawReader::set_max_speed(const bool iMaxSpeed)
+{
+  mMaxSpeed.store(iMaxSpeed);
+}
+
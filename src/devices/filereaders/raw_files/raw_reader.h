@@ -33,6 +33,7 @@
 #include <QThread>
 #include "dab_constants.h"
 #include "ringbuffer.h"
+#include "filereader_throughput.h"
 #include <atomic>
 
 class RawFileHandler;
@@ -49,6 +50,7 @@ public:
   void stop_reader();
   void jump_to_relative_position_per_mill(i32 iPerMill);
   bool handle_continuous_button();
+  void set_max_speed(bool iMaxSpeed);
 
 private:
   static constexpr i32 cBufferSize = 32768;
@@ -60,12 +62,13 @@ private:
   RawFileHandler * const mParent;
   std::atomic<bool> mRunning = false;
   std::atomic<bool> continuous = false;
+  std::atomic<bool> mMaxSpeed = false;
   std::atomic<i64> mSetNewFilePos = -1;
   i64 mFileLength = 0;
 
-  std::array<f32, 256> mMapTable;
   std::vector<u8> mByteBuffer;
   std::vector<cf32> mCmplxBuffer;
+  FileReaderThroughput mThroughput;
 
 signals:
   void signal_set_progress(i32, f32);
@@ -82,6 +82,7 @@ RawFileHandler::RawFileHandler(const QString & iFilename)
   lblFormat->setText("u8");
 
   connect(cbLoopFile, &QCheckBox::clicked, this, &RawFileHandler::slot_handle_cb_loop_file);
+  connect(cbMaxSpeed, &QCheckBox::clicked, this, &RawFileHandler::slot_handle_cb_max_speed);
   connect(sliderFilePos, &QSlider::sliderPressed, this, &RawFileHandler::slot_slider_pressed);
   connect(sliderFilePos, &QSlider::sliderReleased, this, &RawFileHandler::slot_slider_released);
   connect(sliderFilePos, &QSlider::sliderMoved, this, &RawFileHandler::slot_slider_moved);
@@ -156,6 +157,11 @@ i32 RawFileHandler::Samples()
   return mRingBuffer.get_ring_buffer_read_available();
 }
 
+i32 RawFileHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return mRingBuffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void RawFileHandler::show()
 {
   mFrame.show();
@@ -205,6 +211,14 @@ void RawFileHandler::slot_handle_cb_loop_file(const bool iChecked)
   cbLoopFile->setChecked(mpRawReader->handle_continuous_button());
 }
 
+void RawFileHandler::slot_handle_cb_max_speed(const bool iChecked)
+{
+  if (mpRawReader != nullptr)
+  {
+    mpRawReader->set_max_speed(iChecked);
+  }
+}
+
 void RawFileHandler::slot_set_progress(const i32 progress, const f32 timelength)
 {
   if (mSliderMovementPos < 0) // suppress slider update while mouse move on slider
@@ -55,6 +55,7 @@ public:
 
   i32 getSamples(cf32 *, i32) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   bool restartReader(i32) override;
   void stopReader() override;
   void show() override;
@@ -82,6 +83,7 @@ private:
 public slots:
   void slot_set_progress(i32, f32);
   void slot_handle_cb_loop_file(bool iChecked);
+  void slot_handle_cb_max_speed(bool iChecked);
   void slot_slider_pressed();
   void slot_slider_released();
   void slot_slider_moved(i32);
@@ -50,38 +50,14 @@ WavReader::WavReader(WavFileHandler * ipWavFH, SNDFILE * ipFile, RingBuffer<cf32
   mFileLength = sf_seek(ipFile, 0, SEEK_END);
   sf_seek(ipFile, 0, SEEK_SET);
   mContinuous.store(ipWavFH->cbLoopFile->isChecked());
+  mMaxSpeed.store(ipWavFH->cbMaxSpeed->isChecked());
   mCmplxBuffer.resize(cBufferSize);
 
   if (mSampleRate != INPUT_RATE)
   {
-#ifdef HAVE_LIQUID
-    const float resampRatio = (float)INPUT_RATE / (float)mSampleRate;
-    constexpr u32 filterLen = 13;
-    constexpr float resampBw = 0.5f * (float)(cK * cCarrDiff + 2*35000) / (float)INPUT_RATE;
-    constexpr float sideLopeSuppr = 40.0f;
-    constexpr u32 numFiltersInBank = 32;
-    mLiquidResampler = resamp_crcf_create(resampRatio, filterLen, resampBw, sideLopeSuppr, numFiltersInBank);
-    resamp_crcf_print(mLiquidResampler);
-
-    mResampBuffer.resize(mCmplxBuffer.size() * resampRatio + 10); // add some exaggerated samples
-#else
-    // we process chunks of 1 msec
-    mConvBufferSize = (i16)(mSampleRate / 1000);
-    mConvBuffer.resize(mConvBufferSize + 1);
-    mResampBuffer.resize(2048);
-    mMapTable_int.resize(2048);
-    mMapTable_float.resize(2048);
-
-    for (i32 i = 0; i < 2048; i++)
-    {
-      const f32 inVal = (f32)mSampleRate / 1000.0f;
-      mMapTable_int[i] = (i16)(std::floor((f32)i * (inVal / 2048.0f)));
-      mMapTable_float[i] = (f32)i * (inVal / 2048.0f) - (f32)mMapTable_int[i];
-      //qDebug() << i << mMapTable_int[i] << mMapTable_float[i];
-    }
-    mConvIndex = 0;
-#endif
-
+    mResampler = std::make_unique<PolyphaseResampler>(mSampleRate, INPUT_RATE);
+    mBlockOutSize = mResampler->get_max_output_size(cBufferSize);
+    mResampBuffer.resize(mBlockOutSize);
   }
 
   mPeriod_us = 32768LL * 1'000'000LL/*us*/ / mSampleRate;  // full IQs read
@@ -91,12 +67,6 @@ WavReader::WavReader(WavFileHandler * ipWavFH, SNDFILE * ipFile, RingBuffer<cf32
 WavReader::~WavReader()
 {
   stop_reader();
-#ifdef HAVE_LIQUID
-  if (mSampleRate != INPUT_RATE)
-  {
-    resamp_crcf_destroy(mLiquidResampler);
-  }
-#endif
 }
 
 void WavReader::start_reader()
@@ -137,12 +107,13 @@ void WavReader::run()
 
   i32 cnt = 0;
   i64 nextStop_us = getMyTime();
+  mThroughput.start();
 
   while (mRunning.load())
   {
-    while (mRunning.load() && mpRingBuffer->get_ring_buffer_write_available() < cBufferSize)
+    // backpressure: wait until the DabProcessor has made room for a new block (this alone paces the max speed mode)
+    while (mRunning.load() && mpRingBuffer->wait_for_write_available(mBlockOutSize, std::chrono::milliseconds(100)) < mBlockOutSize)
     {
-      usleep(1000);  // use minimum 1000us as Windows will ignore smaller values
     }
 
     if (mSetNewFilePos >= 0)
@@ -179,45 +150,29 @@ void WavReader::run()
       emit signal_file_looped();
     }
 
-    if (mSampleRate != INPUT_RATE)
+    if (mResampler)
     {
-#ifdef HAVE_LIQUID
-      u32 usedResultSamples = 0;
-      resamp_crcf_execute_block(mLiquidResampler, mCmplxBuffer.data(), mCmplxBuffer.size(), mResampBuffer.data(), &usedResultSamples);
-      assert(usedResultSamples <= mResampBuffer.size());
-      mpRingBuffer->put_data_into_ring_buffer(mResampBuffer.data(), usedResultSamples);
-#else
-      for (u32 i = 0; i < cBufferSize; ++i)
-      {
-        mConvBuffer[mConvIndex++] = mCmplxBuffer[i];
-
-        if (mConvIndex > mConvBufferSize)
-        {
-          for (i32 j = 0; j < 2048; j++)
-          {
-            const i16 inpBase = mMapTable_int[j];
-            const f32 inpRatio = mMapTable_float[j];
-            mResampBuffer[j] = mConvBuffer[inpBase + 1] * inpRatio + mConvBuffer[inpBase] * (1 - inpRatio);
-          }
-          mpRingBuffer->put_data_into_ring_buffer(mResampBuffer.data(), 2048);
-          mConvBuffer[0] = mConvBuffer[mConvBufferSize];
-          mConvIndex = 1;
-        }
-      }
-#endif
+      const i32 numOut = mResampler->process(mCmplxBuffer.data(), cBufferSize, mResampBuffer.data());
+      mpRingBuffer->put_data_into_ring_buffer(mResampBuffer.data(), numOut);
+      mThroughput.add_samples(numOut);
     }
     else
     {
       mpRingBuffer->put_data_into_ring_buffer(mCmplxBuffer.data(), cBufferSize);
+      mThroughput.add_samples(cBufferSize);
     }
 
-    if (nextStop_us - getMyTime() > 0)
+    if (mMaxSpeed.load())
+    {
+      nextStop_us = getMyTime(); // continue in realtime from now on if the max speed mode gets switched off
+    }
+    else if (nextStop_us - getMyTime() > 0)
     {
       usleep(nextStop_us - getMyTime());
     }
   }
 
-  qInfo("Task for replay ended");
+  qInfo() << "Task for replay ended," << mThroughput.get_report(mMaxSpeed.load());
 }
 
 bool WavReader::handle_continuous_button()
@@ -226,3 +181,8 @@ bool WavReader::handle_continuous_button()
   return mContinuous.load();
 }
 
+void WavReader::set_max_speed(const bool iMaxSpeed)
+{
+  mMaxSpeed.store(iMaxSpeed);
+}
+
@@ -34,10 +34,10 @@
 #include	<sndfile.h>
 #include	"dab_constants.h"
 #include	"ringbuffer.h"
+#include	"filereader_throughput.h"
+#include	"polyphase_resampler.h"
 #include	<atomic>
-#ifdef HAVE_LIQUID
-  #include <liquid/liquid.h>
-#endif
+#include	<memory>
 
 class WavFileHandler;
 
@@ -53,6 +53,7 @@ public:
   void stop_reader();
   void jump_to_relative_position_per_mill(i32 iPerMill);
   bool handle_continuous_button();
+  void set_max_speed(bool iMaxSpeed);
 
 private:
   static constexpr i32 cBufferSize = 32768;
@@ -63,21 +64,15 @@ private:
   const i32 mSampleRate;
   std::atomic<bool> mRunning = false;
   std::atomic<bool> mContinuous = false;
+  std::atomic<bool> mMaxSpeed = false;
   std::atomic<i64> mSetNewFilePos = -1;
   i64 mFileLength = 0;
   i64 mPeriod_us = 0;
+  i32 mBlockOutSize = cBufferSize; // max. number of (resampled) samples one file block puts into the ring buffer
+  FileReaderThroughput mThroughput;
   std::vector<cf32> mCmplxBuffer;
   std::vector<cf32> mResampBuffer;
-
-#ifdef HAVE_LIQUID
-  resamp_crcf mLiquidResampler = nullptr;
-#else
-  i16 mConvBufferSize;
-  i16 mConvIndex = 0;
-  std::vector<cf32> mConvBuffer;
-  std::vector<i16> mMapTable_int;
-  std::vector<f32> mMapTable_float;
-#endif
+  std::unique_ptr<PolyphaseResampler> mResampler;
 
   void run() override;
 
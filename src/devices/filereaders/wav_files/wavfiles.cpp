@@ -105,6 +105,7 @@ WavFileHandler::WavFileHandler(const QString & iFilename)
   lcdTotalTime->display(QString("%1").arg((f32)fileLength / (f32)mSampleRate, 0, 'f', 1));
 
   connect(cbLoopFile, &QCheckBox::clicked, this, &WavFileHandler::slot_handle_cb_loop_file);
+  connect(cbMaxSpeed, &QCheckBox::clicked, this, &WavFileHandler::slot_handle_cb_max_speed);
   connect(sliderFilePos, &QSlider::sliderPressed, this, &WavFileHandler::slot_slider_pressed);
   connect(sliderFilePos, &QSlider::sliderReleased, this, &WavFileHandler::slot_slider_released);
   connect(sliderFilePos, &QSlider::sliderMoved, this, &WavFileHandler::slot_slider_moved);
@@ -179,6 +180,11 @@ i32 WavFileHandler::Samples()
   return mRingBuffer.get_ring_buffer_read_available();
 }
 
+i32 WavFileHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return mRingBuffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void WavFileHandler::show()
 {
   mFrame.show();
@@ -228,6 +234,14 @@ void WavFileHandler::slot_handle_cb_loop_file(const bool iChecked)
   cbLoopFile->setChecked(mpWavReader->handle_continuous_button());
 }
 
+void WavFileHandler::slot_handle_cb_max_speed(const bool iChecked)
+{
+  if (mpWavReader != nullptr)
+  {
+    mpWavReader->set_max_speed(iChecked);
+  }
+}
+
 void WavFileHandler::slot_set_progress(const i32 progress, const f32 timelength) const
 {
   if (mSliderMovementPos < 0) // suppress slider update while mouse move on slider
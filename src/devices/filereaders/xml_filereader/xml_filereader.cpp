@@ -127,6 +127,7 @@ XmlFileReader::XmlFileReader(const QString & iFilename)
   qDebug() << "startPoint =" << startPoint;
 
   connect(cbLoopFile, &QCheckBox::clicked, this, &XmlFileReader::slot_handle_cb_loop_file);
+  connect(cbMaxSpeed, &QCheckBox::clicked, this, &XmlFileReader::slot_handle_cb_max_speed);
   connect(sliderFilePos, &QSlider::sliderPressed, this, &XmlFileReader::slot_slider_pressed);
   connect(sliderFilePos, &QSlider::sliderReleased, this, &XmlFileReader::slot_slider_released);
   connect(sliderFilePos, &QSlider::sliderMoved, this, &XmlFileReader::slot_slider_moved);
@@ -210,6 +211,12 @@ i32 XmlFileReader::Samples()
   return _I_Buffer.get_ring_buffer_read_available();
 }
 
+i32 XmlFileReader::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  const i32 available = _I_Buffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+  return theFile == nullptr ? 0 : available;
+}
+
 void XmlFileReader::slot_set_progress(i64 samplesRead, i64 samplesToRead)
 {
   if (mSliderMovementPos < 0) // suppress slider update while mouse move on slider
@@ -234,6 +241,14 @@ void XmlFileReader::slot_handle_cb_loop_file(const bool /*iChecked*/)
   cbLoopFile->setChecked(theReader->handle_continuousButton());
 }
 
+void XmlFileReader::slot_handle_cb_max_speed(const bool iChecked)
+{
+  if (theReader != nullptr)
+  {
+    theReader->set_max_speed(iChecked);
+  }
+}
+
 void XmlFileReader::show()
 {
   myFrame.show();
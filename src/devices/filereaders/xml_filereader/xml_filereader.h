@@ -53,6 +53,7 @@ public:
 
   i32 getSamples(cf32 *, i32) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   bool restartReader(i32) override;
   void stopReader() override;
   void setVFOFrequency(i32) override;
@@ -86,6 +87,7 @@ private:
 public slots:
   void slot_set_progress(i64, i64);
   void slot_handle_cb_loop_file(const bool iChecked);
+  void slot_handle_cb_max_speed(const bool iChecked);
   void slot_slider_pressed();
   void slot_slider_released();
   void slot_slider_moved(i32);
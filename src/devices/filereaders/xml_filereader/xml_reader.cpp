@@ -31,6 +31,7 @@
 #include "xml_reader.h"
 #include "xml_descriptor.h"
 #include "xml_filereader.h"
+#include "iq_converter.h"
 #include <cstdio>
 #include <sys/time.h>
 
@@ -66,29 +67,17 @@ XmlReader::XmlReader(XmlFileReader * mr, FILE * f, XmlDescriptor * fd, u32 fileP
   this->filePointer = filePointer;
   sampleBuffer = b;
   continuous.store(mr->cbLoopFile->isChecked());
+  mMaxSpeed.store(mr->cbMaxSpeed->isChecked());
+
+  // we read chunks of 1 msec
+  convBufferSize = fd->sampleRate / 1000;
+  convBuffer.resize(convBufferSize);
 
   if (fd->sampleRate != INPUT_RATE)
   {
-#ifdef HAVE_LIQUID
-    const float resampRatio = (float)INPUT_RATE / (float)fd->sampleRate;
-    constexpr u32 filterLen = 13;
-    constexpr float resampBw = 0.5f * (float)(cK * cCarrDiff + 2*35000) / (float)INPUT_RATE;
-    constexpr float sideLopeSuppr = 40.0f;
-    constexpr u32 numFiltersInBank = 32;
-    mLiquidResampler = resamp_crcf_create(resampRatio, filterLen, resampBw, sideLopeSuppr, numFiltersInBank);
-    resamp_crcf_print(mLiquidResampler);
-#else
-    for (i32 i = 0; i < 2048; i++)
-    {
-      const f32 inVal = f32(fd->sampleRate / 1000);
-      mapTable_int[i] = (i16)(std::floor(i * (inVal / 2048.0)));
-      mapTable_float[i] = i * (inVal / 2048.0f) - mapTable_int[i];
-    }
-#endif
+    mResampler = std::make_unique<PolyphaseResampler>(fd->sampleRate, INPUT_RATE);
+    mResampBuffer.resize(mResampler->get_max_output_size(convBufferSize));
   }
-  // convBufferSize is a little confusing since the actual buffer is one larger
-  convBufferSize = fd->sampleRate / 1000;
-  convBuffer.resize(convBufferSize + 1);
 
   for(i32 i = 0; i < 256; i++)
   {
@@ -112,12 +101,6 @@ XmlReader::~XmlReader()
     usleep(1000);
   }
   mSetNewFilePos = -1;
-#ifdef HAVE_LIQUID
-  if (fd->sampleRate != INPUT_RATE)
-  {
-    resamp_crcf_destroy(mLiquidResampler);
-  }
-#endif
 }
 
 void XmlReader::stopReader()
@@ -151,6 +134,7 @@ void XmlReader::run()
   running.store(true);
   fseek(file, filePointer, SEEK_SET);
   nextStop = currentTime();
+  mThroughput.start();
   qDebug() << "samples to read" << parent->samplesToRead;
   do
   {
@@ -158,6 +142,11 @@ void XmlReader::run()
     samplesReadToUpdate = 0;
     while ((samplesRead <= parent->samplesToRead) && running.load())
     {
+      // backpressure: wait until the DabProcessor has made room for the next 1 msec (this alone paces the max speed mode)
+      if (sampleBuffer->wait_for_write_available(2048 + 10, std::chrono::milliseconds(100)) < 2048 + 10)
+      {
+        continue;
+      }
 
       if (fd->iqOrder == "IQ")
       {
@@ -195,7 +184,11 @@ void XmlReader::run()
 
       // the readSamples function returns 1 msec of data, we assume taking this data does not take time
       nextStop = nextStop + (u64)1000;
-      if (nextStop > currentTime())
+      if (mMaxSpeed.load())
+      {
+        nextStop = currentTime(); // continue in realtime from now on if the max speed mode gets switched off
+      }
+      else if (nextStop > currentTime())
       {
         usleep(nextStop - currentTime());
       }
@@ -209,6 +202,8 @@ void XmlReader::run()
     fseek(file, filePointer, SEEK_SET);
   }
   while (running.load() && continuous.load());
+
+  qInfo() << "XML file reader stopped," << mThroughput.get_report(mMaxSpeed.load());
 }
 
 bool XmlReader::handle_continuousButton()
@@ -217,35 +212,24 @@ bool XmlReader::handle_continuousButton()
   return continuous.load();
 }
 
+void XmlReader::set_max_speed(const bool iMaxSpeed)
+{
+  mMaxSpeed.store(iMaxSpeed);
+}
+
 i32 XmlReader::readSamples(FILE * theFile, void(XmlReader::*r)(FILE * theFile, cf32 *, i32))
 {
-  (*this.*r)(theFile, &convBuffer[1], convBufferSize);
-  if (fd->sampleRate != INPUT_RATE)
+  (*this.*r)(theFile, convBuffer.data(), convBufferSize);
+  if (mResampler)
   {
-    std::array<cf32, 2048+10> ResampBuffer; // add some exaggerated samples
-#ifdef HAVE_LIQUID
-    u32 usedResultSamples = 0;
-    resamp_crcf_execute_block(mLiquidResampler, &convBuffer[1], convBufferSize, ResampBuffer.data(), &usedResultSamples);
-    if(usedResultSamples != 2048)
-    {
-      //fprintf(stderr, "convBufferSize=%d, usedResultSamples=%d\n", convBufferSize, usedResultSamples);
-      assert(usedResultSamples <= ResampBuffer.size());
-    }
-    sampleBuffer->put_data_into_ring_buffer(ResampBuffer.data(), usedResultSamples);
-#else
-    for (i32 i = 0; i < 2048; i++)
-    {
-      i16 inpBase = mapTable_int[i];
-      f32 inpRatio = mapTable_float[i];
-      ResampBuffer[i] = convBuffer[inpBase + 1] * inpRatio + convBuffer[inpBase] * (1.0f - inpRatio);
-    }
-    convBuffer[0] = convBuffer[convBufferSize];
-    sampleBuffer->put_data_into_ring_buffer(ResampBuffer.data(), 2048);
-#endif
+    const i32 numOut = mResampler->process(convBuffer.data(), convBufferSize, mResampBuffer.data());
+    sampleBuffer->put_data_into_ring_buffer(mResampBuffer.data(), numOut);
+    mThroughput.add_samples(numOut);
   }
   else
   {
-    sampleBuffer->put_data_into_ring_buffer(&convBuffer[1], 2048);
+    sampleBuffer->put_data_into_ring_buffer(convBuffer.data(), 2048);
+    mThroughput.add_samples(2048);
   }
   return convBufferSize;
 }
@@ -258,12 +242,9 @@ void XmlReader::readElements_IQ(FILE * theFile, cf32 * buffer, i32 amount)
 
   if (fd->container == "int8")
   {
-    auto * const lbuf = make_vla(u8, 2 * amount);
+    auto * const lbuf = make_vla(i8, 2 * amount);
     fread_chk(lbuf, 1, 2 * amount, theFile);
-    for (i32 i = 0; i < amount; i++)
-    {
-      buffer[i] = cf32(((i8)lbuf[2 * i]) / 127.0f, ((i8)lbuf[2 * i + 1]) / 127.0f);
-    }
+    convert_iq_i8(lbuf, buffer, amount, 1.0f / 127.0f);
     return;
   }
 
@@ -271,34 +252,21 @@ void XmlReader::readElements_IQ(FILE * theFile, cf32 * buffer, i32 amount)
   {
     auto * const lbuf = make_vla(u8, 2 * amount);
     fread_chk(lbuf, 1, 2 * amount, theFile);
-    for (i32 i = 0; i < amount; i++)
-    {
-      buffer[i] = cf32(mapTable[lbuf[2 * i]], mapTable[lbuf[2 * i + 1]]);
-    }
+    convert_iq_u8(lbuf, buffer, amount, cRtlSdrIqOffset, cRtlSdrIqScale);
     return;
   }
 
   if (fd->container == "int16")
   {
-    auto * const lbuf = make_vla(u8, 4 * amount);
+    auto * const lbuf = make_vla(i16, 2 * amount);
     fread_chk(lbuf, 2, 2 * amount, theFile);
     if (fd->byteOrder == "MSB")
     {
-      for (i32 i = 0; i < amount; i++)
-      {
-        i16 temp_16_1 = (lbuf[4 * i] << 8) | lbuf[4 * i + 1];
-        i16 temp_16_2 = (lbuf[4 * i + 2] << 8) | lbuf[4 * i + 3];
-        buffer[i] = cf32((f32)temp_16_1 / scaler, (f32)temp_16_2 / scaler);
-      }
+      convert_iq_i16_be(reinterpret_cast<const u8 *>(lbuf), buffer, amount, 1.0f / scaler);
     }
     else
     {
-      for (i32 i = 0; i < amount; i++)
-      {
-        i16 temp_16_1 = (lbuf[4 * i + 1] << 8) | lbuf[4 * i];
-        i16 temp_16_2 = (lbuf[4 * i + 3] << 8) | lbuf[4 * i + 2];
-        buffer[i] = cf32((f32)temp_16_1 / scaler, (f32)temp_16_2 / scaler);
-      }
+      convert_iq_i16(lbuf, buffer, amount, 1.0f / scaler); // LSB is the native byte order of all supported platforms
     }
     return;
   }
@@ -36,12 +36,12 @@
 #include <QMessageBox>
 #include <cstdio>
 #include "ringbuffer.h"
+#include "filereader_throughput.h"
+#include "polyphase_resampler.h"
 #include <stdint.h>
 #include <vector>
 #include <atomic>
-#ifdef HAVE_LIQUID
-  #include <liquid/liquid.h>
-#endif
+#include <memory>
 
 class XmlFileReader;
 class XmlDescriptor;
@@ -55,6 +55,7 @@ public:
   void stopReader();
   void jump_to_relative_position(i32 pos);
   bool handle_continuousButton();
+  void set_max_speed(bool iMaxSpeed);
 
 private:
   union UCnv // to avoid warnings "dereferencing type-punned pointer will break strict-aliasing rules"
@@ -64,6 +65,8 @@ private:
   };
 
   std::atomic<bool> continuous;
+  std::atomic<bool> mMaxSpeed = false;
+  FileReaderThroughput mThroughput;
   FILE * file;
   XmlDescriptor * fd;
   u32 filePointer;
@@ -80,12 +83,8 @@ private:
   f32 mapTable[256];
 
 // for the conversion - if any
-#ifdef HAVE_LIQUID
-  resamp_crcf mLiquidResampler = nullptr;
-#else
-  i16 mapTable_int[2048];
-  f32 mapTable_float[2048];
-#endif
+  std::unique_ptr<PolyphaseResampler> mResampler;
+  std::vector<cf32> mResampBuffer;
   i16 convBufferSize;
   std::vector<cf32> convBuffer;
 
@@ -40,6 +40,7 @@
 #include <QFileDialog>
 #include "hackrf_handler.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
 #include "qt_compat.h"
@@ -311,20 +312,24 @@ void HackRfHandler::stopReader()
 //  size still in I/Q pairs
 i32 HackRfHandler::getSamples(cf32 * V, i32 size)
 {
-  auto * const temp = make_vla(std::complex<i8>, size);
-  i32 amount = mRingBuffer.get_data_from_ring_buffer(temp, size);
+  // the samples are converted directly out of the ring buffer memory
+  const auto seg = mRingBuffer.peek_read(size);
 
-  for (i32 i = 0; i < amount; i++)
+  for (i32 s = 0; s < 2; s++)
   {
-    V[i] = cf32((f32)temp[i].real() / 127.0f, (f32)temp[i].imag() / 127.0f);
-  }
+    const std::complex<i8> * const temp = seg.pData[s];
 
-  if (mDumping.load())
-  {
-    mpXmlWriter->add(temp, amount);
+    convert_iq_i8(reinterpret_cast<const i8 *>(temp), V, seg.size[s], 1.0f / 127.0f);
+    V += seg.size[s];
+
+    if (mDumping.load())
+    {
+      mpXmlWriter->add(temp, seg.size[s]);
+    }
   }
 
-  return amount;
+  mRingBuffer.commit_read(seg.total());
+  return seg.total();
 }
 
 i32 HackRfHandler::Samples()
@@ -332,6 +337,11 @@ i32 HackRfHandler::Samples()
   return mRingBuffer.get_ring_buffer_read_available();
 }
 
+i32 HackRfHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return mRingBuffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void HackRfHandler::resetBuffer()
 {
   mRingBuffer.flush_ring_buffer();
@@ -23,6 +23,7 @@
 
 #include "lime_handler.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
 
@@ -270,26 +271,34 @@ void LimeHandler::stopReader()
 
 i32 LimeHandler::getSamples(cf32 *V, i32 size)
 {
-  std::complex<i16> *temp = make_vla(std::complex<i16>, size);
+  if (filtering && filterDepth->value() != currentDepth)
+  {
+    currentDepth = filterDepth->value ();
+    theFilter. resize (currentDepth);
+  }
+
+  // the samples are converted directly out of the ring buffer memory
+  const auto seg = _I_Buffer.peek_read(size);
 
-  i32 amount = _I_Buffer. get_data_from_ring_buffer(temp, size);
-  if (filtering)
+  for (i32 s = 0; s < 2; s++)
   {
-    if (filterDepth->value() != currentDepth)
+    const std::complex<i16> * const temp = seg.pData[s];
+
+    convert_iq_i16(reinterpret_cast<const i16 *>(temp), V, seg.size[s], 1.0f / 2048.0f);
+
+    if (filtering)
     {
-      currentDepth = filterDepth->value ();
-      theFilter. resize (currentDepth);
+      theFilter.process(V, V, seg.size[s]);
     }
-    for (i32 i = 0; i < amount; i ++)
-      V[i] = theFilter.Pass(cf32(real(temp[i]) / 2048.0, imag(temp[i]) / 2048.0));
+
+    if (dumping.load())
+      xmlWriter->add(temp, seg.size[s]);
+
+    V += seg.size[s];
   }
-  else
-    for (i32 i = 0; i < amount; i ++)
-      V[i] = cf32(real(temp[i]) / 2048.0, imag(temp[i]) / 2048.0);
 
-  if (dumping.load())
-    xmlWriter->add(temp, amount);
-  return amount;
+  _I_Buffer.commit_read(seg.total());
+  return seg.total();
 }
 
 i32 LimeHandler::Samples()
@@ -297,6 +306,11 @@ i32 LimeHandler::Samples()
   return _I_Buffer.get_ring_buffer_read_available();
 }
 
+i32 LimeHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return _I_Buffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void LimeHandler::resetBuffer()
 {
   _I_Buffer.flush_ring_buffer();
@@ -24,8 +24,11 @@
 #include <QDebug>
 #include "pluto_handler.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
+#include <algorithm>
+#include <cstring>
 
 //  Description for the fir-filter is here:
 #include "dabFilter.h"
@@ -204,15 +207,8 @@ PlutoHandler::PlutoHandler(QSettings *s,
              gainControl, SLOT (setValue (i32)));
     connect (this, SIGNAL (new_agcValue (bool)),
              agcControl, SLOT (setChecked (bool)));
-//  set up for interpolator
-    float   denominator = float (DAB_RATE) / DIVIDER;
-        float inVal     = float (PLUTO_RATE) / DIVIDER;
-    for (i32 i = 0; i < DAB_RATE / DIVIDER; i ++)
-    {
-       mapTable_int [i] = i32 (floor (i * (inVal / denominator)));
-       mapTable_float [i] = i * (inVal / denominator) - mapTable_int [i];
-    }
-    convIndex       = 0;
+//  set up for the resampler, we convert chunks of 1 msec
+    resampBuffer. resize (resampler. get_max_output_size (CONV_SIZE));
     dumping. store  (false);
     xmlDumper   = nullptr;
     running. store (false);
@@ -600,8 +596,6 @@ void    PlutoHandler::run()
     char    *p_end, *p_dat;
     i32 p_inc;
     //i32   nbytes_rx;
-    cf32 localBuf [DAB_RATE / DIVIDER];
-    std::complex<i16> dumpBuf [DAB_RATE / DIVIDER];
 
     state -> setText ("running");
     running. store (true);
@@ -610,32 +604,23 @@ void    PlutoHandler::run()
        /*nbytes_rx  =*/ iio_buffer_refill   (rxbuf);
        p_inc    = iio_buffer_step   (rxbuf);
        p_end    = (char *) iio_buffer_end  (rxbuf);
-
-       for (p_dat = (char *)iio_buffer_first (rxbuf, rx0_i);
-            p_dat < p_end; p_dat += p_inc)
+       p_dat    = (char *) iio_buffer_first (rxbuf, rx0_i);
+//
+//  with the two enabled channels the buffer contains interleaved
+//  i16 I/Q values (p_inc == 4), so they are dumped, converted
+//  and resampled in chunks of (up to) 1 msec
+       i32 nSamples = (i32)((p_end - p_dat) / p_inc);
+       while (nSamples > 0)
        {
-          const i16 i_p = ((i16 *)p_dat) [0];
-          const i16 q_p = ((i16 *)p_dat) [1];
-          std::complex<i16>dumpS = std::complex<i16> (i_p, q_p);
-          dumpBuf [convIndex] = dumpS;
-          cf32 sample = cf32 (i_p / 2048.0, q_p / 2048.0);
-          convBuffer [convIndex ++] = sample;
-          if (convIndex > CONV_SIZE)
-          {
-             if (dumping. load ())
-                xmlWriter -> add (dumpBuf, CONV_SIZE);
-             for (i32 j = 0; j < DAB_RATE / DIVIDER; j ++)
-             {
-                i16 inpBase = mapTable_int [j];
-                float   inpRatio    = mapTable_float [j];
-                localBuf [j]    = convBuffer [inpBase + 1] * inpRatio +
-                              convBuffer [inpBase] * (1 - inpRatio);
-             }
-             _I_Buffer. put_data_into_ring_buffer (localBuf,
-                                            DAB_RATE / DIVIDER);
-             convBuffer [0] = convBuffer [CONV_SIZE];
-             convIndex = 1;
-          }
+          const i32 n = std::min (nSamples, CONV_SIZE);
+          if (dumping. load ())
+             xmlWriter -> add ((const std::complex<i16> *)p_dat, n);
+          convert_iq_i16 ((const i16 *)p_dat, convBuffer, n, 1.0f / 2048.0f);
+          const i32 nOut = resampler. process (convBuffer, n,
+                                               resampBuffer. data ());
+          _I_Buffer. put_data_into_ring_buffer (resampBuffer. data (), nOut);
+          p_dat     += n * p_inc;
+          nSamples  -= n;
        }
     }
 }
@@ -652,6 +637,11 @@ i32 PlutoHandler::Samples ()
     return _I_Buffer. get_ring_buffer_read_available();
 }
 
+i32 PlutoHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+    return _I_Buffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 //  we know that the coefficients are loaded
 void    PlutoHandler::set_filter ()
 {
@@ -31,9 +31,11 @@
 #include <QSettings>
 #include <QLibrary>
 #include <atomic>
+#include <vector>
 #include <iio.h>
 #include "dab_constants.h"
 #include "ringbuffer.h"
+#include "polyphase_resampler.h"
 #include "device_handler_if.h"
 #include "ui_pluto_widget.h"
 
@@ -125,6 +127,7 @@ public:
     void    stopReader      ()  override;
     i32     getSamples      (cf32 *, i32)  override;
     i32     Samples         ()  override;
+    i32     wait_for_samples(i32, i32)  override;
     void    resetBuffer     ()  override;
     void    show            ()  override;
     void    hide            ()  override;
@@ -161,10 +164,9 @@ private:
     struct  iio_buffer  *rxbuf;
     struct  stream_cfg  rx_cfg;
     bool    connected;
-    cf32    convBuffer  [CONV_SIZE + 1];
-    i32     convIndex;
-    i16 mapTable_int    [DAB_RATE / DIVIDER];
-    float   mapTable_float  [DAB_RATE / DIVIDER];
+    cf32    convBuffer  [CONV_SIZE];
+    PolyphaseResampler  resampler {PLUTO_RATE, DAB_RATE};
+    std::vector<cf32>   resampBuffer;
 
     void    record_gainSettings (i32);
     void    update_gainSettings (i32);
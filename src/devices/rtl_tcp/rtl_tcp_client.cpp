@@ -35,6 +35,7 @@
 #include "rtl-sdr.h"
 #include "qt_compat.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
 #include "setting_helper.h"
@@ -64,11 +65,6 @@ RtlTcpClient::RtlTcpClient(QSettings * s, const QString & iRecorderVersion)
   , mpSettings(s)
   , mRecorderVersion(iRecorderVersion)
 {
-  for (i32 i = 0; i < 256; i++)
-  {
-    mMapTable[i] = ((f32)i - 127.38f) / 128.0f;
-  }
-
   setupUi(&mFrame);
 
   mFrame.setWindowFlag(Qt::Tool, true); // does not generate a task bar icon
@@ -287,6 +283,11 @@ i32 RtlTcpClient::Samples()
   return mpBuffer->get_ring_buffer_read_available();
 }
 
+i32 RtlTcpClient::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return mpBuffer->wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void RtlTcpClient::_slot_read_data()
 {
   if (!mDongleInfoReceived)
@@ -340,10 +341,7 @@ void RtlTcpClient::_slot_read_data()
 
       const i32 sampleCnt = (i32)(bytesRead / 2);
 
-      for (i32 i = 0; i < sampleCnt; i++)
-      {
-        complexBuffer[i] = cf32(mMapTable[byteBuffer[2 * i]], mMapTable[byteBuffer[2 * i + 1]]);
-      }
+      convert_iq_u8(byteBuffer.data(), complexBuffer.data(), sampleCnt, cRtlSdrIqOffset, cRtlSdrIqScale);
 
       const i32 storedCnt = mpBuffer->put_data_into_ring_buffer(complexBuffer.data(), sampleCnt);
       mTotalSampleCnt += (u64)sampleCnt;
@@ -54,6 +54,7 @@ public:
   void stopReader() override;
   i32 getSamples(cf32 * V, i32 size) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   void show() override;
   void hide() override;
   bool isHidden() override;
@@ -70,7 +71,6 @@ private:
 
   QFrame mFrame;
   QSettings * const mpSettings;
-  std::array<f32, 256> mMapTable;
   std::unique_ptr<RingBuffer<cf32>> mpBuffer;
   i32 mBitRate;
   i32 mVfoFrequency;
@@ -29,6 +29,7 @@
 #include "dongleselect.h"
 #include "rtl-sdr.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "device_exceptions.h"
 #include "openfiledialog.h"
 #include "qt_compat.h"
@@ -123,8 +124,6 @@ RtlSdrHandler::RtlSdrHandler(QSettings * ipSettings,
   QString temp;
   char manufac[256], product[256], serial[256];
 
-  for (i = 0; i < 256; i++)
-    mapTable[i] = ((f32)i - 127.38) / 128.0;
   rtlsdrSettings = ipSettings;
   this->recorderVersion = recorderVersion;
   rtlsdrSettings->beginGroup("rtlsdrSettings");
@@ -424,32 +423,37 @@ void RtlSdrHandler::set_ppmCorrection(f64 ppm)
 
 i32 RtlSdrHandler::getSamples(cf32 * V, i32 size)
 {
-  std::complex<u8> *temp = make_vla(std::complex<u8>, size);
-  i32 amount;
-
   if (!isActive.load())
     return 0;
 
-  amount = _I_Buffer.get_data_from_ring_buffer(temp, size);
-  //if(size > 1) fprintf(stderr, "get_data=%d\n", size);
-  if (filtering)
+  if (filtering && filterDepth->value() != currentDepth)
   {
-    if (filterDepth->value() != currentDepth)
+    currentDepth = filterDepth->value();
+    theFilter.resize(currentDepth);
+  }
+
+  // the samples are converted directly out of the ring buffer memory
+  const auto seg = _I_Buffer.peek_read(size);
+
+  for (i32 s = 0; s < 2; s++)
+  {
+    const std::complex<u8> * const temp = seg.pData[s];
+
+    convert_iq_u8(reinterpret_cast<const u8 *>(temp), V, seg.size[s], cRtlSdrIqOffset, cRtlSdrIqScale);
+
+    if (filtering)
     {
-      currentDepth = filterDepth->value();
-      theFilter.resize(currentDepth);
+      theFilter.process(V, V, seg.size[s]);
     }
-    for (i32 i = 0; i < amount; i++)
-      V[i] = theFilter.Pass(cf32(mapTable[real(temp[i]) & 0xFF],
-                                 mapTable[imag(temp[i]) & 0xFF]));
+
+    if (xml_dumping.load())
+      xmlWriter->add(temp, seg.size[s]);
+
+    V += seg.size[s];
   }
-  else
-    for (i32 i = 0; i < amount; i++)
-      V[i] = cf32(mapTable[real(temp[i]) & 0xFF],
-                  mapTable[imag(temp[i]) & 0xFF]);
-  if (xml_dumping.load())
-    xmlWriter->add(temp, amount);
-  return amount;
+
+  _I_Buffer.commit_read(seg.total());
+  return seg.total();
 }
 
 i32 RtlSdrHandler::Samples()
@@ -459,6 +463,12 @@ i32 RtlSdrHandler::Samples()
   return _I_Buffer.get_ring_buffer_read_available();
 }
 
+i32 RtlSdrHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  const i32 available = _I_Buffer.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+  return isActive.load() ? available : 0;
+}
+
 bool RtlSdrHandler::load_rtlFunctions(bool & oHasNewInterface)
 {
   oHasNewInterface = true; // is it a old-dab-style interface?
@@ -96,6 +96,7 @@ public:
   void stopReader() override;
   i32 getSamples(cf32 *, i32) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   void resetBuffer() override;
   QString deviceName() override;
   void show() override;
@@ -128,7 +129,6 @@ private:
   XmlFileWriter * xmlWriter;
   bool setup_xmlDump();
   std::atomic<bool> xml_dumping;
-  f32 mapTable[256];
   bool filtering;
   LowPassFIR theFilter;
   i32 currentDepth;
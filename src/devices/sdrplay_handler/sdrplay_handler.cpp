@@ -32,6 +32,7 @@
 #include "sdrplay_handler.h"
 #include "sdrplay_commands.h"
 #include "xml_filewriter.h"
+#include "iq_converter.h"
 #include "setting_helper.h"
 #include "qt_compat.h"
 
@@ -198,20 +199,24 @@ i32 SdrPlayHandler::getSamples(cf32 * V, i32 size)
 {
   static constexpr f32 denominator = (f32)(1 << (nrBits-1));
 
-  auto * const temp = make_vla(ci16, size);
+  // the samples are converted directly out of the ring buffer memory
+  const auto seg = p_I_Buffer->peek_read(size);
 
-  const i32 amount = p_I_Buffer->get_data_from_ring_buffer(temp, size);
-
-  for (i32 i = 0; i < amount; i++)
+  for (i32 s = 0; s < 2; s++)
   {
-    V[i] = cf32((f32)real(temp[i]) / denominator, (f32)imag(temp[i]) / denominator);
-  }
+    const ci16 * const temp = seg.pData[s];
 
-  if (dumping.load())
-  {
-    xmlWriter->add(temp, amount);
+    convert_iq_i16(reinterpret_cast<const i16 *>(temp), V, seg.size[s], 1.0f / denominator);
+    V += seg.size[s];
+
+    if (dumping.load())
+    {
+      xmlWriter->add(temp, seg.size[s]);
+    }
   }
-  return amount;
+
+  p_I_Buffer->commit_read(seg.total());
+  return seg.total();
 }
 
 i32 SdrPlayHandler::Samples()
@@ -219,6 +224,11 @@ i32 SdrPlayHandler::Samples()
   return p_I_Buffer->get_ring_buffer_read_available();
 }
 
+i32 SdrPlayHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return p_I_Buffer->wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void SdrPlayHandler::resetBuffer()
 {
   p_I_Buffer->flush_ring_buffer();
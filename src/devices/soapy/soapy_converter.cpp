@@ -32,31 +32,8 @@ SoapyConverter::SoapyConverter(SoapySDR::Device * device, SoapySDR::Stream *stre
 
   if (sampleRate != INPUT_RATE)
   {
-#ifdef HAVE_LIQUID
-    const float resampRatio = (float)INPUT_RATE / sampleRate;
-    constexpr u32 filterLen = 13;
-    constexpr float resampBw = 0.5f * (float)(cK * cCarrDiff + 2*35000) / (float)INPUT_RATE;
-    constexpr float sideLopeSuppr = 40.0f;
-    constexpr u32 numFiltersInBank = 32;
-    mLiquidResampler = resamp_crcf_create(resampRatio, filterLen, resampBw, sideLopeSuppr, numFiltersInBank);
-    resamp_crcf_print(mLiquidResampler);
-    mResampBuffer.resize(2048 + 10); // add some exaggerated samples
-#else
-    // we process chunks of 1 msec
-    mMapTable_int.resize(2048);
-    mMapTable_float.resize(2048);
-
-    for (i32 i = 0; i < 2048; i++)
-    {
-      const f32 inVal = (f32)sampleRate / 1000.0f;
-      mMapTable_int[i] = (i16)std::floor((f32)i * (inVal / 2048.0f));
-      mMapTable_float[i] = (f32)i * (inVal / 2048.0f) - (f32)mMapTable_int[i];
-    }
-    mConvIndex = 0;
-    mResampBuffer.resize(2048);
-#endif
-    mConvBufferSize = sampleRate / 1000;
-    mConvBuffer.resize(std::max(mConvBufferSize + 1, 4096));
+    mResampler = std::make_unique<PolyphaseResampler>(sampleRate, INPUT_RATE);
+    mResampBuffer.resize(mResampler->get_max_output_size(4096)); // 4096 is the max. read size in run()
   }
   start();
 }
@@ -70,12 +47,6 @@ SoapyConverter::~SoapyConverter(void)
   }
   theDevice->deactivateStream(stream);
   theDevice->closeStream(stream);
-#ifdef HAVE_LIQUID
-  if (sampleRate != INPUT_RATE)
-  {
-    resamp_crcf_destroy(mLiquidResampler);
-  }
-#endif
 }
 
 i32 SoapyConverter::Samples(void)
@@ -110,30 +81,9 @@ void SoapyConverter::run(void)
       }
       else
       {
-        for (i32 i = 0; i < numSamples; i++)
-        {
-          mConvBuffer[mConvIndex++] = buffer[i];
-          if (mConvIndex > mConvBufferSize)
-          {
-#ifdef HAVE_LIQUID
-            u32 usedResultSamples = 0;
-            resamp_crcf_execute_block(mLiquidResampler, mConvBuffer.data(), mConvBufferSize, mResampBuffer.data(), &usedResultSamples);
-            assert(usedResultSamples <= mResampBuffer.size());
-            theBuffer.put_data_into_ring_buffer(mResampBuffer.data(), (i32)usedResultSamples);
-#else
-            for (i32 j = 0; j < 2048; j++)
-            {
-              const i16 inpBase = mMapTable_int[j];
-              const f32 inpRatio = mMapTable_float[j];
-              mResampBuffer[j] = mConvBuffer[inpBase + 1] * inpRatio + mConvBuffer[inpBase] * (1 - inpRatio);
-            }
-            theBuffer.put_data_into_ring_buffer(mResampBuffer.data(), 2048);
-#endif
-            mConvBuffer[0] = mConvBuffer[mConvBufferSize];
-            mConvIndex = 1;
-          } //if (mConvIndex > mConvBufferSize)
-        } // for (i32 i = 0; i < numSamples; i++)
-      } // else
+        const i32 numOut = mResampler->process(buffer, numSamples, mResampBuffer.data());
+        theBuffer.put_data_into_ring_buffer(mResampBuffer.data(), numOut);
+      }
     } // if (nSamples > 0)
   } // while (running)
 }
@@ -23,9 +23,8 @@
 
 #include <SoapySDR/Device.hpp>
 #include "soapy_worker.h"
-#ifdef HAVE_LIQUID
-  #include <liquid/liquid.h>
-#endif
+#include "polyphase_resampler.h"
+#include <memory>
 
 class SoapyConverter: public soapyWorker
 {
@@ -43,14 +42,6 @@ private:
   int sampleRate;
 
   // for the conversion - if any
-  std::vector<cf32> mConvBuffer;
-  i16 mConvIndex = 0;
-  i16 mConvBufferSize = 0;
+  std::unique_ptr<PolyphaseResampler> mResampler;
   std::vector<cf32> mResampBuffer;
-#ifdef HAVE_LIQUID
-  resamp_crcf mLiquidResampler = nullptr;
-#else
-  std::vector<i16> mMapTable_int;
-  std::vector<f32> mMapTable_float;
-#endif
 };
@@ -41,6 +41,7 @@
 #include "spyserver_client.h"
 #include "dab_constants.h"
 #include "device_exceptions.h"
+#include "iq_converter.h"
 #include "setting_helper.h"
 #include "qt_compat.h"
 #include <iostream>
@@ -110,13 +111,6 @@ SpyServerClient::~SpyServerClient()
     mIsConnected = false;
   }
 
-#ifdef HAVE_LIQUID
-  if (mLiquidResampler != nullptr)
-  {
-    resamp_crcf_destroy(mLiquidResampler);
-  }
-#endif
-
   Settings::SpyServer::posAndSize.write_widget_geometry(&mFrame);
 }
 
@@ -340,36 +334,17 @@ bool SpyServerClient::_setup_connection()
   // fprintf(stderr, "The samplerate = %f\n", (f32)(theServer->get_sample_rate()));
 //  start ();       // start the reader
 
-//  Since we are down sampling, creating an outputbuffer with the
-//  same size as the input buffer is OK
+  // the samples of one batch are converted and resampled at once
+  mConvBuffer.resize(mSettings.batchSize);
 
   if (mSettings.resample_ratio != 1.0)
   {
-#ifdef HAVE_LIQUID
-    constexpr u32 filterLen = 13;
-    constexpr float resampBw = 0.5f * (float)(cK * cCarrDiff + 2*35000) / (float)INPUT_RATE;
-    constexpr float sideLopeSuppr = 40.0f;
-    constexpr u32 numFiltersInBank = 32;
-    mLiquidResampler = resamp_crcf_create(mSettings.resample_ratio, filterLen, resampBw, sideLopeSuppr, numFiltersInBank);
-    resamp_crcf_print(mLiquidResampler);
-    mResampBuffer.resize(2048 + 10); // add some exaggerated samples
-#else
-    // we process chunks of 1 msec
-    mMapTable_int.resize(2048);
-    mMapTable_float.resize(2048);
-
-    for (i32 i = 0; i < 2048; i++)
-    {
-      const f32 inVal = (f32)mSettings.sample_rate / 1000.0f;
-      mMapTable_int[i] = (i16)std::floor((f32)i * (inVal / 2048.0f));
-      mMapTable_float[i] = (f32)i * (inVal / 2048.0f) - (f32)mMapTable_int[i];
-    }
-    mConvIndex = 0;
-    mResampBuffer.resize(2048);
-#endif
-
-    mConvBufferSize = mSettings.sample_rate / 1000;
-    mConvBuffer.resize(std::max(mConvBufferSize + 1, mSettings.batchSize));
+    mResampler = std::make_unique<PolyphaseResampler>((i32)mSettings.sample_rate, INPUT_RATE);
+    mResampBuffer.resize(mResampler->get_max_output_size(mSettings.batchSize));
+  }
+  else
+  {
+    mResampler.reset();
   }
 
   return true;
@@ -438,6 +413,11 @@ i32 SpyServerClient::Samples()
   return mRingBuffer2.get_ring_buffer_read_available();
 }
 
+i32 SpyServerClient::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return mRingBuffer2.wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void SpyServerClient::_slot_handle_gain(i32 gain)
 {
   mSettings.gain = gain;
@@ -466,24 +446,6 @@ void SpyServerClient::_slot_handle_autogain(i32 d)
 //   onConnect.store(true);
 // }
 
-static constexpr std::array<const f32, 256> cConvTable =
-{
-  -128 / 128.0, -127 / 128.0, -126 / 128.0, -125 / 128.0, -124 / 128.0, -123 / 128.0, -122 / 128.0, -121 / 128.0, -120 / 128.0, -119 / 128.0, -118 / 128.0, -117 / 128.0, -116 / 128.0, -115 / 128.0, -114 / 128.0, -113 / 128.0, -112 / 128.0,
-  -111 / 128.0, -110 / 128.0, -109 / 128.0, -108 / 128.0, -107 / 128.0, -106 / 128.0, -105 / 128.0, -104 / 128.0, -103 / 128.0, -102 / 128.0, -101 / 128.0, -100 / 128.0, -99 / 128.0, -98 / 128.0, -97 / 128.0, -96 / 128.0, -95 / 128.0,
-  -94 / 128.0, -93 / 128.0, -92 / 128.0, -91 / 128.0, -90 / 128.0, -89 / 128.0, -88 / 128.0, -87 / 128.0, -86 / 128.0, -85 / 128.0, -84 / 128.0, -83 / 128.0, -82 / 128.0, -81 / 128.0, -80 / 128.0, -79 / 128.0, -78 / 128.0, -77 / 128.0,
-  -76 / 128.0, -75 / 128.0, -74 / 128.0, -73 / 128.0, -72 / 128.0, -71 / 128.0, -70 / 128.0, -69 / 128.0, -68 / 128.0, -67 / 128.0, -66 / 128.0, -65 / 128.0, -64 / 128.0, -63 / 128.0, -62 / 128.0, -61 / 128.0, -60 / 128.0, -59 / 128.0,
-  -58 / 128.0, -57 / 128.0, -56 / 128.0, -55 / 128.0, -54 / 128.0, -53 / 128.0, -52 / 128.0, -51 / 128.0, -50 / 128.0, -49 / 128.0, -48 / 128.0, -47 / 128.0, -46 / 128.0, -45 / 128.0, -44 / 128.0, -43 / 128.0, -42 / 128.0, -41 / 128.0,
-  -40 / 128.0, -39 / 128.0, -38 / 128.0, -37 / 128.0, -36 / 128.0, -35 / 128.0, -34 / 128.0, -33 / 128.0, -32 / 128.0, -31 / 128.0, -30 / 128.0, -29 / 128.0, -28 / 128.0, -27 / 128.0, -26 / 128.0, -25 / 128.0, -24 / 128.0, -23 / 128.0,
-  -22 / 128.0, -21 / 128.0, -20 / 128.0, -19 / 128.0, -18 / 128.0, -17 / 128.0, -16 / 128.0, -15 / 128.0, -14 / 128.0, -13 / 128.0, -12 / 128.0, -11 / 128.0, -10 / 128.0, -9 / 128.0, -8 / 128.0, -7 / 128.0, -6 / 128.0, -5 / 128.0,
-  -4 / 128.0, -3 / 128.0, -2 / 128.0, -1 / 128.0, 0 / 128.0, 1 / 128.0, 2 / 128.0, 3 / 128.0, 4 / 128.0, 5 / 128.0, 6 / 128.0, 7 / 128.0, 8 / 128.0, 9 / 128.0, 10 / 128.0, 11 / 128.0, 12 / 128.0, 13 / 128.0, 14 / 128.0, 15 / 128.0,
-  16 / 128.0, 17 / 128.0, 18 / 128.0, 19 / 128.0, 20 / 128.0, 21 / 128.0, 22 / 128.0, 23 / 128.0, 24 / 128.0, 25 / 128.0, 26 / 128.0, 27 / 128.0, 28 / 128.0, 29 / 128.0, 30 / 128.0, 31 / 128.0, 32 / 128.0, 33 / 128.0, 34 / 128.0,
-  35 / 128.0, 36 / 128.0, 37 / 128.0, 38 / 128.0, 39 / 128.0, 40 / 128.0, 41 / 128.0, 42 / 128.0, 43 / 128.0, 44 / 128.0, 45 / 128.0, 46 / 128.0, 47 / 128.0, 48 / 128.0, 49 / 128.0, 50 / 128.0, 51 / 128.0, 52 / 128.0, 53 / 128.0,
-  54 / 128.0, 55 / 128.0, 56 / 128.0, 57 / 128.0, 58 / 128.0, 59 / 128.0, 60 / 128.0, 61 / 128.0, 62 / 128.0, 63 / 128.0, 64 / 128.0, 65 / 128.0, 66 / 128.0, 67 / 128.0, 68 / 128.0, 69 / 128.0, 70 / 128.0, 71 / 128.0, 72 / 128.0,
-  73 / 128.0, 74 / 128.0, 75 / 128.0, 76 / 128.0, 77 / 128.0, 78 / 128.0, 79 / 128.0, 80 / 128.0, 81 / 128.0, 82 / 128.0, 83 / 128.0, 84 / 128.0, 85 / 128.0, 86 / 128.0, 87 / 128.0, 88 / 128.0, 89 / 128.0, 90 / 128.0, 91 / 128.0,
-  92 / 128.0, 93 / 128.0, 94 / 128.0, 95 / 128.0, 96 / 128.0, 97 / 128.0, 98 / 128.0, 99 / 128.0, 100 / 128.0, 101 / 128.0, 102 / 128.0, 103 / 128.0, 104 / 128.0, 105 / 128.0, 106 / 128.0, 107 / 128.0, 108 / 128.0, 109 / 128.0, 110 / 128.0,
-  111 / 128.0, 112 / 128.0, 113 / 128.0, 114 / 128.0, 115 / 128.0, 116 / 128.0, 117 / 128.0, 118 / 128.0, 119 / 128.0, 120 / 128.0, 121 / 128.0, 122 / 128.0, 123 / 128.0, 124 / 128.0, 125 / 128.0, 126 / 128.0, 127 / 128.0
-};
-
 void SpyServerClient::slot_data_ready()
 {
   while (mIsConnected && mRingBuffer1.get_ring_buffer_read_available() > 2 * mSettings.batchSize)
@@ -497,43 +459,17 @@ void SpyServerClient::slot_data_ready()
       continue;
     }
 
-    if (mSettings.resample_ratio != 1)
+    assert((i32)mConvBuffer.size() >= numSamples);
+    convert_iq_u8(mByteBuffer.data(), mConvBuffer.data(), numSamples, 128.0f, 1.0f / 128.0f);
+
+    if (mResampler)
     {
-      for (i32 i = 0; i < numSamples; i++)
-      {
-        mConvBuffer[mConvIndex++] = cf32(cConvTable[mByteBuffer[2 * i + 0]], cConvTable[mByteBuffer[2 * i + 1]]);
-
-        if (mConvIndex > mConvBufferSize)
-        {
-#ifdef HAVE_LIQUID
-          u32 usedResultSamples = 0;
-          resamp_crcf_execute_block(mLiquidResampler, mConvBuffer.data(), mConvBufferSize, mResampBuffer.data(), &usedResultSamples);
-          assert(usedResultSamples <= mResampBuffer.size());
-          mRingBuffer2.put_data_into_ring_buffer(mResampBuffer.data(), (i32)usedResultSamples);
-#else
-          for (i32 j = 0; j < 2048; j++)
-          {
-            const i16 inpBase = mMapTable_int[j];
-            const f32 inpRatio = mMapTable_float[j];
-            mResampBuffer[j] = mConvBuffer[inpBase + 1] * inpRatio + mConvBuffer[inpBase] * (1 - inpRatio);
-          }
-          mRingBuffer2.put_data_into_ring_buffer(mResampBuffer.data(), 2048);
-#endif
-          mConvBuffer[0] = mConvBuffer[mConvBufferSize];
-          mConvIndex = 1;
-        }
-      }
+      const i32 numOut = mResampler->process(mConvBuffer.data(), numSamples, mResampBuffer.data());
+      mRingBuffer2.put_data_into_ring_buffer(mResampBuffer.data(), numOut);
     }
     else
     {
       // no resampling necessary
-      assert((i32)mConvBuffer.size() >= numSamples);
-
-      for (i32 i = 0; i < numSamples; i++)
-      {
-        mConvBuffer[i] = cf32(cConvTable[mByteBuffer[2 * i + 0]], cConvTable[mByteBuffer[2 * i + 1]]);
-      }
-
       mRingBuffer2.put_data_into_ring_buffer(mConvBuffer.data(), numSamples);
     }
   }
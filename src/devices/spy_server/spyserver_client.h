@@ -34,6 +34,7 @@
 #include "spyserver_handler.h"
 #include "device_handler_if.h"
 #include "ringbuffer.h"
+#include "polyphase_resampler.h"
 #include "ui_spyserver_client.h"
 #include <QObject>
 #include <QSettings>
@@ -46,9 +47,7 @@
 #include <QFrame>
 #include <QByteArray>
 #include <cstdio>
-#ifdef HAVE_LIQUID
-  #include <liquid/liquid.h>
-#endif
+#include <memory>
 
 
 class SpyServerClient : public QObject, public IDeviceHandler, private Ui_spyServer_widget_8
@@ -63,6 +62,7 @@ public:
   void stopReader() override;
   i32 getSamples(cf32 * V, i32 size) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   void setVFOFrequency(i32) override;
   i32 getVFOFrequency() override;
   void resetBuffer() override;
@@ -113,16 +113,7 @@ private:
   std::atomic<bool> mIsRunning = false;
   std::atomic<bool> mIsConnected = false;
   std::vector<cf32> mConvBuffer;
-  i16 mConvIndex = 0;
-  i16 mConvBufferSize = 0;
-
-#ifdef HAVE_LIQUID
-  resamp_crcf mLiquidResampler = nullptr;
-#else
-  std::vector<i16> mMapTable_int;
-  std::vector<f32> mMapTable_float;
-  i32 selectedRate = 0;
-#endif
+  std::unique_ptr<PolyphaseResampler> mResampler;
 
   bool _setup_connection();
   bool _check_and_cleanup_ip_address();
@@ -125,9 +125,8 @@ void SpyServerHandler::run()
 
 bool SpyServerHandler::readHeader(struct MessageHeader & header)
 {
-  while (running.load() && (inBuffer.get_ring_buffer_read_available() < (i32)sizeof(struct MessageHeader)))
+  while (running.load() && (inBuffer.wait_for_read_available((i32)sizeof(struct MessageHeader), std::chrono::milliseconds(100)) < (i32)sizeof(struct MessageHeader)))
   {
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
   }
 
   if (!running.load())
@@ -144,7 +143,7 @@ bool SpyServerHandler::readBody(u8 * buffer, i32 size)
   i32 filler = 0;
   while (running.load())
   {
-    if (inBuffer.get_ring_buffer_read_available() > size / 2)
+    if (inBuffer.wait_for_read_available(size / 2 + 1, std::chrono::milliseconds(100)) > size / 2)
     {
       filler += inBuffer.get_data_from_ring_buffer(buffer, size - filler);
 
@@ -158,10 +157,6 @@ bool SpyServerHandler::readBody(u8 * buffer, i32 size)
         return false;
       }
     }
-    else
-    {
-      std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
   }
   return false;
 }
@@ -230,6 +230,11 @@ i32 UhdHandler::Samples()
   return theBuffer->get_ring_buffer_read_available();
 }
 
+i32 UhdHandler::wait_for_samples(const i32 iNoSamples, const i32 iTimeoutMs)
+{
+  return theBuffer->wait_for_read_available(iNoSamples, std::chrono::milliseconds(iTimeoutMs));
+}
+
 void UhdHandler::resetBuffer()
 {
   theBuffer->flush_ring_buffer();
@@ -62,6 +62,7 @@ public:
   void stopReader() override;
   i32 getSamples(cf32 *, i32 size) override;
   i32 Samples() override;
+  i32 wait_for_samples(i32 iNoSamples, i32 iTimeoutMs) override;
   void resetBuffer() override;
   void show() override;
   void hide() override;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "cif_buffer_ring.h"
+#include <gtest/gtest.h>
+#include <deque>
+#include <set>
+
+// backends keeping up release each CIF before the ring wraps, so the buffers are reused in turn
+TEST(CifBufferRing, ReusesReleasedBuffers)
+{
+  CifBufferRing ring(4, 16);
+  std::set<const i16 *> used;
+
+  for (i32 cif = 0; cif < 100; cif++)
+  {
+    used.insert(ring.next_cif());
+    const TCifBufferPtr pCif = ring.current_cif(); // released at the end of the iteration
+  }
+  EXPECT_EQ(used.size(), 4u);
+  EXPECT_EQ(ring.get_num_buffers(), 4u);
+}
+
+// a lagging backend holds some buffers, they must not be overwritten and the ring grows only up to the number of held
+// buffers plus the one in writing
+TEST(CifBufferRing, SkipsHeldBuffersAndGrowsOnlyOnce)
+{
+  constexpr size_t cNumHeld = 7;
+  CifBufferRing ring(4, 16);
+  std::deque<TCifBufferPtr> held;
+
+  for (i32 cif = 0; cif < 200; cif++)
+  {
+    i16 * const p = ring.next_cif();
+
+    for (const auto & h : held)
+    {
+      ASSERT_NE(h->data(), p) << "CIF " << cif;
+    }
+    p[0] = (i16)cif;
+
+    held.push_back(ring.current_cif());
+    if (held.size() > cNumHeld)
+    {
+      held.pop_front();
+    }
+    ASSERT_EQ((*held.back())[0], (i16)cif);
+  }
+  EXPECT_EQ(ring.get_num_buffers(), cNumHeld + 1);
+}
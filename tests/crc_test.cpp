@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "crc.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// bitwise CRC-16 with g(x) = x^16 + x^12 + x^5 + 1, preset 0xFFFF, inverted result (EN 300 401 clause 5.2.1)
+u16 crc_bitwise(const u8 * ipData, const i32 iLen)
+{
+  u16 crc = 0xffff;
+
+  for (i32 i = 0; i < iLen; i++)
+  {
+    for (i32 b = 7; b >= 0; b--)
+    {
+      const bool fb = (((crc >> 15) ^ (ipData[i] >> b)) & 1) != 0;
+      crc = (u16)(crc << 1);
+      if (fb)
+      {
+        crc ^= 0x1021;
+      }
+    }
+  }
+  return (u16)~crc;
+}
+
+// the former shift register implementation of check_CRC_bits() (one bit per byte input)
+bool check_crc_bits_shift_register(const u8 * const iIn, const i32 iSize)
+{
+  static const u8 crcPolynome[] = { 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 };  // MSB .. LSB
+  u8 b[16];
+  i32 sum = 0;
+
+  memset(b, 1, 16);
+
+  for (i32 i = 0; i < iSize; i++)
+  {
+    const u8 invBit = (i >= iSize - 16 ? 1 : 0);
+
+    if ((b[0] ^ (iIn[i] ^ invBit)) == 1)
+    {
+      for (i32 f = 0; f < 15; f++)
+      {
+        b[f] = crcPolynome[f] ^ b[f + 1];
+      }
+      b[15] = 1;
+    }
+    else
+    {
+      memmove(&b[0], &b[1], sizeof(u8) * 15);
+      b[15] = 0;
+    }
+  }
+
+  for (i32 i = 0; i < 16; i++)
+  {
+    sum += b[i];
+  }
+  return sum == 0;
+}
+
+std::vector<u8> random_bytes(const i32 iLen, std::mt19937 & ioRng)
+{
+  std::vector<u8> v(iLen);
+  for (auto & x : v)
+  {
+    x = (u8)ioRng();
+  }
+  return v;
+}
+
+// appends the CRC (MSB first) like it is transmitted
+void append_crc(std::vector<u8> & ioMsg)
+{
+  const u16 crc = crc_bitwise(ioMsg.data(), (i32)ioMsg.size());
+  ioMsg.push_back((u8)(crc >> 8));
+  ioMsg.push_back((u8)(crc & 0xff));
+}
+
+std::vector<u8> to_bits(const std::vector<u8> & iBytes)
+{
+  std::vector<u8> bits;
+  for (const u8 byte : iBytes)
+  {
+    for (i32 b = 7; b >= 0; b--)
+    {
+      bits.push_back((u8)((byte >> b) & 1));
+    }
+  }
+  return bits;
+}
+
+} // namespace
+
+TEST(Crc, KnownValue)
+{
+  const char * const msg = "123456789";
+  EXPECT_EQ(calc_crc((const u8 *)msg, 9), 0xD64E); // CRC-16/GENIBUS check value
+  EXPECT_EQ(calc_crc(nullptr, 0), 0x0000);
+}
+
+// all lengths around the 8 byte steps of the slicing tables
+TEST(Crc, SlicedMatchesBitwise)
+{
+  std::mt19937 rng(21);
+
+  for (i32 len = 0; len <= 301; len++)
+  {
+    for (i32 n = 0; n < 20; n++)
+    {
+      const std::vector<u8> msg = random_bytes(len, rng);
+      ASSERT_EQ(calc_crc(msg.data(), len), crc_bitwise(msg.data(), len)) << "length " << len;
+    }
+  }
+}
+
+TEST(Crc, CheckBytesDetectsErrors)
+{
+  std::mt19937 rng(22);
+
+  for (const i32 len : { 1, 7, 8, 9, 30, 110, 301 })
+  {
+    std::vector<u8> msg = random_bytes(len, rng);
+    append_crc(msg);
+    EXPECT_TRUE(check_crc_bytes(msg.data(), len)) << "length " << len;
+
+    for (i32 bit = 0; bit < 8 * (len + 2); bit += 5)
+    {
+      msg[bit / 8] ^= (u8)(0x80 >> (bit % 8));
+      EXPECT_FALSE(check_crc_bytes(msg.data(), len)) << "length " << len << ", bit " << bit;
+      msg[bit / 8] ^= (u8)(0x80 >> (bit % 8));
+    }
+  }
+}
+
+// FIBs (256 bits, one bit per byte) with valid and corrupted CRC have to give the same result as the shift register
+TEST(Crc, CheckBitsMatchesShiftRegister)
+{
+  std::mt19937 rng(23);
+  i32 numValid = 0;
+
+  for (i32 n = 0; n < 2000; n++)
+  {
+    std::vector<u8> fib = random_bytes(30, rng);
+    append_crc(fib);
+    std::vector<u8> bits = to_bits(fib);
+
+    if (n % 2 != 0)
+    {
+      bits[rng() % bits.size()] ^= 1;
+    }
+    if (n % 4 == 3)
+    {
+      bits[rng() % bits.size()] ^= 1;
+    }
+
+    const bool expected = check_crc_bits_shift_register(bits.data(), (i32)bits.size());
+    ASSERT_EQ(check_CRC_bits(bits.data(), (i32)bits.size()), expected) << "FIB " << n;
+    numValid += expected;
+  }
+  EXPECT_GE(numValid, 1000); // all unchanged FIBs are valid
+  EXPECT_LT(numValid, 2000);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Micro benchmark of the IQ converter variants against the former conversion loops of the device handlers
+// (u8 with a lookup table, i16 with a division, big endian i16 assembled byte by byte).
+
+#include "iq_converter.h"
+#include "cpu_features.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr i32 cNumSamples = 16384; // a typical device block
+constexpr i32 cNumIter = 20000;
+
+using TClock = std::chrono::steady_clock;
+
+// prevents that the compiler drops the conversion of unused output
+volatile f32 sSink;
+
+void bench(const char * const iName, const std::function<void()> & iFunc, const std::vector<cf32> & iOut)
+{
+  iFunc(); // warm up
+  const auto start = TClock::now();
+  for (i32 i = 0; i < cNumIter; i++)
+  {
+    iFunc();
+  }
+  const f64 ns = (f64)std::chrono::duration_cast<std::chrono::nanoseconds>(TClock::now() - start).count();
+  sSink = iOut[cNumSamples / 2].real();
+  printf("  %-10s %6.3f ns/sample\n", iName, ns / cNumIter / cNumSamples);
+}
+
+std::vector<SIqConverterKernels> available_kernels()
+{
+  std::vector<SIqConverterKernels> v{ cIqConverterKernelsScalar };
+#if defined(__x86_64__) || defined(_M_X64)
+  if (CpuFeatures::has_sse41()) v.push_back(cIqConverterKernelsSse41);
+  if (CpuFeatures::has_avx2()) v.push_back(cIqConverterKernelsAvx2);
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  if (CpuFeatures::has_neon()) v.push_back(cIqConverterKernelsNeon);
+#endif
+  return v;
+}
+
+} // namespace
+
+int main()
+{
+  std::mt19937 rng(1);
+  std::vector<u8> bytes(4 * cNumSamples);
+  for (auto & b : bytes)
+  {
+    b = (u8)rng();
+  }
+  std::vector<cf32> out(cNumSamples);
+  const std::vector<SIqConverterKernels> kernels = available_kernels();
+
+  std::array<f32, 256> mapTable;
+  for (i32 i = 0; i < 256; i++)
+  {
+    mapTable[i] = ((f32)i - cRtlSdrIqOffset) * cRtlSdrIqScale;
+  }
+
+  printf("u8 (rtlsdr):\n");
+  bench("former", [&]()
+  {
+    for (i32 i = 0; i < cNumSamples; i++)
+    {
+      out[i] = cf32(mapTable[bytes[2 * i]], mapTable[bytes[2 * i + 1]]);
+    }
+  }, out);
+  for (const auto & k : kernels)
+  {
+    bench(k.pName, [&]() { k.pU8(bytes.data(), out.data(), cNumSamples, cRtlSdrIqOffset, cRtlSdrIqScale); }, out);
+  }
+
+  printf("i8 (hackrf):\n");
+  for (const auto & k : kernels)
+  {
+    bench(k.pName, [&]() { k.pI8((const i8 *)bytes.data(), out.data(), cNumSamples, 1.0f / 127.0f); }, out);
+  }
+
+  printf("i16 (sdrplay, lime, airspy, pluto):\n");
+  const i16 * const pI16 = reinterpret_cast<const i16 *>(bytes.data());
+  bench("former", [&]()
+  {
+    for (i32 i = 0; i < cNumSamples; i++)
+    {
+      out[i] = cf32(pI16[2 * i] / (f32)2048, pI16[2 * i + 1] / (f32)2048);
+    }
+  }, out);
+  for (const auto & k : kernels)
+  {
+    bench(k.pName, [&]() { k.pI16(pI16, out.data(), cNumSamples, 1.0f / 2048.0f); }, out);
+  }
+
+  printf("i16 big endian (xml files):\n");
+  bench("former", [&]()
+  {
+    for (i32 i = 0; i < cNumSamples; i++)
+    {
+      const i16 re = (i16)((bytes[4 * i] << 8) | bytes[4 * i + 1]);
+      const i16 im = (i16)((bytes[4 * i + 2] << 8) | bytes[4 * i + 3]);
+      out[i] = cf32((f32)re / 2048.0f, (f32)im / 2048.0f);
+    }
+  }, out);
+  for (const auto & k : kernels)
+  {
+    bench(k.pName, [&]() { k.pI16Be(bytes.data(), out.data(), cNumSamples, 1.0f / 2048.0f); }, out);
+  }
+
+  printf("i12 packed:\n");
+  for (const auto & k : kernels)
+  {
+    bench(k.pName, [&]() { k.pI12Packed(bytes.data(), out.data(), cNumSamples, 1.0f / 2048.0f); }, out);
+  }
+  return 0;
+}
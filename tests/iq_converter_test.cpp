@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "iq_converter.h"
+#include "cpu_features.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct SIqKernelsUnderTest
+{
+  const SIqConverterKernels & kernels;
+  bool available;
+};
+
+std::vector<SIqKernelsUnderTest> simd_kernels()
+{
+  return {
+#if defined(__x86_64__) || defined(_M_X64)
+    { cIqConverterKernelsSse41, CpuFeatures::has_sse41() },
+    { cIqConverterKernelsAvx2, CpuFeatures::has_avx2() },
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    { cIqConverterKernelsNeon, CpuFeatures::has_neon() },
+#endif
+  };
+}
+
+// the outputs are compared bitwise, the variants must deliver identical floats
+bool equal_bits(const std::vector<cf32> & iA, const std::vector<cf32> & iB)
+{
+  return iA.size() == iB.size() && memcmp(iA.data(), iB.data(), iA.size() * sizeof(cf32)) == 0;
+}
+
+// all sample counts around the SIMD block sizes and with an unaligned start of the input and the output
+template<typename TRun>
+i32 compare_with_scalar(const TRun & iRun)
+{
+  std::mt19937 rng(51);
+  i32 numTested = 0;
+
+  for (const auto & k : simd_kernels())
+  {
+    if (!k.available)
+    {
+      continue;
+    }
+    for (i32 numSamples = 0; numSamples <= 70; numSamples++)
+    {
+      for (i32 offs = 0; offs < 3; offs++)
+      {
+        std::vector<u8> in(4 * numSamples + 3);
+        for (auto & b : in)
+        {
+          b = (u8)rng();
+        }
+        std::vector<cf32> expected(numSamples + 1);
+        std::vector<cf32> out(numSamples + 1);
+        iRun(cIqConverterKernelsScalar, in.data() + offs, expected.data() + (offs & 1), numSamples);
+        iRun(k.kernels, in.data() + offs, out.data() + (offs & 1), numSamples);
+        EXPECT_TRUE(equal_bits(out, expected)) << k.kernels.pName << ", " << numSamples << " samples, offset " << offs;
+      }
+    }
+    ++numTested;
+  }
+  return numTested;
+}
+
+} // namespace
+
+// the scalar variants against the conversion rule of the header, for all possible input values
+TEST(IqConverter, ScalarFollowsConversionRule)
+{
+  std::vector<u8> in(4 * 65536);
+  for (i32 i = 0; i < 65536; i++)
+  {
+    in[4 * i + 0] = (u8)(i & 0xFF); // I as little endian i16, also covers all u8 and i8 values
+    in[4 * i + 1] = (u8)(i >> 8);
+    in[4 * i + 2] = (u8)(i >> 8);   // Q as little endian i16 with swapped bytes (so the big endian I value of the next pair)
+    in[4 * i + 3] = (u8)(i & 0xFF);
+  }
+  std::vector<cf32> out(2 * 65536);
+  const f32 * const pOut = reinterpret_cast<const f32 *>(out.data());
+  const i16 * const pI16 = reinterpret_cast<const i16 *>(in.data());
+
+  cIqConverterKernelsScalar.pU8(in.data(), out.data(), 2 * 65536, cRtlSdrIqOffset, cRtlSdrIqScale);
+  for (i32 i = 0; i < 4 * 65536; i++)
+  {
+    ASSERT_EQ(pOut[i], ((f32)in[i] - cRtlSdrIqOffset) * cRtlSdrIqScale) << "u8 value " << i;
+  }
+
+  cIqConverterKernelsScalar.pI8(reinterpret_cast<const i8 *>(in.data()), out.data(), 2 * 65536, 1.0f / 127.0f);
+  for (i32 i = 0; i < 4 * 65536; i++)
+  {
+    ASSERT_EQ(pOut[i], (f32)(i8)in[i] * (1.0f / 127.0f)) << "i8 value " << i;
+  }
+
+  cIqConverterKernelsScalar.pI16(pI16, out.data(), 65536, 1.0f / 2048.0f);
+  for (i32 i = 0; i < 2 * 65536; i++)
+  {
+    ASSERT_EQ(pOut[i], (f32)pI16[i] * (1.0f / 2048.0f)) << "i16 value " << i;
+  }
+
+  cIqConverterKernelsScalar.pI16Be(in.data(), out.data(), 65536, 1.0f / 2048.0f);
+  for (i32 i = 0; i < 2 * 65536; i++)
+  {
+    ASSERT_EQ(pOut[i], (f32)(i16)((in[2 * i] << 8) | in[2 * i + 1]) * (1.0f / 2048.0f)) << "i16 big endian value " << i;
+  }
+
+  cIqConverterKernelsScalar.pI12Packed(in.data(), out.data(), 4 * 65536 / 3, 1.0f / 2048.0f);
+  for (i32 i = 0; i < 4 * 65536 / 3; i++)
+  {
+    const u8 * const b = &in[3 * i];
+    const i32 re = (b[0] | ((b[1] & 0x0F) << 8)) - ((b[1] & 0x08) ? 4096 : 0);
+    const i32 im = ((b[1] >> 4) | (b[2] << 4)) - ((b[2] & 0x80) ? 4096 : 0);
+    ASSERT_EQ(out[i], cf32((f32)re * (1.0f / 2048.0f), (f32)im * (1.0f / 2048.0f))) << "i12 sample " << i;
+  }
+}
+
+TEST(IqConverter, U8MatchesScalar)
+{
+  if (compare_with_scalar([](const SIqConverterKernels & k, const u8 * p, cf32 * o, i32 n) { k.pU8(p, o, n, cRtlSdrIqOffset, cRtlSdrIqScale); }) == 0)
+  {
+    GTEST_SKIP() << "no SIMD variant available on this CPU";
+  }
+}
+
+TEST(IqConverter, I8MatchesScalar)
+{
+  if (compare_with_scalar([](const SIqConverterKernels & k, const u8 * p, cf32 * o, i32 n) { k.pI8(reinterpret_cast<const i8 *>(p), o, n, 1.0f / 127.0f); }) == 0)
+  {
+    GTEST_SKIP() << "no SIMD variant available on this CPU";
+  }
+}
+
+TEST(IqConverter, I16MatchesScalar)
+{
+  // the i16 input has to be aligned to 2 bytes, so it is copied
+  if (compare_with_scalar([](const SIqConverterKernels & k, const u8 * p, cf32 * o, i32 n)
+  {
+    std::vector<i16> in(2 * n);
+    memcpy(in.data(), p, in.size() * sizeof(i16));
+    k.pI16(in.data(), o, n, 1.0f / 2048.0f);
+  }) == 0)
+  {
+    GTEST_SKIP() << "no SIMD variant available on this CPU";
+  }
+}
+
+TEST(IqConverter, I16BeMatchesScalar)
+{
+  if (compare_with_scalar([](const SIqConverterKernels & k, const u8 * p, cf32 * o, i32 n) { k.pI16Be(p, o, n, 1.0f / 2048.0f); }) == 0)
+  {
+    GTEST_SKIP() << "no SIMD variant available on this CPU";
+  }
+}
+
+TEST(IqConverter, I12PackedMatchesScalar)
+{
+  if (compare_with_scalar([](const SIqConverterKernels & k, const u8 * p, cf32 * o, i32 n) { k.pI12Packed(p, o, n, 1.0f / 2048.0f); }) == 0)
+  {
+    GTEST_SKIP() << "no SIMD variant available on this CPU";
+  }
+}
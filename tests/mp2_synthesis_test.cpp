@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "mp2_synthesis.h"
+#include "cpu_features.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct SMp2KernelUnderTest
+{
+  SMp2SynthesisKernel kernel;
+  bool available;
+};
+
+std::vector<SMp2KernelUnderTest> simd_kernels()
+{
+  return {
+#if defined(__x86_64__) || defined(_M_X64)
+    { { mp2_synthesis_kernel_sse41, "SSE4.1" }, CpuFeatures::has_sse41() },
+    { { mp2_synthesis_kernel_avx2, "AVX2" }, CpuFeatures::has_avx2() },
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    { { mp2_synthesis_kernel_neon, "NEON" }, CpuFeatures::has_neon() },
+#endif
+  };
+}
+
+// runs the kernel like Mp2Processor over iNumSubBlocks sub-blocks of a stereo stream (V ring per channel, interleaved
+// PCM output) and returns the PCM output followed by the final V rings
+std::vector<i16> run_kernel(const TMp2SynthesisKernel iKernel, const std::vector<i32> & iSamples, const i32 iNumSubBlocks)
+{
+  std::array<std::array<i16, 1024>, 2> V{};
+  std::vector<i16> pcm(iNumSubBlocks * 64);
+  i32 vOffs = 0;
+
+  for (i32 blk = 0; blk < iNumSubBlocks; blk++)
+  {
+    vOffs = (vOffs - 64) & 1023;
+    for (i32 ch = 0; ch < 2; ch++)
+    {
+      iKernel(&iSamples[(2 * blk + ch) * 32], V[ch].data(), vOffs, &pcm[blk * 64 + ch], 2);
+    }
+  }
+
+  for (const auto & v : V)
+  {
+    pcm.insert(pcm.end(), v.begin(), v.end());
+  }
+  return pcm;
+}
+
+} // namespace
+
+// All SIMD kernels have to deliver bit-identical PCM samples and V rings, for signals of different strength,
+// the full scale one also checks the clamping of the output.
+TEST(Mp2Synthesis, SimdKernelsMatchScalar)
+{
+  constexpr i32 cNumSubBlocks = 3 * 12 * 20; // 20 MP2 frames
+  std::mt19937 rng(41);
+  i32 numTested = 0;
+
+  for (const i32 amplitude : { 0, 100, 4000, 32767 })
+  {
+    std::uniform_int_distribution<i32> dist(-amplitude, amplitude);
+    std::vector<i32> samples(cNumSubBlocks * 2 * 32);
+    for (auto & s : samples)
+    {
+      s = dist(rng);
+    }
+
+    const std::vector<i16> expected = run_kernel(mp2_synthesis_kernel_scalar, samples, cNumSubBlocks);
+
+    for (const auto & k : simd_kernels())
+    {
+      if (!k.available)
+      {
+        continue;
+      }
+      EXPECT_EQ(run_kernel(k.kernel.pFunc, samples, cNumSubBlocks), expected) << k.kernel.pName << " kernel, amplitude " << amplitude;
+      ++numTested;
+    }
+  }
+  if (numTested == 0)
+  {
+    GTEST_SKIP() << "no SIMD kernel available on this CPU";
+  }
+}
+
+TEST(Mp2Synthesis, ChosenKernelIsAvailable)
+{
+  EXPECT_NE(get_mp2_synthesis_kernel().pFunc, nullptr);
+  EXPECT_NE(get_mp2_synthesis_kernel().pName, nullptr);
+}
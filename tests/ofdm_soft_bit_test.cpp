@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ofdm_decoder_simd.h"
+#include "ofdm_soft_bit_kernels.h"
+#include "cpu_features.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace
+{
+
+// FFT output of a DQPSK modulated OFDM symbol with a slow phase drift over the carriers, fading and gaussian noise
+class SymbolSource
+{
+public:
+  explicit SymbolSource(const u32 iSeed) : mRng(iSeed)
+  {
+    std::uniform_real_distribution<f32> gain(0.3f, 1.5f);
+    for (i32 i = 0; i < cTu; i++)
+    {
+      mPhase[i] = (f32)i * 0.001f;
+      mGain[i] = gain(mRng);
+    }
+  }
+
+  void next_null_symbol(TArrayTu & oFftBuffer)
+  {
+    for (auto & v : oFftBuffer)
+    {
+      v = cf32(mNoise(mRng), mNoise(mRng)) * 0.05f;
+    }
+  }
+
+  void next_symbol(TArrayTu & oFftBuffer)
+  {
+    std::uniform_int_distribution<i32> quadrant(0, 3);
+    for (i32 i = 0; i < cTu; i++)
+    {
+      mPhase[i] += F_M_PI_2 * (f32)quadrant(mRng) + 0.002f; // the small offset simulates a clock error
+      oFftBuffer[i] = mGain[i] * std::polar(1.0f, mPhase[i]) + cf32(mNoise(mRng), mNoise(mRng)) * 0.1f;
+    }
+  }
+
+private:
+  std::mt19937 mRng;
+  std::normal_distribution<f32> mNoise{0.0f, 1.0f};
+  std::array<f32, cTu> mPhase{};
+  std::array<f32, cTu> mGain{};
+};
+
+std::vector<SOfdmSoftBitKernel> available_kernels()
+{
+  std::vector<SOfdmSoftBitKernel> kernels{ { ofdm_soft_bit_kernel_scalar, "Scalar" } };
+#if defined(__x86_64__) || defined(_M_X64)
+  if (CpuFeatures::has_avx2()) kernels.push_back({ ofdm_soft_bit_kernel_avx2, "AVX2" });
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  if (CpuFeatures::has_neon()) kernels.push_back({ ofdm_soft_bit_kernel_neon, "NEON" });
+#endif
+  return kernels;
+}
+
+struct SDecoder
+{
+  RingBuffer<cf32> iqBuffer{ 2 * cK };
+  RingBuffer<f32> carrBuffer{ 2 * cK };
+  OfdmDecoder decoder{ nullptr, &iqBuffer, &carrBuffer };
+  std::vector<i16> bits = std::vector<i16>(2 * cK);
+};
+
+} // namespace
+
+// Feeds the same symbols through the multi-pass SimdVec chain and through each fused kernel variant,
+// the soft bits may differ by 1 LSB due to the different rounding of the math functions.
+TEST(OfdmSoftBits, FusedKernelsMatchMultiPass)
+{
+  constexpr i32 cNumFrames = 4;
+  constexpr f32 cClockErr = 0.3f;
+  alignas(64) TArrayTu fftBuffer;
+
+  for (const ESoftBitType softBitType : { ESoftBitType::SOFTDEC1, ESoftBitType::SOFTDEC2, ESoftBitType::SOFTDEC3 })
+  {
+    for (const SOfdmSoftBitKernel & kernel : available_kernels())
+    {
+      auto pRef = std::make_unique<SDecoder>();
+      auto pDut = std::make_unique<SDecoder>();
+      pRef->decoder.set_use_fused_kernel(false);
+      pDut->decoder.set_use_fused_kernel(true);
+      pDut->decoder.set_soft_bit_kernel(kernel);
+
+      SymbolSource source(5);
+      i32 maxDiff = 0;
+      i32 numDiff = 0;
+      i32 maxAbs = 0;
+
+      for (SDecoder * const p : { pRef.get(), pDut.get() })
+      {
+        p->decoder.set_soft_bit_gen_type(softBitType);
+      }
+
+      for (i32 frame = 0; frame < cNumFrames; frame++)
+      {
+        source.next_null_symbol(fftBuffer);
+        pRef->decoder.store_null_symbol_without_tii(fftBuffer);
+        pDut->decoder.store_null_symbol_without_tii(fftBuffer);
+
+        source.next_symbol(fftBuffer);
+        pRef->decoder.store_reference_symbol_0(fftBuffer);
+        pDut->decoder.store_reference_symbol_0(fftBuffer);
+
+        for (u16 symbIdx = 1; symbIdx < cL; symbIdx++)
+        {
+          source.next_symbol(fftBuffer);
+          pRef->decoder.decode_symbol(fftBuffer, symbIdx, 0.0f, cClockErr, pRef->bits);
+          pDut->decoder.decode_symbol(fftBuffer, symbIdx, 0.0f, cClockErr, pDut->bits);
+
+          for (i32 i = 0; i < 2 * cK; i++)
+          {
+            const i32 diff = std::abs(pRef->bits[i] - pDut->bits[i]);
+            maxDiff = std::max(maxDiff, diff);
+            maxAbs = std::max(maxAbs, std::abs((i32)pRef->bits[i]));
+            numDiff += (diff != 0);
+          }
+        }
+      }
+
+      EXPECT_GT(maxAbs, 50); // the soft bits are in the usual range of the Viterbi input
+      EXPECT_LE(maxDiff, 1) << kernel.pName << " kernel, soft bit type " << (i32)softBitType;
+      RecordProperty(std::string(kernel.pName) + "_type" + std::to_string((i32)softBitType) + "_num_diff", numDiff);
+    }
+  }
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "polyphase_resampler.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr i32 cDabRate = 2048000;
+
+// input rates of the devices and files (2500001 has no common divisor with the DAB rate, so L is approximated)
+const i32 cInputRates[] = { 2500000, 3000000, 2100000, 6000000, 2500001 };
+
+std::vector<cf32> make_tone(const f64 iFreq, const i32 iRate, const i32 iNumSamples)
+{
+  std::vector<cf32> v(iNumSamples);
+  for (i32 n = 0; n < iNumSamples; n++)
+  {
+    const f64 arg = 2.0 * M_PI * std::fmod(iFreq * n / iRate, 1.0);
+    v[n] = cf32((f32)std::cos(arg), (f32)std::sin(arg));
+  }
+  return v;
+}
+
+std::vector<cf32> resample(PolyphaseResampler & ioResampler, const std::vector<cf32> & iIn, const i32 iBlockSize)
+{
+  std::vector<cf32> out(ioResampler.get_max_output_size((i32)iIn.size()));
+  i32 numOut = 0;
+  for (i32 i = 0; i < (i32)iIn.size(); i += iBlockSize)
+  {
+    numOut += ioResampler.process(iIn.data() + i, std::min(iBlockSize, (i32)iIn.size() - i), out.data() + numOut);
+  }
+  out.resize(numOut);
+  return out;
+}
+
+// mean power of the output after the settling time of the filter
+f64 mean_power(const std::vector<cf32> & iOut, const i32 iSkip)
+{
+  f64 sum = 0;
+  for (i32 i = iSkip; i < (i32)iOut.size(); i++)
+  {
+    sum += std::norm(iOut[i]);
+  }
+  return sum / (f64)(iOut.size() - iSkip);
+}
+
+} // namespace
+
+// the output length follows exactly the rate ratio, independent of the block sizes (also above cMaxBlockSize)
+TEST(PolyphaseResampler, OutputLengthFollowsRateRatio)
+{
+  std::mt19937 rng(25);
+
+  for (const i32 inputRate : cInputRates)
+  {
+    PolyphaseResampler resampler(inputRate, cDabRate);
+    std::vector<cf32> in(3 * PolyphaseResampler::cMaxBlockSize);
+    std::vector<cf32> out(resampler.get_max_output_size((i32)in.size()));
+    i64 numIn = 0;
+    i64 numOut = 0;
+
+    for (i32 n = 0; n < 200; n++)
+    {
+      const i32 blockSize = (n % 10 == 0 ? (i32)in.size() : (i32)(rng() % 3000));
+      const i32 numOutBlock = resampler.process(in.data(), blockSize, out.data());
+      ASSERT_LE(numOutBlock, resampler.get_max_output_size(blockSize)) << inputRate << " S/s, block size " << blockSize;
+      numIn += blockSize;
+      numOut += numOutBlock;
+    }
+    const f64 expected = (f64)numIn * cDabRate / inputRate;
+    EXPECT_NEAR((f64)numOut, expected, 1.0) << inputRate << " S/s";
+  }
+}
+
+// the output must not depend on how the input is split into blocks
+TEST(PolyphaseResampler, BlockSizeDoesNotChangeOutput)
+{
+  const std::vector<cf32> in = make_tone(300000.0, 2500000, 50000);
+  PolyphaseResampler resamplerRef(2500000, cDabRate);
+  PolyphaseResampler resampler(2500000, cDabRate);
+
+  const std::vector<cf32> expected = resample(resamplerRef, in, (i32)in.size());
+  const std::vector<cf32> out = resample(resampler, in, 777);
+  ASSERT_EQ(out.size(), expected.size());
+  EXPECT_EQ(memcmp(out.data(), expected.data(), out.size() * sizeof(cf32)), 0);
+}
+
+// tones within the passband keep their amplitude, tones which would alias into the DAB band are suppressed
+TEST(PolyphaseResampler, PassbandAndStopband)
+{
+  constexpr i32 cNumIn = 100000;
+  constexpr i32 cSkip = 1000;
+
+  for (const i32 inputRate : cInputRates)
+  {
+    for (const f32 freq : { 0.0f, 400000.0f, -700000.0f, PolyphaseResampler::cDefaultPassBandHz })
+    {
+      PolyphaseResampler resampler(inputRate, cDabRate);
+      const f64 powerDb = 10 * std::log10(mean_power(resample(resampler, make_tone(freq, inputRate, cNumIn), 4096), cSkip));
+      EXPECT_NEAR(powerDb, 0.0, 0.1) << inputRate << " S/s, " << freq << " Hz";
+    }
+
+    // the tones just above the stopband edge would alias into the passband
+    const f32 stopBandHz = cDabRate - PolyphaseResampler::cDefaultPassBandHz + 5000.0f;
+    for (const f32 freq : { stopBandHz, -stopBandHz, 1500000.0f, -1500000.0f })
+    {
+      if (std::abs(freq) < 0.5 * inputRate)
+      {
+        PolyphaseResampler resampler(inputRate, cDabRate);
+        const f64 powerDb = 10 * std::log10(mean_power(resample(resampler, make_tone(freq, inputRate, cNumIn), 4096), cSkip));
+        EXPECT_LT(powerDb, -55.0) << inputRate << " S/s, " << freq << " Hz";
+      }
+    }
+  }
+}
+
+// the tone keeps its frequency exactly, also if L is approximated (a rate error would let the phase drift away)
+TEST(PolyphaseResampler, NoFrequencyDrift)
+{
+  constexpr f32 cFreq = 500000.0f;
+  constexpr i32 cNumOut = 2 * cDabRate; // two seconds
+
+  for (const i32 inputRate : cInputRates)
+  {
+    PolyphaseResampler resampler(inputRate, cDabRate);
+    const std::vector<cf32> out = resample(resampler, make_tone(cFreq, inputRate, (i32)((i64)cNumOut * inputRate / cDabRate)), 16384);
+    ASSERT_GE((i32)out.size(), cNumOut - 1);
+
+    // phase of the output relative to the ideal tone, at the beginning (after settling) and at the end
+    const auto phase_error = [&](const i32 iIdx)
+    {
+      const f64 arg = 2.0 * M_PI * std::fmod((f64)cFreq * iIdx / cDabRate, 1.0);
+      return std::arg(out[iIdx] * std::conj(cf32((f32)std::cos(arg), (f32)std::sin(arg))));
+    };
+    const f32 drift = std::remainder(phase_error(cNumOut - 2) - phase_error(1000), 2 * (f32)M_PI);
+    EXPECT_LT(std::abs(drift), 0.01f) << inputRate << " S/s";
+  }
+}
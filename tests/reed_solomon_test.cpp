@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "reed_solomon.h"
+#include "reed_solomon_fast.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <random>
+
+namespace
+{
+
+constexpr i16 cCutLen = 135; // RS(120,110) of the DAB+ superframes
+constexpr i32 cCodewordLen = ReedSolomonFast::cCodeLength - cCutLen;
+constexpr i32 cDataLen = cCodewordLen - ReedSolomonFast::cNumRoots;
+
+using TCodeword = std::array<u8, cCodewordLen>;
+
+TCodeword random_codeword(ReedSolomon & ioEncoder, std::mt19937 & ioRng)
+{
+  TCodeword data{};
+  TCodeword codeword{};
+
+  std::generate_n(data.begin(), cDataLen, [&ioRng]() { return (u8)ioRng(); });
+  ioEncoder.enc(data.data(), codeword.data(), cCutLen);
+  return codeword;
+}
+
+// sets iNumErrors different symbols of the first iLen bytes to a wrong value
+void add_errors(u8 * iopCodeword, const i32 iLen, const i32 iNumErrors, std::mt19937 & ioRng)
+{
+  std::vector<i32> pos(iLen);
+  std::iota(pos.begin(), pos.end(), 0);
+  std::shuffle(pos.begin(), pos.end(), ioRng);
+
+  for (i32 i = 0; i < iNumErrors; i++)
+  {
+    iopCodeword[pos[i]] ^= (u8)(1 + ioRng() % 255);
+  }
+}
+
+// the decoder returns only the number of corrected data symbols, corrections in the parity bytes are not counted
+i32 num_data_errors(const TCodeword & iSent, const TCodeword & iReceived)
+{
+  return (i32)std::inner_product(iSent.begin(), iSent.begin() + cDataLen, iReceived.begin(), 0, std::plus<>(), std::not_equal_to<>());
+}
+
+struct SResult
+{
+  i16 ret;
+  std::array<u8, ReedSolomonFast::cCodeLength> data;
+};
+
+SResult decode_ref(ReedSolomon & ioRef, const u8 * ipCodeword, const i16 iCutLen)
+{
+  SResult r{};
+  r.ret = ioRef.dec(ipCodeword, r.data.data(), iCutLen);
+  return r;
+}
+
+SResult decode_fast(const ReedSolomonFast & iFast, const u8 * ipCodeword, const i16 iCutLen)
+{
+  SResult r{};
+  r.ret = iFast.dec(ipCodeword, r.data.data(), iCutLen);
+  return r;
+}
+
+} // namespace
+
+// up to 5 symbol errors are corrected, the result has to be the original data
+TEST(ReedSolomonFast, CorrectsUpToFiveErrors)
+{
+  std::mt19937 rng(11);
+  ReedSolomon encoder(8, 0435, 0, 1, 10);
+
+  for (const bool useSimd : { false, true })
+  {
+    const ReedSolomonFast fast(useSimd);
+
+    for (i32 numErrors = 0; numErrors <= ReedSolomonFast::cNumRoots / 2; numErrors++)
+    {
+      for (i32 n = 0; n < 200; n++)
+      {
+        const TCodeword codeword = random_codeword(encoder, rng);
+        TCodeword received = codeword;
+        add_errors(received.data(), cCodewordLen, numErrors, rng);
+
+        const SResult r = decode_fast(fast, received.data(), cCutLen);
+        ASSERT_EQ(r.ret, num_data_errors(codeword, received)) << (useSimd ? "SIMD" : "scalar") << " kernel, " << numErrors << " errors";
+        ASSERT_TRUE(std::equal(codeword.begin(), codeword.begin() + cDataLen, r.data.begin()));
+      }
+    }
+  }
+}
+
+// errors only in the parity bytes or as one burst at the begin or end of the codeword
+TEST(ReedSolomonFast, CorrectsSpecialErrorPositions)
+{
+  std::mt19937 rng(12);
+  ReedSolomon encoder(8, 0435, 0, 1, 10);
+  const ReedSolomonFast fast;
+
+  for (const i32 start : { 0, cDataLen - 3, cDataLen, cCodewordLen - 5 })
+  {
+    const TCodeword codeword = random_codeword(encoder, rng);
+    TCodeword received = codeword;
+    for (i32 i = start; i < start + 5; i++)
+    {
+      received[i] = (u8)~received[i];
+    }
+
+    const SResult r = decode_fast(fast, received.data(), cCutLen);
+    EXPECT_EQ(r.ret, num_data_errors(codeword, received)) << "burst at " << start;
+    EXPECT_TRUE(std::equal(codeword.begin(), codeword.begin() + cDataLen, r.data.begin())) << "burst at " << start;
+  }
+}
+
+// beyond the correction capability the fast decoder has to agree with ReedSolomon, too (either both detect the
+// failure with -1 or both deliver the same miscorrection), also for other cut lengths than the one of DAB+
+TEST(ReedSolomonFast, MatchesReferenceDecoder)
+{
+  std::mt19937 rng(13);
+  ReedSolomon encoder(8, 0435, 0, 1, 10);
+  ReedSolomon ref(8, 0435, 0, 1, 10);
+  i32 numUncorrectable = 0;
+
+  for (const bool useSimd : { false, true })
+  {
+    const ReedSolomonFast fast(useSimd);
+
+    for (const i16 cutLen : { cCutLen, (i16)200, (i16)100, (i16)0 })
+    {
+      const i32 codewordLen = ReedSolomonFast::cCodeLength - cutLen;
+
+      for (i32 numErrors = 0; numErrors <= 11; numErrors++)
+      {
+        for (i32 n = 0; n < 100; n++)
+        {
+          std::array<u8, ReedSolomonFast::cCodeLength> data{};
+          std::array<u8, ReedSolomonFast::cCodeLength> codeword{};
+          std::generate_n(data.begin(), codewordLen - ReedSolomonFast::cNumRoots, [&rng]() { return (u8)rng(); });
+          encoder.enc(data.data(), codeword.data(), cutLen);
+          add_errors(codeword.data(), codewordLen, numErrors, rng);
+
+          const SResult r1 = decode_ref(ref, codeword.data(), cutLen);
+          const SResult r2 = decode_fast(fast, codeword.data(), cutLen);
+          ASSERT_EQ(r1.ret, r2.ret) << (useSimd ? "SIMD" : "scalar") << " kernel, cut " << cutLen << ", " << numErrors << " errors";
+          ASSERT_TRUE(std::equal(r1.data.begin(), r1.data.begin() + codewordLen - ReedSolomonFast::cNumRoots, r2.data.begin()));
+          numUncorrectable += (r1.ret < 0);
+        }
+      }
+    }
+  }
+  EXPECT_GT(numUncorrectable, 0); // the uncorrectable path was really tested
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Micro benchmark of the RingBuffer index updates and the blocking wait, run it before and after a change of ringbuffer.h.
+//  - uncontended: put and get of small blocks in one thread, shows the cost of the index updates (fast path)
+//  - streaming:   a producer thread writes sample blocks like a device, the consumer waits like the OFDM thread
+
+#include "ringbuffer.h"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using TClock = std::chrono::steady_clock;
+
+f64 elapsed_ns(const TClock::time_point iStart)
+{
+  return (f64)std::chrono::duration_cast<std::chrono::nanoseconds>(TClock::now() - iStart).count();
+}
+
+void bench_uncontended(const i32 iBlockSize)
+{
+  constexpr i32 cNumIter = 2'000'000;
+  RingBuffer<cf32> ring(16384);
+  std::vector<cf32> block(iBlockSize);
+
+  const auto start = TClock::now();
+  for (i32 i = 0; i < cNumIter; i++)
+  {
+    ring.put_data_into_ring_buffer(block.data(), iBlockSize);
+    ring.get_data_from_ring_buffer(block.data(), iBlockSize);
+  }
+  printf("uncontended, block %4d: %7.1f ns per put/get pair\n", iBlockSize, elapsed_ns(start) / cNumIter);
+}
+
+void bench_streaming(const i32 iProducerBlockSize, const i32 iConsumerBlockSize)
+{
+  constexpr i64 cNumSamples = 200'000'000;
+  RingBuffer<cf32> ring(256 * 1024);
+
+  const auto start = TClock::now();
+
+  std::thread producer([&]()
+  {
+    std::vector<cf32> block(iProducerBlockSize);
+    for (i64 n = 0; n < cNumSamples; n += iProducerBlockSize)
+    {
+      ring.wait_for_write_available(iProducerBlockSize, std::chrono::milliseconds(100));
+      ring.put_data_into_ring_buffer(block.data(), iProducerBlockSize);
+    }
+  });
+
+  std::vector<cf32> block(iConsumerBlockSize);
+  i64 numRead = 0;
+  while (numRead < cNumSamples)
+  {
+    ring.wait_for_read_available(iConsumerBlockSize, std::chrono::milliseconds(100));
+    numRead += ring.get_data_from_ring_buffer(block.data(), iConsumerBlockSize);
+  }
+  producer.join();
+
+  printf("streaming, blocks %5d -> %5d: %6.1f MSamples/s\n", iProducerBlockSize, iConsumerBlockSize, (f64)cNumSamples * 1e3 / elapsed_ns(start));
+}
+
+} // namespace
+
+int main()
+{
+  for (const i32 blockSize : { 1, 16, 256, 2048 })
+  {
+    bench_uncontended(blockSize);
+  }
+
+  bench_streaming(16384, 2048); // e.g. RTL-SDR USB transfers to OFDM symbol sized reads
+  bench_streaming(256, 2048);   // small device blocks, the reader waits often
+  bench_streaming(2048, 256);
+  return 0;
+}
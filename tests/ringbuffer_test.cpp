@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ringbuffer.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+// a blocked reader has to be woken up by the put, not by the timeout
+TEST(RingBuffer, WaitingReaderIsWokenUp)
+{
+  RingBuffer<i32> ring(1024);
+  const std::vector<i32> block(100, 7);
+
+  for (i32 n = 0; n < 20; n++)
+  {
+    std::thread producer([&]()
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      ring.put_data_into_ring_buffer(block.data(), 50);
+      ring.put_data_into_ring_buffer(block.data(), 50);
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_GE(ring.wait_for_read_available(100, std::chrono::seconds(10)), 100);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5)) << "wake-up lost in round " << n;
+    producer.join();
+    ring.skip_data_in_ring_buffer(100);
+  }
+}
+
+// a producer and a consumer which both block often have to transfer all data in order, without a lost wake-up
+TEST(RingBuffer, StreamingWithBlockingWaits)
+{
+  constexpr i32 cNumElems = 96 * 160 * 130; // whole blocks on both sides
+  constexpr i32 cTimeout_ms = 2000;
+  RingBuffer<i32> ring(512);
+  bool timedOut = false;
+
+  std::thread producer([&]()
+  {
+    std::vector<i32> block(96);
+    for (i32 n = 0; n < cNumElems; n += (i32)block.size())
+    {
+      for (i32 i = 0; i < (i32)block.size(); i++)
+      {
+        block[i] = n + i;
+      }
+      if (ring.wait_for_write_available((i32)block.size(), std::chrono::milliseconds(cTimeout_ms)) < (i32)block.size())
+      {
+        timedOut = true;
+      }
+      ring.put_data_into_ring_buffer(block.data(), (i32)block.size());
+    }
+  });
+
+  std::vector<i32> block(160);
+  i32 expected = 0;
+  bool inOrder = true;
+  while (expected < cNumElems)
+  {
+    const i32 needed = std::min((i32)block.size(), cNumElems - expected);
+    if (ring.wait_for_read_available(needed, std::chrono::milliseconds(cTimeout_ms)) < needed)
+    {
+      ADD_FAILURE() << "reader timed out at element " << expected;
+      break;
+    }
+    const i32 numRead = ring.get_data_from_ring_buffer(block.data(), needed);
+    for (i32 i = 0; i < numRead; i++)
+    {
+      inOrder &= (block[i] == expected++);
+    }
+  }
+  producer.join();
+
+  EXPECT_TRUE(inOrder);
+  EXPECT_FALSE(timedOut);
+}
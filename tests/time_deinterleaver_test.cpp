@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "time_deinterleaver.h"
+#include "viterbi_spiral.h"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace
+{
+
+// the former de-interleaver of the Backend with a full copy of the fragment for each of the 16 CIFs
+class TimeDeInterleaverRef
+{
+public:
+  explicit TimeDeInterleaverRef(const i32 iFragmentSize)
+    : mData(16, std::vector<i16>(iFragmentSize, 0))
+  {}
+
+  void process(const i16 * const ipIn, i16 * const opOut)
+  {
+    for (size_t i = 0; i < mData[0].size(); i++)
+    {
+      opOut[i] = mData[(mIndex + TimeDeInterleaver::cInterleaveMap[i & 0x0F]) & 0x0F][i];
+      mData[mIndex][i] = ipIn[i];
+    }
+    mIndex = (mIndex + 1) & 0x0F;
+  }
+
+private:
+  std::vector<std::vector<i16>> mData;
+  i32 mIndex = 0;
+};
+
+std::vector<i16> random_soft_bits(const i32 iSize, std::mt19937 & ioRng)
+{
+  std::uniform_int_distribution<i32> dist(-127, 127);
+  std::vector<i16> v(iSize);
+  for (auto & x : v)
+  {
+    x = (i16)dist(ioRng);
+  }
+  return v;
+}
+
+} // namespace
+
+// fragment sizes from the smallest sub-channel (1 CU) up to a full 384 kbit/s EEP-1A one
+TEST(TimeDeInterleaver, MatchesFullCopyDeInterleaver)
+{
+  std::mt19937 rng(31);
+
+  for (const i32 numCUs : { 1, 6, 24, 48, 96, 288, 432 })
+  {
+    const i32 fragmentSize = numCUs * 64;
+    TimeDeInterleaver dut(fragmentSize);
+    TimeDeInterleaverRef ref(fragmentSize);
+    std::vector<i16> out1(fragmentSize);
+    std::vector<i16> out2(fragmentSize);
+
+    EXPECT_EQ(dut.get_ring_size(), 136 * fragmentSize / 16);
+
+    for (i32 cif = 0; cif < 50; cif++)
+    {
+      const std::vector<i16> in = random_soft_bits(fragmentSize, rng);
+      ref.process(in.data(), out1.data());
+      dut.process(in.data(), out2.data());
+      ASSERT_EQ(out1, out2) << numCUs << " CUs, CIF " << cif;
+    }
+  }
+}
+
+// the energy dispersal XOR in the chainback has to give the same bytes as packing the unpacked output and XORing it
+TEST(EnergyDispersal, FusedIntoChainbackMatchesSeparatePass)
+{
+  std::mt19937 rng(32);
+
+  for (const i32 bitRate : { 8, 64, 128, 384 })
+  {
+    const i32 numBits = bitRate * 24;
+    ViterbiSpiral viterbi(numBits, true);
+    const std::vector<i16> softBits = random_soft_bits(4 * (numBits + 6), rng);
+    std::vector<u8> mask(numBits / 8);
+    std::vector<u8> bits(numBits);
+    std::vector<u8> packed(numBits / 8);
+
+    for (auto & m : mask)
+    {
+      m = (u8)rng();
+    }
+
+    viterbi.deconvolve(softBits.data(), bits.data());
+    viterbi.deconvolve_packed(softBits.data(), packed.data(), mask.data());
+
+    for (i32 i = 0; i < numBits / 8; i++)
+    {
+      u8 byte = 0;
+      for (i32 j = 0; j < 8; j++)
+      {
+        byte = (u8)((byte << 1) | bits[8 * i + j]);
+      }
+      ASSERT_EQ(packed[i], (u8)(byte ^ mask[i])) << bitRate << " kbit/s, byte " << i;
+    }
+  }
+}
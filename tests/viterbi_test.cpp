@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 by Thomas Neder (https://github.com/tomneda)
+ *
+ * DABstar is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2 of the License, or any later version.
+ *
+ * DABstar is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with DABstar. If not, write to the Free Software
+ * Foundation, Inc. 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "viterbi_spiral.h"
+#include "viterbi_kernels.h"
+#include "cpu_features.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstring>
+#include <random>
+#include <thread>
+
+namespace
+{
+
+// K = 7, R = 1/4 convolutional encoder like in ETSI EN 300 401, the K - 1 tail bits are zero
+std::vector<u8> encode(const std::vector<u8> & iBits)
+{
+  static constexpr i32 cPolys[RATE] = { 109, 79, 83, 109 };
+  std::vector<u8> codeBits;
+  i32 sr = 0;
+
+  for (size_t i = 0; i < iBits.size() + (K - 1); i++)
+  {
+    sr = ((sr << 1) | (i < iBits.size() ? iBits[i] : 0)) & 0xff;
+    for (const i32 poly : cPolys)
+    {
+      codeBits.push_back((u8)(std::bitset<8>(sr & poly).count() & 1));
+    }
+  }
+  return codeBits;
+}
+
+// soft bits like from the OFDM decoder: positive for a 1, negative for a 0, with gaussian noise of iNoiseStdDev
+std::vector<i16> modulate(const std::vector<u8> & iCodeBits, const f32 iNoiseStdDev, std::mt19937 & ioRng)
+{
+  std::normal_distribution<f32> noise(0.0f, iNoiseStdDev);
+  std::vector<i16> softBits(iCodeBits.size());
+
+  for (size_t i = 0; i < iCodeBits.size(); i++)
+  {
+    const f32 v = (iCodeBits[i] != 0 ? 100.0f : -100.0f) + (iNoiseStdDev > 0.0f ? noise(ioRng) : 0.0f);
+    softBits[i] = (i16)std::clamp(v, -32767.0f, 32767.0f);
+  }
+  return softBits;
+}
+
+std::vector<u8> random_bits(const i32 iNumBits, std::mt19937 & ioRng)
+{
+  std::vector<u8> bits(iNumBits);
+  for (auto & b : bits)
+  {
+    b = (u8)(ioRng() & 1);
+  }
+  return bits;
+}
+
+std::vector<u8> decode(ViterbiSpiral & ioViterbi, const std::vector<i16> & iSoftBits, const i32 iNumBits)
+{
+  std::vector<u8> bits(iNumBits);
+  ioViterbi.deconvolve(iSoftBits.data(), bits.data());
+  return bits;
+}
+
+} // namespace
+
+TEST(ViterbiSpiral, DecodesNoiseFreeFrame)
+{
+  constexpr i32 cNumBits = 768;
+  std::mt19937 rng(1);
+  const std::vector<u8> bits = random_bits(cNumBits, rng);
+  ViterbiSpiral viterbi(cNumBits, true);
+
+  EXPECT_EQ(decode(viterbi, modulate(encode(bits), 0.0f, rng), cNumBits), bits);
+}
+
+// The path metrics are kept per instance, so instances in different threads must not disturb each other.
+TEST(ViterbiSpiral, ConcurrentInstancesDecodeLikeSequential)
+{
+  constexpr i32 cNumBits = 24 * 384; // largest MSC sub-channel frame
+  constexpr i32 cNumFrames = 8;
+  constexpr i32 cNumThreads = 4;
+  constexpr i32 cNumRounds = 10;
+  std::mt19937 rng(2);
+  std::vector<std::vector<i16>> softBits;
+  std::vector<std::vector<u8>> expected;
+
+  {
+    ViterbiSpiral viterbi(cNumBits, true);
+    for (i32 f = 0; f < cNumFrames; f++)
+    {
+      softBits.emplace_back(modulate(encode(random_bits(cNumBits, rng)), 120.0f, rng));
+      expected.emplace_back(decode(viterbi, softBits.back(), cNumBits));
+    }
+  }
+
+  std::atomic<i32> numMismatches{0};
+  std::vector<std::thread> threads;
+
+  for (i32 t = 0; t < cNumThreads; t++)
+  {
+    threads.emplace_back([&, t]()
+    {
+      ViterbiSpiral viterbi(cNumBits, true);
+      for (i32 r = 0; r < cNumRounds; r++)
+      {
+        const i32 f = (t + r) % cNumFrames;
+        if (decode(viterbi, softBits[f], cNumBits) != expected[f])
+        {
+          ++numMismatches;
+        }
+      }
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+  EXPECT_EQ(numMismatches.load(), 0);
+}
+
+namespace
+{
+
+struct SViterbiKernelUnderTest
+{
+  TViterbiKernel pFunc;
+  const char * pName;
+  bool available;
+};
+
+std::vector<SViterbiKernelUnderTest> simd_kernels()
+{
+  return {
+#if defined(VITERBI_X86)
+    { viterbi_kernel_sse2, "SSE2", CpuFeatures::has_sse2() },
+    { viterbi_kernel_avx2, "AVX2", CpuFeatures::has_avx2() },
+    { viterbi_kernel_avx512, "AVX-512", CpuFeatures::has_avx512bw() },
+#elif defined(VITERBI_NEON)
+    { viterbi_kernel_neon, "NEON", CpuFeatures::has_neon() },
+#endif
+  };
+}
+
+std::vector<decision_t> run_kernel(const TViterbiKernel iKernel, const std::vector<i16> & iSoftBits, const u32 iNumBits)
+{
+  alignas(64) u8 metrics1[NUMSTATES * sizeof(i32)];
+  alignas(64) u8 metrics2[NUMSTATES * sizeof(i32)];
+  std::vector<decision_t> decisions(iNumBits);
+
+  iKernel(iSoftBits.data(), metrics1, metrics2, decisions.data(), iNumBits);
+  return decisions;
+}
+
+} // namespace
+
+// All SIMD kernels have to produce exactly the decisions of the scalar kernel (for all frame sizes and noise levels,
+// the strong noise forces the renormalization of the path metrics).
+TEST(ViterbiKernels, SimdKernelsMatchScalar)
+{
+  std::mt19937 rng(3);
+  i32 numTested = 0;
+
+  for (const i32 numBits : { 768, 24 * 8, 24 * 128, 24 * 384 })
+  {
+    for (const f32 noise : { 0.0f, 60.0f, 150.0f, 400.0f })
+    {
+      const std::vector<i16> softBits = modulate(encode(random_bits(numBits, rng)), noise, rng);
+      const u32 numKernelBits = numBits + (K - 1);
+      const std::vector<decision_t> expected = run_kernel(viterbi_kernel_scalar, softBits, numKernelBits);
+
+      for (const auto & k : simd_kernels())
+      {
+        if (!k.available)
+        {
+          continue;
+        }
+        const std::vector<decision_t> decisions = run_kernel(k.pFunc, softBits, numKernelBits);
+        EXPECT_EQ(memcmp(decisions.data(), expected.data(), numKernelBits * sizeof(decision_t)), 0)
+          << k.pName << " kernel, " << numBits << " bits, noise " << noise;
+        ++numTested;
+      }
+    }
+  }
+  if (numTested == 0)
+  {
+    GTEST_SKIP() << "no SIMD kernel available on this CPU";
+  }
+}
+
+// The full decoder (chosen kernel and chainback) has to decode a moderately noisy frame without errors.
+TEST(ViterbiKernels, ChosenKernelCorrectsErrors)
+{
+  constexpr i32 cNumBits = 24 * 128;
+  std::mt19937 rng(4);
+  const std::vector<u8> bits = random_bits(cNumBits, rng);
+  const std::vector<i16> softBits = modulate(encode(bits), 70.0f, rng);
+  i32 numHardErrors = 0;
+
+  for (size_t i = 0; i < softBits.size(); i++)
+  {
+    numHardErrors += ((softBits[i] > 0) != (encode(bits)[i] != 0));
+  }
+  ASSERT_GT(numHardErrors, 0); // the frame really needs error correction
+
+  ViterbiSpiral viterbi(cNumBits, true);
+  EXPECT_EQ(decode(viterbi, softBits, cNumBits), bits);
+}